@@ -1,4 +1,8 @@
 #include "BloodreadBaseCharacter.h"
+#include "BloodreadGame.h"
+#include "BloodreadMemory.h"
+#include "BloodreadStats.h"
+#include "BootProfiler.h"
 #include "Engine/Engine.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -24,9 +28,20 @@
 #include "BloodreadHealthBarWidget.h"
 #include "BloodreadDragonCharacter.h"
 #include "UniversalHealthBarWidget.h"
-
-ABloodreadBaseCharacter::ABloodreadBaseCharacter()
-{
+#include "CharacterClassRegistry.h"
+#include "ClassMontageCache.h"
+#include "BloodreadSignificance.h"
+#include "CombatTickSubsystem.h"
+#include "MatchRecorder.h"
+#include "MatchTelemetry.h"
+#include "RpcRateLimiter.h"
+#include "TeamSubsystem.h"
+#include "GameFramework/GameStateBase.h"
+
+ABloodreadBaseCharacter::ABloodreadBaseCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UBloodreadMovementComponent>(ACharacter::CharacterMovementComponentName))
+{
+    LLM_SCOPE_BYTAG(Bloodread_Characters);
     PrimaryActorTick.bCanEverTick = true;
     
     // Enable network replication
@@ -89,6 +104,11 @@ ABloodreadBaseCharacter::ABloodreadBaseCharacter()
         CharacterMesh->SetRelativeRotation(MeshRotationOffset);
         UE_LOG(LogTemp, Warning, TEXT("BloodreadBaseCharacter: Applied mesh offsets - Location: %s, Rotation: %s"), 
                *MeshLocationOffset.ToString(), *MeshRotationOffset.ToString());
+
+        // Animation cost: skip frames by distance (interpolated) and don't refresh bones while off screen.
+        // UCharacterAnimationBudgetSubsystem further throttles remote characters that fall outside the budget.
+        CharacterMesh->bEnableUpdateRateOptimizations = true;
+        CharacterMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
     }
 
     // Initialize default stats
@@ -96,26 +116,29 @@ ABloodreadBaseCharacter::ABloodreadBaseCharacter()
     CurrentHealth = CurrentStats.MaxHealth;
     CurrentMana = CurrentStats.Mana;
     
-    // Initialize health bar component (exactly like PracticeDummy)
-    HealthBarWidgetComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthBarWidgetComponent"));
-    HealthBarWidgetComponent->SetupAttachment(RootComponent); // Attach to root like dummy
-    HealthBarWidgetComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 120.0f)); // Above player head
-    HealthBarWidgetComponent->SetDrawSize(FVector2D(200.0f, 50.0f));
-    HealthBarWidgetComponent->SetWidgetSpace(EWidgetSpace::Screen); // Screen space - always face camera
-    HealthBarWidgetComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision); // No collision like dummy
-    
-    // Set default widget class to fix "Widget Class Set: NONE" error
-    static ConstructorHelpers::FClassFinder<UUserWidget> HealthBarWidgetBPClass(TEXT("/Game/UI/BloodreadHealthBarWidget"));
-    if (HealthBarWidgetBPClass.Class != nullptr)
+    // Initialize health bar component (exactly like PracticeDummy); dedicated servers never create it
+    if (!BloodreadCosmetics::IsServerProcess())
     {
-        HealthBarWidgetComponent->SetWidgetClass(HealthBarWidgetBPClass.Class);
-        UE_LOG(LogTemp, Warning, TEXT("BloodreadBaseCharacter: Set default BloodreadHealthBarWidget class"));
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("BloodreadBaseCharacter: Could not find Blueprint BloodreadHealthBarWidget, using C++ class"));
-        // Fallback to C++ class
-        HealthBarWidgetComponent->SetWidgetClass(UBloodreadHealthBarWidget::StaticClass());
+        HealthBarWidgetComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthBarWidgetComponent"));
+        HealthBarWidgetComponent->SetupAttachment(RootComponent); // Attach to root like dummy
+        HealthBarWidgetComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 120.0f)); // Above player head
+        HealthBarWidgetComponent->SetDrawSize(FVector2D(200.0f, 50.0f));
+        HealthBarWidgetComponent->SetWidgetSpace(EWidgetSpace::Screen); // Screen space - always face camera
+        HealthBarWidgetComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision); // No collision like dummy
+
+        // Set default widget class to fix "Widget Class Set: NONE" error
+        static ConstructorHelpers::FClassFinder<UUserWidget> HealthBarWidgetBPClass(TEXT("/Game/UI/BloodreadHealthBarWidget"));
+        if (HealthBarWidgetBPClass.Class != nullptr)
+        {
+            HealthBarWidgetComponent->SetWidgetClass(HealthBarWidgetBPClass.Class);
+            UE_LOG(LogTemp, Warning, TEXT("BloodreadBaseCharacter: Set default BloodreadHealthBarWidget class"));
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("BloodreadBaseCharacter: Could not find Blueprint BloodreadHealthBarWidget, using C++ class"));
+            // Fallback to C++ class
+            HealthBarWidgetComponent->SetWidgetClass(UBloodreadHealthBarWidget::StaticClass());
+        }
     }
     
     // Distance-based visibility settings
@@ -131,19 +154,28 @@ ABloodreadBaseCharacter::ABloodreadBaseCharacter()
 
 void ABloodreadBaseCharacter::BeginPlay()
 {
+    LLM_SCOPE_BYTAG(Bloodread_Characters);
     Super::BeginPlay();
 
     UE_LOG(LogTemp, Warning, TEXT("=== CHARACTER BEGINPLAY START ==="));
     UE_LOG(LogTemp, Warning, TEXT("Character BeginPlay called for %s, CurrentClass=%d"), *GetName(), (int32)CurrentCharacterClass);
     UE_LOG(LogTemp, Warning, TEXT("Character class name: %s"), *GetClass()->GetName());
 
-    // ALWAYS force initialization to debug the mesh issue
-    UE_LOG(LogTemp, Warning, TEXT("FORCING character initialization for mesh debugging"));
-    ForceInitializeCharacterSystems();
+    // Dedicated servers never render, so only montages tick; bones are refreshed on demand for hit detection
+    if (GetNetMode() == NM_DedicatedServer && GetMesh())
+    {
+        GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+    }
 
-    // Initialize character from class data
-    UE_LOG(LogTemp, Warning, TEXT("Calling InitializeFromClassData"));
-    InitializeFromClassData(CharacterClassData);
+    // Widget components that came in through Blueprint defaults (or a PIE server) go too
+    if (BloodreadCosmetics::ShouldSkip(this))
+    {
+        BloodreadCosmetics::StripWidgetComponents(this);
+        HealthBarWidgetComponent = nullptr;
+    }
+
+    // Single init pass; possession and the possession RPC call this again but find nothing left to apply
+    ForceInitializeCharacterSystems();
     
     // Skip health bar initialization in BeginPlay - it will be handled later
     // For player characters: PlayerController will handle UI in OnPossess
@@ -164,9 +196,30 @@ void ABloodreadBaseCharacter::BeginPlay()
     
     // Set up input if we have a controller
     SetupInputContext();
+
+    // Cooldowns and regen advance on the fixed combat step so they don't drift with frame or server tick rate
+    if (UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this))
+    {
+        FixedCombatStepHandle = CombatTick->OnFixedStep.AddWeakLambda(this, [this](float StepSeconds, uint32 /*StepIndex*/)
+        {
+            FixedCombatStep(StepSeconds);
+        });
+    }
+
+    // Server-side match recording (kill-cam and replays)
+    if (UMatchRecorderSubsystem* Recorder = UMatchRecorderSubsystem::Get(this))
+    {
+        Recorder->RegisterActor(this);
+    }
+
+    RefreshTeamMembership();
     
-    // Start health bar visibility timer
-    if (HealthBarVisibilityCheckInterval > 0.0f)
+    // On clients the significance subsystem drives health bar visibility; the distance timer is the fallback
+    if (UBloodreadSignificanceSubsystem* Significance = UBloodreadSignificanceSubsystem::Get(this))
+    {
+        Significance->RegisterActor(this);
+    }
+    else if (HealthBarVisibilityCheckInterval > 0.0f && !BloodreadCosmetics::ShouldSkip(this))
     {
         GetWorldTimerManager().SetTimer(HealthBarVisibilityTimerHandle, 
                                        this, &ABloodreadBaseCharacter::UpdateHealthBarVisibility, 
@@ -192,9 +245,10 @@ void ABloodreadBaseCharacter::SetupPlayerInputComponent(UInputComponent* PlayerI
     // Action Mappings (from DefaultInput.ini)
     PlayerInputComponent->BindAction("Jump", IE_Pressed, this, &ACharacter::Jump);
     PlayerInputComponent->BindAction("Jump", IE_Released, this, &ACharacter::StopJumping);
-    PlayerInputComponent->BindAction("Attack", IE_Pressed, this, &ABloodreadBaseCharacter::Attack);
-    PlayerInputComponent->BindAction("Ability1", IE_Pressed, this, &ABloodreadBaseCharacter::UseAbility1);
-    PlayerInputComponent->BindAction("Ability2", IE_Pressed, this, &ABloodreadBaseCharacter::UseAbility2);
+    // Combat presses go through the input buffer so early presses aren't lost
+    PlayerInputComponent->BindAction("Attack", IE_Pressed, this, &ABloodreadBaseCharacter::BufferAttackInput);
+    PlayerInputComponent->BindAction("Ability1", IE_Pressed, this, &ABloodreadBaseCharacter::BufferAbility1Input);
+    PlayerInputComponent->BindAction("Ability2", IE_Pressed, this, &ABloodreadBaseCharacter::BufferAbility2Input);
     PlayerInputComponent->BindAction("TestDamage", IE_Pressed, this, &ABloodreadBaseCharacter::TestDamage);
     PlayerInputComponent->BindAction("TestHeal", IE_Pressed, this, &ABloodreadBaseCharacter::TestHeal);
 
@@ -207,13 +261,114 @@ void ABloodreadBaseCharacter::SetupPlayerInputComponent(UInputComponent* PlayerI
     UE_LOG(LogTemp, Warning, TEXT("✅ Traditional input system setup complete"));
 }
 
+void ABloodreadBaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this))
+    {
+        CombatTick->OnFixedStep.Remove(FixedCombatStepHandle);
+    }
+    FixedCombatStepHandle.Reset();
+
+    if (UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(this))
+    {
+        Teams->RemoveMember(this);
+    }
+
+    if (UMatchRecorderSubsystem* Recorder = UMatchRecorderSubsystem::Get(this))
+    {
+        Recorder->UnregisterActor(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ABloodreadBaseCharacter::PossessedBy(AController* NewController)
+{
+    BLOODREAD_SCOPE(STAT_BloodreadSpawn);
+    Super::PossessedBy(NewController);
+
+    // Teams are handed out on first possession; re-possessing (class swaps, respawn) keeps the existing one
+    if (Team == ETeam::None)
+    {
+        if (const UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(this))
+        {
+            SetTeam(Teams->ChooseTeam(this));
+        }
+    }
+}
+
+void ABloodreadBaseCharacter::SetTeam(ETeam NewTeam)
+{
+    if (!HasAuthority() || Team == NewTeam)
+    {
+        return;
+    }
+
+    Team = NewTeam;
+    RefreshTeamMembership();
+}
+
+void ABloodreadBaseCharacter::OnRep_Team()
+{
+    RefreshTeamMembership();
+}
+
+void ABloodreadBaseCharacter::RefreshTeamMembership()
+{
+    if (UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(this))
+    {
+        Teams->UpdateMembership(this);
+    }
+}
+
+TArray<ABloodreadBaseCharacter*> ABloodreadBaseCharacter::GetEnemiesInRadius(float Radius)
+{
+    TArray<ABloodreadBaseCharacter*> Enemies;
+    if (const UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(this))
+    {
+        Teams->GetEnemiesInRadius(this, Radius, Enemies);
+    }
+    return Enemies;
+}
+
+TArray<ABloodreadBaseCharacter*> ABloodreadBaseCharacter::GetAlliesInRadius(float Radius)
+{
+    TArray<ABloodreadBaseCharacter*> Allies;
+    if (const UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(this))
+    {
+        Teams->GetAlliesInRadius(this, Radius, Allies);
+    }
+    return Allies;
+}
+
+TArray<ABloodreadBaseCharacter*> ABloodreadBaseCharacter::GetAllAllies()
+{
+    TArray<ABloodreadBaseCharacter*> Allies;
+    if (const UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(this))
+    {
+        Teams->GetAllies(this, Allies);
+    }
+    return Allies;
+}
+
 void ABloodreadBaseCharacter::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
-    UpdateAbilityCooldowns(DeltaTime);
+}
+
+void ABloodreadBaseCharacter::FixedCombatStep(float StepSeconds)
+{
+    LLM_SCOPE_BYTAG(Bloodread_Abilities);
+    UpdateAbilityCooldowns(StepSeconds);
+
+    // Fire buffered presses on the step their cooldown runs out
+    if (!CombatInputBuffer.IsEmpty())
+    {
+        ProcessCombatInputBuffer();
+    }
     
     // Mana regeneration system
-    ManaRegenTimer += DeltaTime;
+    ManaRegenTimer += StepSeconds;
     if (ManaRegenTimer >= 1.0f) // Regenerate every second
     {
         int32 OldMana = CurrentMana;
@@ -222,130 +377,183 @@ void ABloodreadBaseCharacter::Tick(float DeltaTime)
         {
             OnManaChanged(OldMana, CurrentMana);
         }
-        ManaRegenTimer = 0.0f;
+        // Keep the remainder so the regen period is exact in steps
+        ManaRegenTimer -= 1.0f;
     }
 }
 
 void ABloodreadBaseCharacter::SetCharacterClass(ECharacterClass NewClass)
 {
-    CurrentCharacterClass = NewClass;
-    OnCharacterClassChanged();
-    
-    UE_LOG(LogTemp, Warning, TEXT("Character class changed to: %d"), (int32)NewClass);
+    InitializeFromClass(NewClass);
 }
 
 void ABloodreadBaseCharacter::InitializeFromClassData(const FCharacterClassData& ClassData)
 {
-    CharacterClassData = ClassData;
-    CurrentCharacterClass = ClassData.CharacterClass;
-    CurrentStats = ClassData.BaseStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
+    // The registry is the single source of class data; the passed struct only selects the class
+    InitializeFromClass(ClassData.CharacterClass);
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("InitializeFromClassData: Initializing character as %s"), *ClassData.ClassName);
+void ABloodreadBaseCharacter::InitializeFromClass(ECharacterClass NewClass)
+{
+    CurrentCharacterClass = NewClass;
 
-    // Find all skeletal mesh components and try to apply mesh
-    TArray<USkeletalMeshComponent*> MeshComponents;
-    GetComponents<USkeletalMeshComponent>(MeshComponents);
+    ECharacterInitStep Steps = ECharacterInitStep::None;
+    if (BoundClass != NewClass)
+    {
+        Steps |= ECharacterInitStep::ClassData;
+    }
+    if (VisualClass != NewClass)
+    {
+        Steps |= ECharacterInitStep::Visuals;
+    }
+    RequestInitSteps(Steps);
+    RunPendingInitSteps();
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("Found %d skeletal mesh components"), MeshComponents.Num());
+void ABloodreadBaseCharacter::RequestInitSteps(ECharacterInitStep Steps)
+{
+    if (Steps != ECharacterInitStep::None)
+    {
+        // Anything that changes also re-runs the class hooks, once, after everything else
+        PendingInitSteps |= Steps | ECharacterInitStep::ClassHooks;
+    }
+}
 
-    bool bMeshApplied = false;
+void ABloodreadBaseCharacter::RunPendingInitSteps()
+{
+    if (PendingInitSteps == ECharacterInitStep::None || CurrentCharacterClass == ECharacterClass::None)
+    {
+        return;
+    }
 
-    // Try to apply mesh based on character class using our new system
-    for (USkeletalMeshComponent* MeshComp : MeshComponents)
+    BLOODREAD_SCOPE(STAT_BloodreadCharacterInit);
+    INC_DWORD_STAT(STAT_BloodreadCharacterInits);
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    const ECharacterInitStep Steps = PendingInitSteps;
+    PendingInitSteps = ECharacterInitStep::None;
+
+    // Subclass constructors bind their class too, but only this pass counts: it runs after Blueprint defaults
+    if (EnumHasAnyFlags(Steps, ECharacterInitStep::ClassData))
+    {
+        BindClassDefinition(CurrentCharacterClass);
+        BoundClass = CurrentCharacterClass;
+    }
+
+    if (EnumHasAnyFlags(Steps, ECharacterInitStep::Visuals))
+    {
+        ApplyClassVisuals(Steps);
+        VisualClass = CurrentCharacterClass;
+    }
+
+    if (EnumHasAnyFlags(Steps, ECharacterInitStep::ClassHooks))
+    {
+        // Resolve this class's montages now rather than on the first attack
+        if (UGameInstance* GameInstance = GetGameInstance())
+        {
+            if (UClassMontageCache* MontageCache = GameInstance->GetSubsystem<UClassMontageCache>())
+            {
+                MontageCache->WarmClass(CurrentCharacterClass);
+            }
+        }
+        OnCharacterClassChanged();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Character init: %s as %s, steps 0x%02x in %.2f ms"), *GetName(), *GetClassDefinition().ClassName,
+           static_cast<uint8>(Steps), FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+const FCharacterClassData& ABloodreadBaseCharacter::GetClassDefinition() const
+{
+    return FCharacterClassRegistry::Get().GetDefinition(CurrentCharacterClass);
+}
+
+void ABloodreadBaseCharacter::BindClassDefinition(ECharacterClass NewClass)
+{
+    LLM_SCOPE_BYTAG(Bloodread_Characters);
+    CurrentCharacterClass = NewClass;
+
+    const FCharacterClassData& ClassData = GetClassDefinition();
+    CurrentStats = ClassData.BaseStats;
+
+    // Health and mana are server-owned; a client takes max health, strength and the rest from the registry but
+    // keeps the replicated values (they arrive in the same bunch as the class, before its OnRep)
+    if (HasAuthority())
+    {
+        CurrentHealth = CurrentStats.MaxHealth;
+        CurrentMana = CurrentStats.Mana;
+    }
+    RefreshTeamMembership();
+
+    Ability1State = FCharacterAbilityRuntimeState();
+    Ability2State = FCharacterAbilityRuntimeState();
+}
+
+void ABloodreadBaseCharacter::ApplyClassVisuals(ECharacterInitStep Steps)
+{
+    LLM_SCOPE_BYTAG(Bloodread_Characters);
+    const FCharacterClassData& ClassData = GetClassDefinition();
+
+    if (EnumHasAnyFlags(Steps, ECharacterInitStep::Mesh | ECharacterInitStep::AnimClass))
     {
-        if (MeshComp)
+        TArray<USkeletalMeshComponent*, TInlineAllocator<4>> MeshComponents;
+        GetComponents<USkeletalMeshComponent>(MeshComponents);
+
+        bool bMeshApplied = false;
+        for (USkeletalMeshComponent* MeshComp : MeshComponents)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Attempting to apply mesh to component: %s"), *MeshComp->GetName());
-            if (ApplyClassDataToMeshComponent(MeshComp, CurrentCharacterClass))
+            if (!MeshComp)
+            {
+                continue;
+            }
+
+            if (EnumHasAnyFlags(Steps, ECharacterInitStep::Mesh))
             {
-                bMeshApplied = true;
-                UE_LOG(LogTemp, Warning, TEXT("SUCCESS: Mesh applied to component %s"), *MeshComp->GetName());
-                
-                // Adjust mesh positioning to fix floating issues and align with camera
+                if (!ApplyClassDataToMeshComponent(MeshComp, CurrentCharacterClass))
+                {
+                    continue;
+                }
+
                 // Position mesh so character stands on ground and camera aligns with head
-                MeshComp->SetRelativeLocation(FVector(0.0f, 0.0f, -88.0f)); // Adjusted for better camera alignment
-                MeshComp->SetRelativeRotation(FRotator(0.0f, -90.0f, 0.0f)); // Rotate to face forward (Paragon characters face sideways by default)
-                
-                UE_LOG(LogTemp, Warning, TEXT("Applied mesh positioning: Location(0,0,-88), Rotation(0,-90,0)"));
-                
-                // Also try to set animation blueprint if we have one
+                // (Paragon characters face sideways by default)
+                MeshComp->SetRelativeLocationAndRotation(FVector(0.0f, 0.0f, -88.0f), FRotator(0.0f, -90.0f, 0.0f));
+            }
+            else if (!MeshComp->GetSkeletalMeshAsset())
+            {
+                continue;
+            }
+            bMeshApplied = true;
+
+            if (EnumHasAnyFlags(Steps, ECharacterInitStep::AnimClass))
+            {
                 if (!ClassData.AnimationBlueprintPath.IsEmpty())
                 {
-                    bool bAnimBPApplied = SetAnimationBlueprintOnComponent(MeshComp, ClassData.AnimationBlueprintPath);
-                    if (bAnimBPApplied)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("Applied animation blueprint from class data to %s"), *MeshComp->GetName());
-                    }
+                    SetAnimationBlueprintOnComponent(MeshComp, ClassData.AnimationBlueprintPath);
                 }
                 else
                 {
                     UE_LOG(LogTemp, Error, TEXT("No animation blueprint path found for character class %d"), (int32)CurrentCharacterClass);
-                    
-                    // Try to load animation blueprint based on character class as fallback
-                    FString FallbackAnimBPPath;
-                    switch (CurrentCharacterClass)
-                    {
-                        case ECharacterClass::Warrior:
-                            FallbackAnimBPPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Gideon_AnimBlueprint.Gideon_AnimBlueprint_C");
-                            break;
-                        case ECharacterClass::Mage:
-                            FallbackAnimBPPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Aurora_AnimBlueprint.Aurora_AnimBlueprint_C");
-                            break;
-                        case ECharacterClass::Rogue:
-                            FallbackAnimBPPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Shinbi_AnimBlueprint.Shinbi_AnimBlueprint_C");
-                            break;
-                        case ECharacterClass::Healer:
-                            FallbackAnimBPPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Fey_AnimBlueprint.Fey_AnimBlueprint_C");
-                            break;
-                        case ECharacterClass::Dragon:
-                            FallbackAnimBPPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Yin_AnimBlueprint.Yin_AnimBlueprint_C");
-                            break;
-                        default:
-                            break;
-                    }
-                    
-                    if (!FallbackAnimBPPath.IsEmpty())
-                    {
-                        bool bFallbackApplied = SetAnimationBlueprintOnComponent(MeshComp, FallbackAnimBPPath);
-                        if (bFallbackApplied)
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("Applied fallback animation blueprint for class %d"), (int32)CurrentCharacterClass);
-                        }
-                        else
-                        {
-                            UE_LOG(LogTemp, Error, TEXT("Failed to load fallback animation blueprint for class %d"), (int32)CurrentCharacterClass);
-                        }
-                    }
                 }
             }
         }
-    }
 
-    if (!bMeshApplied)
-    {
-        UE_LOG(LogTemp, Error, TEXT("FAILED: Could not apply mesh to any skeletal mesh component"));
-    }
-    else
-    {
-        // After mesh is applied, reactivate animation blueprints to ensure they're working
-        UE_LOG(LogTemp, Warning, TEXT("Mesh application complete, reactivating animation blueprints..."));
+        if (!bMeshApplied)
+        {
+            UE_LOG(LogTemp, Error, TEXT("FAILED: Could not apply mesh to any skeletal mesh component"));
+        }
     }
 
     // Update camera offset based on character class
-    if (FirstPersonCamera)
+    if (FirstPersonCamera && EnumHasAnyFlags(Steps, ECharacterInitStep::Camera) && !BloodreadCosmetics::ShouldSkip(this))
     {
         FirstPersonCamera->SetRelativeLocation(ClassData.CameraOffset);
-        UE_LOG(LogTemp, Warning, TEXT("Updated camera offset to: %s"), *ClassData.CameraOffset.ToString());
     }
-
-    OnCharacterClassChanged();
-    UE_LOG(LogTemp, Warning, TEXT("Character initialized as: %s"), *ClassData.ClassName);
 }
 
 bool ABloodreadBaseCharacter::SetMeshOnComponent(USkeletalMeshComponent* MeshComponent, const FString& MeshPath)
 {
+    BLOODREAD_SCOPE(STAT_BloodreadAssetLoad);
+    BloodreadBoot::FAssetLoadScope BootAssetLoad;
     if (!MeshComponent)
     {
         UE_LOG(LogTemp, Error, TEXT("SetMeshOnComponent: MeshComponent is null"));
@@ -364,6 +572,7 @@ bool ABloodreadBaseCharacter::SetMeshOnComponent(USkeletalMeshComponent* MeshCom
     USkeletalMesh* LoadedMesh = nullptr;
 
     // Method 1: Direct asset loading using LoadObject
+    BloodreadTrace::AssetLoad(MeshPath);
     LoadedMesh = LoadObject<USkeletalMesh>(nullptr, *MeshPath);
     if (LoadedMesh)
     {
@@ -391,10 +600,17 @@ bool ABloodreadBaseCharacter::SetMeshOnComponent(USkeletalMeshComponent* MeshCom
     // Apply the mesh if we found one
     if (LoadedMesh)
     {
+        if (MeshComponent->GetSkeletalMeshAsset() == LoadedMesh)
+        {
+            // Already set; reassigning would reinitialise the pose and rebuild render state for nothing
+            return true;
+        }
+
+        // SetSkeletalMesh recreates the render state itself
         MeshComponent->SetSkeletalMesh(LoadedMesh);
-        
-        // Force refresh the component
-        MeshComponent->RecreateRenderState_Concurrent();
+
+        // Resolve head/hand/weapon/hit points once per mesh so possession and hit code never scan bones
+        FSkeletonBindingCache::Get().Resolve(LoadedMesh);
         
         // Log detailed mesh information
         UE_LOG(LogTemp, Warning, TEXT("SUCCESS: Applied mesh '%s' to component '%s'"), 
@@ -423,40 +639,23 @@ bool ABloodreadBaseCharacter::ApplyClassDataToMeshComponent(USkeletalMeshCompone
     UE_LOG(LogTemp, Warning, TEXT("ApplyClassDataToMeshComponent: Character=%s, RequestedClass=%d, CurrentClass=%d"), 
            *GetName(), (int32)CharacterClass, (int32)CurrentCharacterClass);
 
-    FString MeshPath;
-    FString ClassName;
+    if (CharacterClass == ECharacterClass::None)
+    {
+        UE_LOG(LogTemp, Error, TEXT("ApplyClassDataToMeshComponent: Character class is None - character not initialized properly"));
+        return false;
+    }
 
-    // Get the appropriate mesh path based on character class
-    switch (CharacterClass)
+    // Mesh path comes from the shared class registry
+    const FCharacterClassData& ClassData = FCharacterClassRegistry::Get().GetDefinition(CharacterClass);
+    if (!FCharacterClassRegistry::Get().IsRegistered(CharacterClass) || ClassData.CharacterMesh.IsNull())
     {
-        case ECharacterClass::Warrior:
-            MeshPath = "/Game/ParagonGideon/Characters/Heroes/Gideon/Meshes/Gideon.Gideon";
-            ClassName = "Warrior";
-            break;
-        case ECharacterClass::Mage:
-            MeshPath = "/Game/ParagonAurora/Characters/Heroes/Aurora/Meshes/Aurora.Aurora";
-            ClassName = "Mage";
-            break;
-        case ECharacterClass::Rogue:
-            MeshPath = "/Game/ParagonShinbi/Characters/Heroes/Shinbi/Skins/Tier_1/Shinbi_Dynasty/Meshes/ShinbiDynasty.ShinbiDynasty";
-            ClassName = "Rogue";
-            break;
-        case ECharacterClass::Healer:
-            MeshPath = "/Game/ParagonFey/Characters/Heroes/Fey/Meshes/Fey.Fey";
-            ClassName = "Healer";
-            break;
-        case ECharacterClass::Dragon:
-            MeshPath = "/Game/ParagonYin/Characters/Heroes/Yin/Meshes/Yin.Yin";
-            ClassName = "Dragon";
-            break;
-        case ECharacterClass::None:
-            UE_LOG(LogTemp, Error, TEXT("ApplyClassDataToMeshComponent: Character class is None - character not initialized properly"));
-            return false;
-        default:
-            UE_LOG(LogTemp, Error, TEXT("ApplyClassDataToMeshComponent: Unsupported character class: %d"), (int32)CharacterClass);
-            return false;
+        UE_LOG(LogTemp, Error, TEXT("ApplyClassDataToMeshComponent: Unsupported character class: %d"), (int32)CharacterClass);
+        return false;
     }
 
+    const FString MeshPath = ClassData.CharacterMesh.ToSoftObjectPath().ToString();
+    const FString& ClassName = ClassData.ClassName;
+
     UE_LOG(LogTemp, Warning, TEXT("ApplyClassDataToMeshComponent: Setting %s mesh (%s) on component %s"), 
            *ClassName, *MeshPath, *MeshComponent->GetName());
     return SetMeshOnComponent(MeshComponent, MeshPath);
@@ -464,6 +663,8 @@ bool ABloodreadBaseCharacter::ApplyClassDataToMeshComponent(USkeletalMeshCompone
 
 bool ABloodreadBaseCharacter::SetAnimationBlueprintOnComponent(USkeletalMeshComponent* MeshComponent, const FString& AnimBPPath)
 {
+    BLOODREAD_SCOPE(STAT_BloodreadAssetLoad);
+    BloodreadBoot::FAssetLoadScope BootAssetLoad;
     if (!MeshComponent)
     {
         UE_LOG(LogTemp, Error, TEXT("SetAnimationBlueprintOnComponent: MeshComponent is null"));
@@ -479,8 +680,15 @@ bool ABloodreadBaseCharacter::SetAnimationBlueprintOnComponent(USkeletalMeshComp
     UE_LOG(LogTemp, Warning, TEXT("SetAnimationBlueprintOnComponent: Attempting to load animation blueprint from path: %s"), *AnimBPPath);
 
     // Try to load the animation blueprint using LoadObject<UClass>
+    BloodreadTrace::AssetLoad(AnimBPPath);
     UClass* AnimBPClass = LoadObject<UClass>(nullptr, *AnimBPPath);
     
+    if (AnimBPClass && MeshComponent->GetAnimClass() == AnimBPClass && MeshComponent->GetAnimInstance())
+    {
+        // Already running this anim class; SetAnimInstanceClass would tear it down and rebuild it
+        return true;
+    }
+
     if (AnimBPClass)
     {
         // First, ensure the animation mode is set to use animation blueprint
@@ -513,34 +721,20 @@ bool ABloodreadBaseCharacter::SetAnimationBlueprintOnComponent(USkeletalMeshComp
 
 void ABloodreadBaseCharacter::ReactivateAnimationBlueprints()
 {
-    UE_LOG(LogTemp, Warning, TEXT("ReactivateAnimationBlueprints: Reactivating animation blueprints for %s"), *GetName());
-    
-    // Get all skeletal mesh components
-    TArray<USkeletalMeshComponent*> MeshComponents;
+    // Only components that lost their anim instance are rebuilt; a running instance is left alone
+    TArray<USkeletalMeshComponent*, TInlineAllocator<4>> MeshComponents;
     GetComponents<USkeletalMeshComponent>(MeshComponents);
-    
+
     for (USkeletalMeshComponent* MeshComp : MeshComponents)
     {
-        if (MeshComp && MeshComp->GetAnimClass())
+        if (MeshComp && MeshComp->GetAnimClass() && !MeshComp->GetAnimInstance())
         {
-            UE_LOG(LogTemp, Warning, TEXT("Reactivating animation blueprint on component: %s"), *MeshComp->GetName());
-            
-            // Store the current animation class
-            UClass* AnimClass = MeshComp->GetAnimClass();
-            
-            // Reset and reapply the animation blueprint
             MeshComp->SetAnimationMode(EAnimationMode::AnimationBlueprint);
-            MeshComp->SetAnimInstanceClass(AnimClass);
             MeshComp->InitializeAnimScriptInstance(true);
-            
-            // Verify it's working
-            if (UAnimInstance* AnimInstance = MeshComp->GetAnimInstance())
-            {
-                UE_LOG(LogTemp, Warning, TEXT("SUCCESS: Animation instance reactivated for %s"), *MeshComp->GetName());
-            }
-            else
+
+            if (!MeshComp->GetAnimInstance())
             {
-                UE_LOG(LogTemp, Error, TEXT("FAILED: Animation instance not created for %s"), *MeshComp->GetName());
+                UE_LOG(LogTemp, Error, TEXT("ReactivateAnimationBlueprints: Animation instance not created for %s"), *MeshComp->GetName());
             }
         }
     }
@@ -548,116 +742,83 @@ void ABloodreadBaseCharacter::ReactivateAnimationBlueprints()
 
 void ABloodreadBaseCharacter::ForceInitializeCharacterSystems()
 {
-    UE_LOG(LogTemp, Warning, TEXT("ForceInitializeCharacterSystems: Starting initialization for %s (Class: %s), CurrentClass=%d"), 
-           *GetName(), *GetClass()->GetName(), (int32)CurrentCharacterClass);
+    InitializeFromClass(ResolveNativeCharacterClass());
+}
 
-    // Debug: Show the actual class hierarchy
-    UClass* CurrentClass = GetClass();
-    while (CurrentClass)
+ECharacterClass ABloodreadBaseCharacter::ResolveNativeCharacterClass() const
+{
+    // The native subclass decides the class, whatever CurrentCharacterClass was defaulted to
+    if (IsA<ABloodreadWarriorCharacter>())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Class hierarchy: %s"), *CurrentClass->GetName());
-        CurrentClass = CurrentClass->GetSuperClass();
-        if (CurrentClass == ABloodreadBaseCharacter::StaticClass() || CurrentClass == ACharacter::StaticClass())
-        {
-            break;
-        }
+        return ECharacterClass::Warrior;
+    }
+    if (IsA<ABloodreadMageCharacter>())
+    {
+        return ECharacterClass::Mage;
+    }
+    if (IsA<ABloodreadRogueCharacter>())
+    {
+        return ECharacterClass::Rogue;
+    }
+    if (IsA<ABloodreadHealerCharacter>())
+    {
+        return ECharacterClass::Healer;
+    }
+    if (IsA<ABloodreadDragonCharacter>())
+    {
+        return ECharacterClass::Dragon;
     }
 
-    // Force character-specific initialization based on actual class type, not CurrentCharacterClass
-    if (ABloodreadWarriorCharacter* WarriorChar = Cast<ABloodreadWarriorCharacter>(this))
+    // Blueprint classes that don't derive from a class character: infer from the class name
+    const FString ClassName = GetClass()->GetName();
+    if (ClassName.Contains(TEXT("Warrior")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("✅ Detected WarriorCharacter - calling InitializeWarriorData"));
-        WarriorChar->InitializeWarriorData();
-        CurrentCharacterClass = ECharacterClass::Warrior;
+        return ECharacterClass::Warrior;
     }
-    else if (ABloodreadMageCharacter* MageChar = Cast<ABloodreadMageCharacter>(this))
+    if (ClassName.Contains(TEXT("Mage")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("✅ Detected MageCharacter - calling InitializeMageData"));
-        MageChar->InitializeMageData();
-        CurrentCharacterClass = ECharacterClass::Mage;
+        return ECharacterClass::Mage;
     }
-    else if (ABloodreadRogueCharacter* RogueChar = Cast<ABloodreadRogueCharacter>(this))
+    if (ClassName.Contains(TEXT("Rogue")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("✅ Detected RogueCharacter - calling InitializeRogueData"));
-        RogueChar->InitializeRogueData();
-        CurrentCharacterClass = ECharacterClass::Rogue;
+        return ECharacterClass::Rogue;
     }
-    else if (ABloodreadHealerCharacter* HealerChar = Cast<ABloodreadHealerCharacter>(this))
+    if (ClassName.Contains(TEXT("Healer")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("✅ Detected HealerCharacter - calling InitializeHealerData"));
-        HealerChar->InitializeHealerData();
-        CurrentCharacterClass = ECharacterClass::Healer;
+        return ECharacterClass::Healer;
     }
-    else if (ABloodreadDragonCharacter* DragonChar = Cast<ABloodreadDragonCharacter>(this))
+    if (ClassName.Contains(TEXT("Dragon")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("✅ Detected DragonCharacter - calling InitializeDragonData"));
-        DragonChar->InitializeDragonData();
-        CurrentCharacterClass = ECharacterClass::Dragon;
+        return ECharacterClass::Dragon;
     }
-    else
+
+    if (CurrentCharacterClass != ECharacterClass::None)
     {
-        // If we can't cast to specific types, try to infer from the class name
-        FString ClassName = GetClass()->GetName();
-        UE_LOG(LogTemp, Warning, TEXT("❌ Direct cast failed, trying name-based detection for class: %s"), *ClassName);
-        
-        if (ClassName.Contains(TEXT("Warrior")))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("🔧 Detected Warrior by name - setting class manually"));
-            CurrentCharacterClass = ECharacterClass::Warrior;
-            // Manually initialize warrior data since we can't cast
-            InitializeWarriorDataManually();
-        }
-        else if (ClassName.Contains(TEXT("Mage")))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("🔧 Detected Mage by name - setting class manually"));
-            CurrentCharacterClass = ECharacterClass::Mage;
-            // Manually initialize mage data since we can't cast
-            InitializeMageDataManually();
-        }
-        else if (ClassName.Contains(TEXT("Rogue")))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("🔧 Detected Rogue by name - setting class manually"));
-            CurrentCharacterClass = ECharacterClass::Rogue;
-            // Manually initialize rogue data since we can't cast
-            InitializeRogueDataManually();
-        }
-        else if (ClassName.Contains(TEXT("Healer")))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("🔧 Detected Healer by name - setting class manually"));
-            CurrentCharacterClass = ECharacterClass::Healer;
-            // Manually initialize healer data since we can't cast
-            InitializeHealerDataManually();
-        }
-        else if (ClassName.Contains(TEXT("Dragon")))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("🔧 Detected Dragon by name - setting class manually"));
-            CurrentCharacterClass = ECharacterClass::Dragon;
-            // Manually initialize dragon data since we can't cast
-            InitializeDragonDataManually();
-        }
-        else if (ClassName.Contains(TEXT("BloodreadBaseCharacter")) || ClassName.Contains(TEXT("BloodreadBase")) || ClassName == TEXT("BloodreadBaseCharacter_C"))
-        {
-            // This is a base character spawned directly - default to Warrior for now
-            UE_LOG(LogTemp, Warning, TEXT("🔧 Detected BloodreadBaseCharacter - defaulting to Warrior class"));
-            CurrentCharacterClass = ECharacterClass::Warrior;
-            InitializeWarriorDataManually();
-        }
-        else
-        {
-            UE_LOG(LogTemp, Error, TEXT("❌ Unknown character type - cannot determine class from name: %s"), *ClassName);
-            UE_LOG(LogTemp, Warning, TEXT("Defaulting to Warrior as fallback"));
-            CurrentCharacterClass = ECharacterClass::Warrior;
-            InitializeWarriorDataManually();
-        }
+        return CurrentCharacterClass;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("ForceInitializeCharacterSystems: Character class set to %d, proceeding with mesh application"), 
-           (int32)CurrentCharacterClass);
+    UE_LOG(LogTemp, Warning, TEXT("ResolveNativeCharacterClass: No class for %s, defaulting to Warrior"), *ClassName);
+    return ECharacterClass::Warrior;
+}
 
-    // Now that the character class is properly set, re-initialize from class data
-    InitializeFromClassData(CharacterClassData);
+FName ABloodreadBaseCharacter::GetSkeletonPointName(EBloodreadSkeletonPoint Point) const
+{
+    const USkeletalMeshComponent* MeshComp = GetMesh();
+    if (!MeshComp)
+    {
+        return NAME_None;
+    }
+    return FSkeletonBindingCache::Get().Resolve(MeshComp->GetSkeletalMeshAsset()).GetName(Point);
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("ForceInitializeCharacterSystems: Character systems initialization complete"));
+FVector ABloodreadBaseCharacter::GetSkeletonPointLocation(EBloodreadSkeletonPoint Point) const
+{
+    const FName PointName = GetSkeletonPointName(Point);
+    if (PointName == NAME_None)
+    {
+        return GetActorLocation();
+    }
+    return GetMesh()->GetSocketLocation(PointName);
 }
 
 void ABloodreadBaseCharacter::TestAllMeshPaths()
@@ -715,269 +876,18 @@ void ABloodreadBaseCharacter::TestAllMeshPaths()
     UE_LOG(LogTemp, Warning, TEXT("=== MESH PATH TESTING COMPLETE ==="));
 }
 
-void ABloodreadBaseCharacter::InitializeWarriorDataManually()
-{
-    UE_LOG(LogTemp, Warning, TEXT("InitializeWarriorDataManually: Setting up warrior data"));
-    
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Warrior;
-    
-    // Initialize warrior stats
-    FCharacterStats WarriorStats;
-    WarriorStats.MaxHealth = 150;  // High health
-    WarriorStats.Strength = 18;    // High strength
-    WarriorStats.Defense = 12;     // High defense
-    WarriorStats.Speed = 8;        // Lower speed
-    WarriorStats.Mana = 30;        // Low mana
-    WarriorStats.CriticalChance = 0.15f;
-    
-    // Initialize warrior abilities
-    FCharacterAbilityData PowerStrikeAbility;
-    PowerStrikeAbility.Name = "Power Strike";
-    PowerStrikeAbility.Description = "A devastating melee attack that deals massive damage and knockback";
-    PowerStrikeAbility.Type = EAbilityType::Damage;
-    PowerStrikeAbility.Cooldown = 8.0f;
-    PowerStrikeAbility.ManaCost = 15;
-    PowerStrikeAbility.Damage = 60.0f;
-    PowerStrikeAbility.Duration = 0.0f;
-    
-    FCharacterAbilityData ChargeAbility;
-    ChargeAbility.Name = "Charge Attack";
-    ChargeAbility.Description = "Rush forward, dealing damage to all enemies in your path";
-    ChargeAbility.Type = EAbilityType::Movement;
-    ChargeAbility.Cooldown = 12.0f;
-    ChargeAbility.ManaCost = 20;
-    ChargeAbility.Damage = 40.0f;
-    ChargeAbility.Duration = 1.0f;
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Warrior;
-    CharacterClassData.ClassName = "Warrior";
-    CharacterClassData.Description = "A mighty melee fighter with high health and devastating close-combat abilities";
-    CharacterClassData.BaseStats = WarriorStats;
-    CharacterClassData.Ability1 = PowerStrikeAbility;
-    CharacterClassData.Ability2 = ChargeAbility;
-    
-    // Apply stats
-    CurrentStats = WarriorStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
-    
-    UE_LOG(LogTemp, Warning, TEXT("InitializeWarriorDataManually: Warrior data setup complete"));
-}
-
-void ABloodreadBaseCharacter::InitializeMageDataManually()
-{
-    UE_LOG(LogTemp, Warning, TEXT("InitializeMageDataManually: Setting up mage data"));
-    
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Mage;
-    
-    // Initialize mage stats
-    FCharacterStats MageStats;
-    MageStats.MaxHealth = 80;      // Lower health
-    MageStats.Strength = 8;        // Low strength
-    MageStats.Defense = 6;         // Low defense
-    MageStats.Speed = 12;          // Higher speed
-    MageStats.Mana = 80;           // High mana
-    MageStats.CriticalChance = 0.25f; // Higher crit chance
-    
-    // Initialize mage abilities
-    FCharacterAbilityData FireballAbility;
-    FireballAbility.Name = "Fireball";
-    FireballAbility.Description = "Launch a fiery projectile that explodes on impact";
-    FireballAbility.Type = EAbilityType::Damage;
-    FireballAbility.Cooldown = 5.0f;
-    FireballAbility.ManaCost = 25;
-    FireballAbility.Damage = 45.0f;
-    FireballAbility.Duration = 0.0f;
-    
-    FCharacterAbilityData TeleportAbility;
-    TeleportAbility.Name = "Teleport";
-    TeleportAbility.Description = "Instantly teleport to a target location";
-    TeleportAbility.Type = EAbilityType::Movement;
-    TeleportAbility.Cooldown = 8.0f;
-    TeleportAbility.ManaCost = 30;
-    TeleportAbility.Damage = 0.0f;
-    TeleportAbility.Duration = 0.0f;
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Mage;
-    CharacterClassData.ClassName = "Mage";
-    CharacterClassData.Description = "A powerful spellcaster with high magical damage and mobility";
-    CharacterClassData.BaseStats = MageStats;
-    CharacterClassData.Ability1 = FireballAbility;
-    CharacterClassData.Ability2 = TeleportAbility;
-    
-    // Apply stats
-    CurrentStats = MageStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
-    
-    UE_LOG(LogTemp, Warning, TEXT("InitializeMageDataManually: Mage data setup complete"));
-}
-
-void ABloodreadBaseCharacter::InitializeRogueDataManually()
-{
-    UE_LOG(LogTemp, Warning, TEXT("InitializeRogueDataManually: Setting up rogue data"));
-    
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Rogue;
-    
-    // Initialize rogue stats
-    FCharacterStats RogueStats;
-    RogueStats.MaxHealth = 100;    // Medium health
-    RogueStats.Strength = 14;      // Good strength
-    RogueStats.Defense = 8;        // Medium defense
-    RogueStats.Speed = 16;         // High speed
-    RogueStats.Mana = 50;          // Medium mana
-    RogueStats.CriticalChance = 0.35f; // Highest crit chance
-    
-    // Initialize rogue abilities
-    FCharacterAbilityData ShadowStrikeAbility;
-    ShadowStrikeAbility.Name = "Shadow Strike";
-    ShadowStrikeAbility.Description = "A quick strike from the shadows with increased critical chance";
-    ShadowStrikeAbility.Type = EAbilityType::Damage;
-    ShadowStrikeAbility.Cooldown = 6.0f;
-    ShadowStrikeAbility.ManaCost = 20;
-    ShadowStrikeAbility.Damage = 50.0f;
-    ShadowStrikeAbility.Duration = 0.0f;
-    
-    FCharacterAbilityData StealthAbility;
-    StealthAbility.Name = "Stealth";
-    StealthAbility.Description = "Become invisible for a short duration, increasing damage and movement speed";
-    StealthAbility.Type = EAbilityType::Buff;
-    StealthAbility.Cooldown = 15.0f;
-    StealthAbility.ManaCost = 25;
-    StealthAbility.Damage = 0.0f;
-    StealthAbility.Duration = 5.0f;
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Rogue;
-    CharacterClassData.ClassName = "Rogue";
-    CharacterClassData.Description = "A swift assassin with high critical chance and stealth abilities";
-    CharacterClassData.BaseStats = RogueStats;
-    CharacterClassData.Ability1 = ShadowStrikeAbility;
-    CharacterClassData.Ability2 = StealthAbility;
-    
-    // Apply stats
-    CurrentStats = RogueStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
-    
-    UE_LOG(LogTemp, Warning, TEXT("InitializeRogueDataManually: Rogue data setup complete"));
-}
-
-void ABloodreadBaseCharacter::InitializeHealerDataManually()
-{
-    UE_LOG(LogTemp, Warning, TEXT("InitializeHealerDataManually: Setting up healer data"));
-    
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Healer;
-    
-    // Initialize healer stats
-    FCharacterStats HealerStats;
-    HealerStats.MaxHealth = 120;    // Good health
-    HealerStats.Strength = 6;       // Low strength
-    HealerStats.Defense = 8;        // Medium defense
-    HealerStats.Speed = 10;         // Medium speed
-    HealerStats.Mana = 100;         // High mana
-    HealerStats.CriticalChance = 0.1f; // Low crit chance
-    
-    // Initialize healer abilities
-    FCharacterAbilityData BondAbility;
-    BondAbility.Name = "Bond";
-    BondAbility.Description = "Heal a teammate for 50% of their missing health";
-    BondAbility.Type = EAbilityType::Heal;
-    BondAbility.Cooldown = 30.0f;
-    BondAbility.ManaCost = 100;
-    BondAbility.Damage = 0.0f;
-    BondAbility.Duration = 0.0f;
-    
-    FCharacterAbilityData RegenerationAbility;
-    RegenerationAbility.Name = "Regeneration";
-    RegenerationAbility.Description = "Grant team-wide health regeneration for a duration";
-    RegenerationAbility.Type = EAbilityType::Heal;
-    RegenerationAbility.Cooldown = 15.0f;
-    RegenerationAbility.ManaCost = 50;
-    RegenerationAbility.Damage = 0.0f;
-    RegenerationAbility.Duration = 10.0f;
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Healer;
-    CharacterClassData.ClassName = "Healer";
-    CharacterClassData.Description = "A support character specializing in healing and team regeneration";
-    CharacterClassData.BaseStats = HealerStats;
-    CharacterClassData.Ability1 = BondAbility;
-    CharacterClassData.Ability2 = RegenerationAbility;
-    
-    // Apply stats
-    CurrentStats = HealerStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
-    
-    UE_LOG(LogTemp, Warning, TEXT("InitializeHealerDataManually: Healer data setup complete"));
-}
-
-void ABloodreadBaseCharacter::InitializeDragonDataManually()
-{
-    UE_LOG(LogTemp, Warning, TEXT("InitializeDragonDataManually: Setting up dragon data"));
-    
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Dragon;
-    
-    // Initialize dragon stats
-    FCharacterStats DragonStats;
-    DragonStats.MaxHealth = 100;    // Medium health
-    DragonStats.Strength = 6;       // Base strength (scalable)
-    DragonStats.Defense = 6;        // Medium defense
-    DragonStats.Speed = 12;         // Good speed
-    DragonStats.Mana = 80;          // Good mana
-    DragonStats.CriticalChance = 0.15f; // Medium crit chance
-    
-    // Initialize dragon abilities
-    FCharacterAbilityData AscentAbility;
-    AscentAbility.Name = "Ascent";
-    AscentAbility.Description = "Two-part leap attack - first press to leap up, second to blitz down with damage";
-    AscentAbility.Type = EAbilityType::Movement;
-    AscentAbility.Cooldown = 30.0f;
-    AscentAbility.ManaCost = 100;
-    AscentAbility.Damage = 50.0f;
-    AscentAbility.Duration = 0.0f;
-    
-    FCharacterAbilityData KingsGreedAbility;
-    KingsGreedAbility.Name = "Kings Greed";
-    KingsGreedAbility.Description = "Gain movement speed and damage scaling based on successful hits";
-    KingsGreedAbility.Type = EAbilityType::Buff;
-    KingsGreedAbility.Cooldown = 30.0f;
-    KingsGreedAbility.ManaCost = 50;
-    KingsGreedAbility.Damage = 0.0f;
-    KingsGreedAbility.Duration = 15.0f;
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Dragon;
-    CharacterClassData.ClassName = "Dragon";
-    CharacterClassData.Description = "A powerful aerial combatant with leap attacks and scalable damage abilities";
-    CharacterClassData.BaseStats = DragonStats;
-    CharacterClassData.Ability1 = AscentAbility;
-    CharacterClassData.Ability2 = KingsGreedAbility;
-    
-    // Apply stats
-    CurrentStats = DragonStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
-    
-    UE_LOG(LogTemp, Warning, TEXT("InitializeDragonDataManually: Dragon data setup complete"));
-}
-
-// Health system helper functions
 void ABloodreadBaseCharacter::DealDamage(float DamageAmount)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadDamage);
     UE_LOG(LogTemp, Warning, TEXT("*** WARNING: DealDamage called directly - no knockback applied! Consider using TakeCustomDamage instead ***"));
     
     int32 OldHealth = CurrentHealth;
     int32 IntDamage = FMath::RoundToInt(DamageAmount);
     CurrentHealth = FMath::Max(0, CurrentHealth - IntDamage);
+    UMatchRecorderSubsystem::RecordDamage(this, nullptr, OldHealth - CurrentHealth, CurrentHealth);
+    BloodreadTrace::Damage(this, nullptr, OldHealth - CurrentHealth);
+    UMatchTelemetrySubsystem::NoteDamage(this);
+    RefreshTeamMembership();
     
     OnHealthChanged(OldHealth, CurrentHealth);
     
@@ -989,7 +899,10 @@ void ABloodreadBaseCharacter::DealDamage(float DamageAmount)
     else
     {
         // Flash red on damage
-        FlashRed();
+        if (!BloodreadCosmetics::ShouldSkip(this))
+        {
+            FlashRed();
+        }
     }
     
     UE_LOG(LogTemp, Warning, TEXT("Character took %.1f damage. Health: %d/%d"), DamageAmount, CurrentHealth, CurrentStats.MaxHealth);
@@ -1000,6 +913,7 @@ void ABloodreadBaseCharacter::HealCharacter(float HealAmount)
     int32 OldHealth = CurrentHealth;
     int32 IntHeal = FMath::RoundToInt(HealAmount);
     CurrentHealth = FMath::Min(CurrentStats.MaxHealth, CurrentHealth + IntHeal);
+    RefreshTeamMembership();
     
     OnHealthChanged(OldHealth, CurrentHealth);
     
@@ -1012,6 +926,7 @@ void ABloodreadBaseCharacter::HealCharacter(float HealAmount)
 // Combined damage and knockback function - USE THIS for attacks with knockback
 void ABloodreadBaseCharacter::DealDamageWithKnockback(float DamageAmount, FVector KnockbackDirection, float KnockbackForce, ABloodreadBaseCharacter* Attacker)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadDamage);
     UE_LOG(LogTemp, Error, TEXT("🚨 DealDamageWithKnockback called on %s - Damage: %.1f, Knockback: %.1f, Attacker: %s"), 
            *GetName(), DamageAmount, KnockbackForce, Attacker ? *Attacker->GetName() : TEXT("None"));
     UE_LOG(LogTemp, Error, TEXT("🚨 Target character class: %s"), *GetClass()->GetName());
@@ -1070,14 +985,19 @@ float ABloodreadBaseCharacter::GetManaPercentage() const
 
 void ABloodreadBaseCharacter::UseAbility1()
 {
+    LLM_SCOPE_BYTAG(Bloodread_Abilities);
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     if (CanUseAbility1())
     {
-        if (UseMana(CharacterClassData.Ability1.ManaCost))
+        const FCharacterAbilityData& Ability = GetClassDefinition().Ability1;
+        if (UseMana(Ability.ManaCost))
         {
-            CharacterClassData.Ability1.CooldownRemaining = CharacterClassData.Ability1.Cooldown;
+            Ability1State.CooldownRemaining = Ability.Cooldown;
             PlayAbility1Animation(); // Play animation first
+            BloodreadTrace::AbilityCast(this, 1);
+            UMatchTelemetrySubsystem::NoteAbilityCast(this);
             OnAbility1Used();
-            UE_LOG(LogTemp, Warning, TEXT("Used Ability 1: %s"), *CharacterClassData.Ability1.Name);
+            UE_LOG(LogTemp, Warning, TEXT("Used Ability 1: %s"), *Ability.Name);
         }
         else
         {
@@ -1086,44 +1006,220 @@ void ABloodreadBaseCharacter::UseAbility1()
     }
 }
 
-void ABloodreadBaseCharacter::UseAbility2()
+void ABloodreadBaseCharacter::UseAbility2()
+{
+    LLM_SCOPE_BYTAG(Bloodread_Abilities);
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
+    if (CanUseAbility2())
+    {
+        const FCharacterAbilityData& Ability = GetClassDefinition().Ability2;
+        if (UseMana(Ability.ManaCost))
+        {
+            Ability2State.CooldownRemaining = Ability.Cooldown;
+            PlayAbility2Animation(); // Play animation first
+            BloodreadTrace::AbilityCast(this, 2);
+            UMatchTelemetrySubsystem::NoteAbilityCast(this);
+            OnAbility2Used();
+            UE_LOG(LogTemp, Warning, TEXT("Used Ability 2: %s"), *Ability.Name);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Not enough mana for Ability 2"));
+        }
+    }
+}
+
+void ABloodreadBaseCharacter::QueueCombatInput(ECharacterAnimAction Action)
+{
+    if (Action != ECharacterAnimAction::BasicAttack && Action != ECharacterAnimAction::Ability1 && Action != ECharacterAnimAction::Ability2)
+    {
+        return;
+    }
+
+    const double Now = GetCombatClock();
+    CombatInputBuffer.Push(Action, Now, Now + InputBufferWindow);
+    ProcessCombatInputBuffer();
+}
+
+bool ABloodreadBaseCharacter::Server_QueueCombatInput_Validate(ECharacterAnimAction Action, float PressServerTime)
+{
+    return (Action == ECharacterAnimAction::BasicAttack || Action == ECharacterAnimAction::Ability1 || Action == ECharacterAnimAction::Ability2)
+        && FMath::IsFinite(PressServerTime);
+}
+
+void ABloodreadBaseCharacter::Server_QueueCombatInput_Implementation(ECharacterAnimAction Action, float PressServerTime)
+{
+    if (!URpcRateLimitSubsystem::Allow(this, Action == ECharacterAnimAction::BasicAttack ? ECombatRpc::BasicAttack : ECombatRpc::UseAbility))
+    {
+        SyncPredictedCooldown(Action);
+        return;
+    }
+
+    // Stale presses (long stalls, or a client replaying old input) are dropped rather than fired late, and a press
+    // can't claim to be from the future
+    const double Now = GetCombatClock();
+    const double PressTime = FMath::Min(static_cast<double>(PressServerTime), Now);
+    const double Age = Now - PressTime;
+    if (Age > MaxInputLatencyCompensation + InputBufferWindow)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("Server_QueueCombatInput: Dropped %.3fs old press from %s"), Age, *GetName());
+        SyncPredictedCooldown(Action);
+        return;
+    }
+
+    // Presses that arrive just before the server's cooldown ends wait in the server's own buffer
+    CombatInputBuffer.Push(Action, PressTime, Now + InputBufferWindow);
+    ProcessCombatInputBuffer();
+}
+
+void ABloodreadBaseCharacter::ProcessCombatInputBuffer()
+{
+    CombatInputBuffer.Process(GetCombatClock(),
+        [this](ECharacterAnimAction Action) { return CanFireCombatInput(Action); },
+        [this](const FBufferedCombatInput& Input) { FireCombatInput(Input); },
+        [this](const FBufferedCombatInput& Input) { SyncPredictedCooldown(Input.Action); });
+}
+
+bool ABloodreadBaseCharacter::IsReadyForCombatInput() const
+{
+    return GetIsAlive() && CombatInputBuffer.IsEmpty() && GetCombatClock() >= ActionLockedUntil;
+}
+
+bool ABloodreadBaseCharacter::CanFireCombatInput(ECharacterAnimAction Action) const
+{
+    if (!GetIsAlive())
+    {
+        return false;
+    }
+
+    // The owning client paces its own actions; the server only enforces cooldown, mana and the RPC rate limit
+    const bool bRemoteOnServer = HasAuthority() && !IsLocallyControlled();
+    if (!bRemoteOnServer && GetCombatClock() < ActionLockedUntil)
+    {
+        return false;
+    }
+
+    switch (Action)
+    {
+        case ECharacterAnimAction::BasicAttack: return true;
+        case ECharacterAnimAction::Ability1:    return CanFireAbility1();
+        case ECharacterAnimAction::Ability2:    return CanFireAbility2();
+        default:                                return false;
+    }
+}
+
+void ABloodreadBaseCharacter::FireCombatInput(const FBufferedCombatInput& Input)
+{
+    LLM_SCOPE_BYTAG(Bloodread_Abilities);
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
+    ActionLockedUntil = GetCombatClock() + ActionRecoveryTime;
+
+    // An owning client only plays the action; damage, knockback, mana and ability movement all come from the
+    // server running the forwarded press
+    if (!HasAuthority())
+    {
+        PlayCombatInputCosmetics(Input.Action);
+        if (IsLocallyControlled())
+        {
+            Server_QueueCombatInput(Input.Action, static_cast<float>(Input.PressTime));
+        }
+        return;
+    }
+
+    switch (Input.Action)
+    {
+        case ECharacterAnimAction::BasicAttack: Attack(); break;
+        case ECharacterAnimAction::Ability1:    UseAbility1(); break;
+        case ECharacterAnimAction::Ability2:    UseAbility2(); break;
+        default: break;
+    }
+
+    // Covers refusals inside the ability too (mana, failed teleport refunds)
+    SyncPredictedCooldown(Input.Action);
+}
+
+void ABloodreadBaseCharacter::SyncPredictedCooldown(ECharacterAnimAction Action)
+{
+    if (!HasAuthority() || IsLocallyControlled())
+    {
+        return;
+    }
+
+    switch (Action)
+    {
+        case ECharacterAnimAction::Ability1: Client_SyncAbilityCooldown(Action, Ability1State.CooldownRemaining); break;
+        case ECharacterAnimAction::Ability2: Client_SyncAbilityCooldown(Action, Ability2State.CooldownRemaining); break;
+        default: break;
+    }
+}
+
+void ABloodreadBaseCharacter::Client_SyncAbilityCooldown_Implementation(ECharacterAnimAction Action, float CooldownRemaining)
+{
+    // Arrives half a round trip late, which only makes the local cooldown end slightly after the server's
+    switch (Action)
+    {
+        case ECharacterAnimAction::Ability1: Ability1State.CooldownRemaining = CooldownRemaining; break;
+        case ECharacterAnimAction::Ability2: Ability2State.CooldownRemaining = CooldownRemaining; break;
+        default: break;
+    }
+}
+
+void ABloodreadBaseCharacter::PlayCombatInputCosmetics(ECharacterAnimAction Action)
+{
+    switch (Action)
+    {
+        case ECharacterAnimAction::BasicAttack:
+            PlayBasicAttackAnimation();
+            OnBasicAttack();
+            break;
+        case ECharacterAnimAction::Ability1:
+            // Predicting the cooldown keeps the local buffer from firing presses the server will refuse; the server
+            // corrects it through Client_SyncAbilityCooldown once the press is resolved.
+            // A follow-up press (Dragon's Blitz Down) fires during the cooldown and must not restart it.
+            if (Ability1State.CooldownRemaining <= 0.0f)
+            {
+                Ability1State.CooldownRemaining = GetClassDefinition().Ability1.Cooldown;
+            }
+            PlayAbility1Animation();
+            break;
+        case ECharacterAnimAction::Ability2:
+            Ability2State.CooldownRemaining = GetClassDefinition().Ability2.Cooldown;
+            PlayAbility2Animation();
+            break;
+        default:
+            break;
+    }
+}
+
+double ABloodreadBaseCharacter::GetCombatClock() const
 {
-    if (CanUseAbility2())
-    {
-        if (UseMana(CharacterClassData.Ability2.ManaCost))
-        {
-            CharacterClassData.Ability2.CooldownRemaining = CharacterClassData.Ability2.Cooldown;
-            PlayAbility2Animation(); // Play animation first
-            OnAbility2Used();
-            UE_LOG(LogTemp, Warning, TEXT("Used Ability 2: %s"), *CharacterClassData.Ability2.Name);
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Not enough mana for Ability 2"));
-        }
-    }
+    const UWorld* World = GetWorld();
+    const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+    return GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0);
 }
 
 bool ABloodreadBaseCharacter::CanUseAbility1() const
 {
-    return CharacterClassData.Ability1.CooldownRemaining <= 0.0f && CurrentMana >= CharacterClassData.Ability1.ManaCost;
+    return FCombatRules::CanActivateAbility(Ability1State.CooldownRemaining, CurrentMana, GetClassDefinition().Ability1.ManaCost);
 }
 
 bool ABloodreadBaseCharacter::CanUseAbility2() const
 {
-    return CharacterClassData.Ability2.CooldownRemaining <= 0.0f && CurrentMana >= CharacterClassData.Ability2.ManaCost;
+    return FCombatRules::CanActivateAbility(Ability2State.CooldownRemaining, CurrentMana, GetClassDefinition().Ability2.ManaCost);
 }
 
 float ABloodreadBaseCharacter::GetAbility1CooldownPercentage() const
 {
-    if (CharacterClassData.Ability1.Cooldown <= 0.0f) return 0.0f;
-    return FMath::Clamp(CharacterClassData.Ability1.CooldownRemaining / CharacterClassData.Ability1.Cooldown, 0.0f, 1.0f);
+    const float Cooldown = GetClassDefinition().Ability1.Cooldown;
+    if (Cooldown <= 0.0f) return 0.0f;
+    return FMath::Clamp(Ability1State.CooldownRemaining / Cooldown, 0.0f, 1.0f);
 }
 
 float ABloodreadBaseCharacter::GetAbility2CooldownPercentage() const
 {
-    if (CharacterClassData.Ability2.Cooldown <= 0.0f) return 0.0f;
-    return FMath::Clamp(CharacterClassData.Ability2.CooldownRemaining / CharacterClassData.Ability2.Cooldown, 0.0f, 1.0f);
+    const float Cooldown = GetClassDefinition().Ability2.Cooldown;
+    if (Cooldown <= 0.0f) return 0.0f;
+    return FMath::Clamp(Ability2State.CooldownRemaining / Cooldown, 0.0f, 1.0f);
 }
 
 void ABloodreadBaseCharacter::SetCameraPosition(FVector NewRelativeLocation)
@@ -1187,6 +1283,7 @@ void ABloodreadBaseCharacter::Attack()
 
 APracticeDummy* ABloodreadBaseCharacter::GetCrosshairTarget()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadTargeting);
     // Get camera location and forward direction
     FVector CameraLocation;
     FRotator CameraRotation;
@@ -1226,6 +1323,7 @@ APracticeDummy* ABloodreadBaseCharacter::GetCrosshairTarget()
 
 FTargetableActor ABloodreadBaseCharacter::GetCrosshairTargetActor()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadTargeting);
     // Get camera location and forward direction
     FVector CameraLocation;
     FRotator CameraRotation;
@@ -1361,6 +1459,7 @@ FTargetableActor ABloodreadBaseCharacter::GetCrosshairTargetActor()
 
 void ABloodreadBaseCharacter::AttackTarget()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadDamage);
     if (!GetIsAlive()) return;
 
     UE_LOG(LogTemp, Warning, TEXT("AttackTarget called - using universal crosshair targeting"));
@@ -1385,11 +1484,10 @@ void ABloodreadBaseCharacter::AttackTarget()
     UE_LOG(LogTemp, Warning, TEXT("AttackTarget: Attacking target at distance %.1f"), Distance);
     
     // Calculate damage with strength bonus
-    int32 TotalDamage = BasicAttackDamage + CurrentStats.Strength;
+    int32 TotalDamage = FCombatRules::BasicAttackDamage(BasicAttackDamage, CurrentStats.Strength);
     
     // Calculate knockback direction
-    FVector KnockbackDirection = (Target.Actor->GetActorLocation() - GetActorLocation()).GetSafeNormal();
-    KnockbackDirection.Z = 0.2f; // Add slight upward force
+    FVector KnockbackDirection = FCombatRules::BasicAttackKnockbackDirection(GetActorLocation(), Target.Actor->GetActorLocation());
 
     if (Target.bIsDummy)
     {
@@ -1411,18 +1509,8 @@ void ABloodreadBaseCharacter::AttackTarget()
             // Apply damage to player
             TargetPlayer->TakeCustomDamage(TotalDamage, this);
             
-            // Apply knockback through the attacking player's Server RPC (proper ownership)
-            if (GetNetMode() != NM_Standalone && !HasAuthority())
-            {
-                UE_LOG(LogTemp, Warning, TEXT("Client requesting knockback via ServerApplyKnockbackToTarget"));
-                ServerApplyKnockbackToTarget(TargetPlayer, KnockbackDirection, BasicAttackKnockbackForce);
-            }
-            else
-            {
-                // Server or standalone - apply directly
-                UE_LOG(LogTemp, Warning, TEXT("Server/Standalone applying knockback directly"));
-                TargetPlayer->ApplyKnockback(KnockbackDirection, BasicAttackKnockbackForce);
-            }
+            // Attacks only resolve with authority (see FireCombatInput), so the knockback is applied directly
+            TargetPlayer->ApplyKnockback(KnockbackDirection, BasicAttackKnockbackForce);
             
             UE_LOG(LogTemp, Log, TEXT("Character dealt %d damage to player character %s"), TotalDamage, *TargetPlayer->GetName());
         }
@@ -1444,6 +1532,7 @@ void ABloodreadBaseCharacter::AttackTarget()
 
 void ABloodreadBaseCharacter::ApplyKnockback(FVector KnockbackDirection, float Force)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadKnockback);
     if (!GetIsAlive()) 
     {
         UE_LOG(LogTemp, Warning, TEXT("Knockback: Character is not alive, ignoring knockback"));
@@ -1465,14 +1554,14 @@ void ABloodreadBaseCharacter::ApplyKnockback(FVector KnockbackDirection, float F
     // If we have authority (server or standalone), apply knockback and replicate
     if (HasAuthority())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Knockback: Server applying knockback and multicasting"));
-        // Apply locally first
+        UE_LOG(LogTemp, Warning, TEXT("Knockback: Server applying knockback"));
         ApplyKnockbackInternal(KnockbackDirection, Force);
         
-        // Then replicate to all clients
-        if (GetNetMode() != NM_Standalone)
+        // Simulated proxies receive the root motion source with replicated movement; only a remote owner
+        // needs telling so it can predict the curve instead of waiting for a correction
+        if (GetNetMode() != NM_Standalone && !IsLocallyControlled() && Cast<APlayerController>(GetController()))
         {
-            MulticastApplyKnockback(KnockbackDirection, Force);
+            ClientApplyKnockback(KnockbackDirection.GetSafeNormal(), Force);
         }
     }
     else
@@ -1483,158 +1572,107 @@ void ABloodreadBaseCharacter::ApplyKnockback(FVector KnockbackDirection, float F
     }
 }
 
+bool ABloodreadBaseCharacter::ServerApplyKnockback_Validate(FVector KnockbackDirection, float Force)
+{
+    return !KnockbackDirection.ContainsNaN() && FMath::IsFinite(Force)
+        && Force >= 0.0f && Force <= URpcRateLimitSubsystem::GetMaxKnockbackForce(this);
+}
+
 void ABloodreadBaseCharacter::ServerApplyKnockback_Implementation(FVector KnockbackDirection, float Force)
 {
+    if (!URpcRateLimitSubsystem::Allow(this, ECombatRpc::Knockback))
+    {
+        return;
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("ServerApplyKnockback: Received knockback request from client"));
     
-    // Apply knockback locally on server
-    ApplyKnockbackInternal(KnockbackDirection, Force);
-    
-    // Replicate to all clients
-    MulticastApplyKnockback(KnockbackDirection, Force);
+    // Server path of ApplyKnockback handles the owning client
+    ApplyKnockback(KnockbackDirection, Force);
 }
 
-void ABloodreadBaseCharacter::MulticastApplyKnockback_Implementation(FVector KnockbackDirection, float Force)
+void ABloodreadBaseCharacter::ClientApplyKnockback_Implementation(FVector_NetQuantizeNormal KnockbackDirection, float Force)
 {
-    UE_LOG(LogTemp, Warning, TEXT("MulticastApplyKnockback: Applying knockback on client"));
-    
-    // Don't apply on server again (it already applied in ServerApplyKnockback)
-    if (!HasAuthority())
-    {
-        ApplyKnockbackInternal(KnockbackDirection, Force);
-    }
+    UE_LOG(LogTemp, Warning, TEXT("ClientApplyKnockback: Predicting knockback locally"));
+    ApplyKnockbackInternal(KnockbackDirection, Force);
 }
 
-void ABloodreadBaseCharacter::ServerApplyKnockbackToTarget_Implementation(ACharacter* TargetCharacter, FVector KnockbackDirection, float Force)
+UBloodreadMovementComponent* ABloodreadBaseCharacter::GetBloodreadMovement() const
 {
-    UE_LOG(LogTemp, Warning, TEXT("ServerApplyKnockbackToTarget: Applying knockback to %s from %s"), 
-           TargetCharacter ? *TargetCharacter->GetName() : TEXT("NULL"), *GetName());
-    
-    if (!TargetCharacter)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("ServerApplyKnockbackToTarget: NULL target"));
-        return;
-    }
-    
-    // Handle different character types
-    if (ABloodreadBaseCharacter* BaseCharacter = Cast<ABloodreadBaseCharacter>(TargetCharacter))
-    {
-        if (!BaseCharacter->GetIsAlive())
-        {
-            UE_LOG(LogTemp, Warning, TEXT("ServerApplyKnockbackToTarget: BaseCharacter is dead"));
-            return;
-        }
-        
-        // Apply knockback to BloodreadBaseCharacter
-        BaseCharacter->ApplyKnockbackInternal(KnockbackDirection, Force);
-        BaseCharacter->MulticastApplyKnockback(KnockbackDirection, Force);
-    }
-    else if (ABloodreadPlayerCharacter* PlayerCharacter = Cast<ABloodreadPlayerCharacter>(TargetCharacter))
-    {
-        if (!PlayerCharacter->IsAlive())
-        {
-            UE_LOG(LogTemp, Warning, TEXT("ServerApplyKnockbackToTarget: PlayerCharacter is dead"));
-            return;
-        }
-        
-        // Apply knockback to BloodreadPlayerCharacter (no multicast needed, it handles its own replication)
-        PlayerCharacter->ApplyKnockback(KnockbackDirection, Force);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("ServerApplyKnockbackToTarget: Unknown character type: %s"), *TargetCharacter->GetClass()->GetName());
-    }
+    return Cast<UBloodreadMovementComponent>(GetCharacterMovement());
 }
 
 void ABloodreadBaseCharacter::ApplyKnockbackInternal(FVector KnockbackDirection, float Force)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadKnockback);
     if (!GetIsAlive()) 
     {
         UE_LOG(LogTemp, Warning, TEXT("BaseChar ApplyKnockbackInternal: Character is not alive, ignoring knockback"));
         return;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("BaseChar ApplyKnockbackInternal: Original direction: %s, Force: %.2f"), *KnockbackDirection.ToString(), Force);
-    
-    // Enhanced knockback: Don't normalize to preserve force magnitudes
-    FVector Horizontal = FVector(KnockbackDirection.X, KnockbackDirection.Y, 0.0f);
-    Horizontal = Horizontal.GetSafeNormal();
+    UE_LOG(LogTemp, Warning, TEXT("BaseChar ApplyKnockbackInternal: Direction: %s, Force: %.2f"), *KnockbackDirection.ToString(), Force);
     
-    // Apply multipliers to create enhanced force components
-    float HorizontalForce = Force * HorizontalKnockbackMultiplier;
-    float VerticalForce = Force * 0.6f; // Strong vertical component
-    
-    // Create final knockback vector with proper proportions
-    FVector EnhancedKnockback = Horizontal * HorizontalForce;
-    EnhancedKnockback.Z = VerticalForce; // Always add upward force regardless of original direction
-    
-    UE_LOG(LogTemp, Error, TEXT("BaseChar ApplyKnockbackInternal: Enhanced knockback: %s (H:%.1f V:%.1f)"), 
-           *EnhancedKnockback.ToString(), HorizontalForce, VerticalForce);
-    
-    // Get character movement component
-    UCharacterMovementComponent* MovementComp = GetCharacterMovement();
+    UBloodreadMovementComponent* MovementComp = GetBloodreadMovement();
     if (!MovementComp)
     {
-        UE_LOG(LogTemp, Error, TEXT("BaseChar ApplyKnockbackInternal: CharacterMovementComponent is NULL!"));
+        UE_LOG(LogTemp, Error, TEXT("BaseChar ApplyKnockbackInternal: BloodreadMovementComponent is NULL!"));
         return;
     }
     
-    // Apply the enhanced knockback directly (no additional force multiplication)
-    UE_LOG(LogTemp, Error, TEXT("BaseChar ApplyKnockbackInternal: Applying enhanced knockback: %s"), *EnhancedKnockback.ToString());
-    
-    // Method 1: AddImpulse with the enhanced knockback vector
-    MovementComp->AddImpulse(EnhancedKnockback, true); // true = ignore mass for consistent knockback
-    
-    // Method 2: LaunchCharacter as backup (especially useful if character is on ground)
-    if (MovementComp->IsMovingOnGround())
-    {
-        FVector LaunchVelocity = EnhancedKnockback * 0.8f;
-        UE_LOG(LogTemp, Error, TEXT("BaseChar ApplyKnockbackInternal: Also launching character with velocity: %s"), *LaunchVelocity.ToString());
-        LaunchCharacter(LaunchVelocity, false, false);
-    }
-    
-    // Check velocity after impulse
-    FVector PostImpulseVelocity = MovementComp->Velocity;
-    UE_LOG(LogTemp, Error, TEXT("BaseChar ApplyKnockbackInternal: Post-impulse velocity: %s"), *PostImpulseVelocity.ToString());
-    
-    UE_LOG(LogTemp, Log, TEXT("BaseChar ApplyKnockbackInternal: Applied enhanced knockback with force: %.2f"), Force);
-    
-    // Optional: Disable AI input briefly to prevent interference (for AI-controlled characters)
-    if (AController* CurrentController = GetController())
-    {
-        if (!Cast<APlayerController>(CurrentController))
-        {
-            CurrentController->SetIgnoreMoveInput(true);
-            
-            // Re-enable input after a short duration
-            GetWorld()->GetTimerManager().SetTimer(KnockbackRecoveryTimerHandle, [this]()
-            {
-                if (AController* Controller = GetController())
-                {
-                    Controller->SetIgnoreMoveInput(false);
-                }
-            }, 0.5f, false);
-        }
-    }
+    // Root motion override: the curve depends only on direction and force, and movement input is ignored
+    // while it runs (this replaces the old AddImpulse + LaunchCharacter pair and the AI input lockout timer)
+    const FKnockbackShape Shape = MovementComp->ApplyKnockback(KnockbackDirection, Force, HorizontalKnockbackMultiplier);
+    BloodreadTrace::Knockback(this, KnockbackDirection, Force);
+    UMatchTelemetrySubsystem::NoteKnockback(this);
     
     // Call Blueprint event for knockback effects
-    OnKnockbackApplied(EnhancedKnockback.GetSafeNormal(), EnhancedKnockback.Size());
+    OnKnockbackApplied(Shape.EquivalentImpulse.GetSafeNormal(), Shape.EquivalentImpulse.Size());
+}
+
+FCombatantStats ABloodreadBaseCharacter::GetCombatantStats() const
+{
+    FCombatantStats Stats;
+    Stats.Health = CurrentHealth;
+    Stats.MaxHealth = CurrentStats.MaxHealth;
+    Stats.Mana = CurrentMana;
+    Stats.MaxMana = CurrentStats.Mana;
+    Stats.Strength = CurrentStats.Strength;
+    return Stats;
+}
+
+void ABloodreadBaseCharacter::SetCombatantStats(const FCombatantStats& Stats)
+{
+    CurrentHealth = Stats.Health;
+    CurrentStats.MaxHealth = Stats.MaxHealth;
+    CurrentMana = Stats.Mana;
+    CurrentStats.Mana = Stats.MaxMana;
+    CurrentStats.Strength = Stats.Strength;
+    RefreshTeamMembership();
 }
 
 bool ABloodreadBaseCharacter::TakeCustomDamage(int32 Damage, ABloodreadBaseCharacter* Attacker)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadDamage);
     if (!GetIsAlive() || Damage <= 0) return false;
 
     int32 PreviousHealth = CurrentHealth;
     
     // Apply damage
     CurrentHealth = FMath::Max(0, CurrentHealth - Damage);
+    UMatchRecorderSubsystem::RecordDamage(this, Attacker, PreviousHealth - CurrentHealth, CurrentHealth);
+    BloodreadTrace::Damage(this, Attacker, PreviousHealth - CurrentHealth);
+    UMatchTelemetrySubsystem::NoteDamage(this);
+    RefreshTeamMembership();
     
     // Call Blueprint event
     OnTakeDamage(Damage, Attacker);
     
     // Flash red effect
-    FlashRed();
+    if (!BloodreadCosmetics::ShouldSkip(this))
+    {
+        FlashRed();
+    }
     
     UE_LOG(LogTemp, Warning, TEXT("Base Character took %d damage! Health: %d -> %d"), 
            Damage, PreviousHealth, CurrentHealth);
@@ -1650,17 +1688,8 @@ bool ABloodreadBaseCharacter::TakeCustomDamage(int32 Damage, ABloodreadBaseChara
 
 void ABloodreadBaseCharacter::UpdateAbilityCooldowns(float DeltaTime)
 {
-    if (CharacterClassData.Ability1.CooldownRemaining > 0.0f)
-    {
-        CharacterClassData.Ability1.CooldownRemaining -= DeltaTime;
-        CharacterClassData.Ability1.CooldownRemaining = FMath::Max(0.0f, CharacterClassData.Ability1.CooldownRemaining);
-    }
-
-    if (CharacterClassData.Ability2.CooldownRemaining > 0.0f)
-    {
-        CharacterClassData.Ability2.CooldownRemaining -= DeltaTime;
-        CharacterClassData.Ability2.CooldownRemaining = FMath::Max(0.0f, CharacterClassData.Ability2.CooldownRemaining);
-    }
+    Ability1State.CooldownRemaining = FCombatRules::TickCooldown(Ability1State.CooldownRemaining, DeltaTime);
+    Ability2State.CooldownRemaining = FCombatRules::TickCooldown(Ability2State.CooldownRemaining, DeltaTime);
 }
 
 // Traditional Input System Functions
@@ -1726,26 +1755,31 @@ FString ABloodreadBaseCharacter::GetManaText() const
 
 FString ABloodreadBaseCharacter::GetAbility1Name() const
 {
-    return CharacterClassData.Ability1.Name;
+    return GetClassDefinition().Ability1.Name;
 }
 
 FString ABloodreadBaseCharacter::GetAbility2Name() const
 {
-    return CharacterClassData.Ability2.Name;
+    return GetClassDefinition().Ability2.Name;
 }
 
 float ABloodreadBaseCharacter::GetAbility1RemainingCooldown() const
 {
-    return CharacterClassData.Ability1.CooldownRemaining;
+    return Ability1State.CooldownRemaining;
 }
 
 float ABloodreadBaseCharacter::GetAbility2RemainingCooldown() const
 {
-    return CharacterClassData.Ability2.CooldownRemaining;
+    return Ability2State.CooldownRemaining;
 }
 
 void ABloodreadBaseCharacter::SetHealthBarWidget(UUserWidget* Widget)
 {
+    if (BloodreadCosmetics::ShouldSkip(this))
+    {
+        return;
+    }
+
     if (!Widget)
     {
         UE_LOG(LogTemp, Error, TEXT("*** SetHealthBarWidget: Widget parameter is NULL! ***"));
@@ -1781,6 +1815,11 @@ void ABloodreadBaseCharacter::SetHealthBarWidget(UUserWidget* Widget)
 
 void ABloodreadBaseCharacter::UpdateHealthDisplay()
 {
+    if (BloodreadCosmetics::ShouldSkip(this))
+    {
+        return;
+    }
+
     UE_LOG(LogTemp, Error, TEXT("=== UpdateHealthDisplay CALLED === Health: %d/%d"), CurrentHealth, CurrentStats.MaxHealth);
     
     if (CurrentHealthBarWidget)
@@ -1860,6 +1899,13 @@ void ABloodreadBaseCharacter::UpdateHealthDisplay()
 
 void ABloodreadBaseCharacter::InitializeHealthBar()
 {
+    if (BloodreadCosmetics::ShouldSkip(this))
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(Bloodread_UI);
+    BLOODREAD_SCOPE(STAT_BloodreadHUD);
     // Initialize health bar widget - EXACT copy from PracticeDummy approach
     UWidgetComponent* WorkingWidgetComponent = nullptr;
     
@@ -1875,7 +1921,7 @@ void ABloodreadBaseCharacter::InitializeHealthBar()
         UE_LOG(LogTemp, Error, TEXT("Player Character C++ HealthBarWidgetComponent is null!"));
         
         // Approach 2: Find any widget component by name (Blueprint components)
-        TArray<UWidgetComponent*> WidgetComponents;
+        TArray<UWidgetComponent*, TInlineAllocator<4>> WidgetComponents;
         GetComponents<UWidgetComponent>(WidgetComponents);
         
         UE_LOG(LogTemp, Warning, TEXT("Found %d widget components total"), WidgetComponents.Num());
@@ -1937,7 +1983,7 @@ void ABloodreadBaseCharacter::InitializeHealthBar()
 
 void ABloodreadBaseCharacter::UpdateHealthBarVisibility()
 {
-    if (!HealthBarWidgetComponent)
+    if (!HealthBarWidgetComponent || BloodreadCosmetics::ShouldSkip(this))
     {
         return;
     }
@@ -1973,42 +2019,8 @@ void ABloodreadBaseCharacter::InitializeEditorSpawnedCharacter()
     UE_LOG(LogTemp, Warning, TEXT("=== INITIALIZING EDITOR-SPAWNED CHARACTER ==="));
     UE_LOG(LogTemp, Warning, TEXT("Character: %s, Class: %s"), *GetName(), *GetClass()->GetName());
     
-    // Force the character to initialize based on its actual C++ class type
-    if (ABloodreadWarriorCharacter* WarriorChar = Cast<ABloodreadWarriorCharacter>(this))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Detected Warrior character, initializing warrior data..."));
-        SetCharacterClass(ECharacterClass::Warrior);
-        WarriorChar->InitializeWarriorData();
-    }
-    else if (ABloodreadMageCharacter* MageChar = Cast<ABloodreadMageCharacter>(this))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Detected Mage character, initializing mage data..."));
-        SetCharacterClass(ECharacterClass::Mage);
-        MageChar->InitializeMageData();
-    }
-    else if (ABloodreadRogueCharacter* RogueChar = Cast<ABloodreadRogueCharacter>(this))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Detected Rogue character, initializing rogue data..."));
-        SetCharacterClass(ECharacterClass::Rogue);
-        RogueChar->InitializeRogueData();
-    }
-    else if (ABloodreadHealerCharacter* HealerChar = Cast<ABloodreadHealerCharacter>(this))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Detected Healer character, initializing healer data..."));
-        SetCharacterClass(ECharacterClass::Healer);
-        HealerChar->InitializeHealerData();
-    }
-    else if (ABloodreadDragonCharacter* DragonChar = Cast<ABloodreadDragonCharacter>(this))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Detected Dragon character, initializing dragon data..."));
-        SetCharacterClass(ECharacterClass::Dragon);
-        DragonChar->InitializeDragonData();
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Base character type, setting to Warrior as default"));
-        SetCharacterClass(ECharacterClass::Warrior);
-    }
+    // Same init pipeline as BeginPlay; a no-op if it already ran for this class
+    ForceInitializeCharacterSystems();
     
     // Force health bar initialization
     InitializeHealthBar();
@@ -2102,46 +2114,99 @@ void ABloodreadBaseCharacter::ForceEnableKnockbackPhysics()
 
 void ABloodreadBaseCharacter::PlayBasicAttackAnimation()
 {
-    UE_LOG(LogTemp, Warning, TEXT("🎭 PlayBasicAttackAnimation called"));
-    
-    if (!CharacterClassData.BasicAttackAnimationPath.IsEmpty())
+    bool bPlayed = PlayActionMontage(ECharacterAnimAction::BasicAttack);
+    UE_LOG(LogTemp, Warning, TEXT("🎭 Basic attack animation result: %s"), bPlayed ? TEXT("SUCCESS") : TEXT("FAILED"));
+}
+
+void ABloodreadBaseCharacter::PlayAbility1Animation()
+{
+    bool bPlayed = PlayActionMontage(ECharacterAnimAction::Ability1);
+    UE_LOG(LogTemp, Warning, TEXT("🎭 Ability 1 animation result: %s"), bPlayed ? TEXT("SUCCESS") : TEXT("FAILED"));
+}
+
+void ABloodreadBaseCharacter::PlayAbility2Animation()
+{
+    bool bPlayed = PlayActionMontage(ECharacterAnimAction::Ability2);
+    UE_LOG(LogTemp, Warning, TEXT("🎭 Ability 2 animation result: %s"), bPlayed ? TEXT("SUCCESS") : TEXT("FAILED"));
+}
+
+bool ABloodreadBaseCharacter::PlayActionMontage(ECharacterAnimAction Action)
+{
+    if (Action == ECharacterAnimAction::None)
+    {
+        return false;
+    }
+
+    // Server records the action so simulated proxies replay it from OnRep_MontageState
+    if (HasAuthority())
     {
-        bool bPlayed = PlayAnimationFromPath(CharacterClassData.BasicAttackAnimationPath);
-        UE_LOG(LogTemp, Warning, TEXT("🎭 Basic attack animation result: %s"), bPlayed ? TEXT("SUCCESS") : TEXT("FAILED"));
+        MontageState.Action = Action;
+        ++MontageState.PlayCount;
+        MontageState.StartServerTime = static_cast<float>(GetCombatClock());
+        UMatchRecorderSubsystem::RecordAction(this, static_cast<uint8>(Action));
     }
-    else
+
+    // Hit reactions don't move any hit volumes, so a dedicated server only replicates them
+    if (Action == ECharacterAnimAction::HitReact && BloodreadCosmetics::ShouldSkip(this))
     {
-        UE_LOG(LogTemp, Error, TEXT("🎭 No basic attack animation path set for character class"));
+        return true;
     }
+
+    return PlayMontageLocal(GetActionMontage(Action));
 }
 
-void ABloodreadBaseCharacter::PlayAbility1Animation()
+UAnimMontage* ABloodreadBaseCharacter::GetActionMontage(ECharacterAnimAction Action) const
 {
-    UE_LOG(LogTemp, Warning, TEXT("🎭 PlayAbility1Animation called"));
-    
-    if (!CharacterClassData.Ability1AnimationPath.IsEmpty())
+    UGameInstance* GameInstance = GetGameInstance();
+    UClassMontageCache* MontageCache = GameInstance ? GameInstance->GetSubsystem<UClassMontageCache>() : nullptr;
+    return MontageCache ? MontageCache->GetMontage(CurrentCharacterClass, Action) : nullptr;
+}
+
+bool ABloodreadBaseCharacter::PlayMontageLocal(UAnimMontage* Montage, float StartPosition)
+{
+    if (!Montage)
     {
-        bool bPlayed = PlayAnimationFromPath(CharacterClassData.Ability1AnimationPath);
-        UE_LOG(LogTemp, Warning, TEXT("🎭 Ability 1 animation result: %s"), bPlayed ? TEXT("SUCCESS") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("🎭 No montage available for character class %d"), (int32)CurrentCharacterClass);
+        return false;
     }
-    else
+
+    USkeletalMeshComponent* MeshComp = GetMesh();
+    UAnimInstance* AnimInstance = MeshComp ? MeshComp->GetAnimInstance() : nullptr;
+    if (!AnimInstance)
+    {
+        UE_LOG(LogTemp, Error, TEXT("🎭 No anim instance to play montage %s on"), *Montage->GetName());
+        return false;
+    }
+
+    UBloodreadSignificanceSubsystem::NotifyCombat(this);
+
+    // Plays through the anim blueprint slot - the anim instance is never torn down or rebuilt
+    const float PlayLength = AnimInstance->Montage_Play(Montage, 1.0f, EMontagePlayReturnType::MontageLength, StartPosition);
+    if (PlayLength > 0.0f && GetNetMode() == NM_DedicatedServer)
     {
-        UE_LOG(LogTemp, Error, TEXT("🎭 No ability 1 animation path set for character class"));
+        BeginServerHitDetectionPose(PlayLength);
     }
+    return PlayLength > 0.0f;
 }
 
-void ABloodreadBaseCharacter::PlayAbility2Animation()
+void ABloodreadBaseCharacter::BeginServerHitDetectionPose(float Duration)
 {
-    UE_LOG(LogTemp, Warning, TEXT("🎭 PlayAbility2Animation called"));
-    
-    if (!CharacterClassData.Ability2AnimationPath.IsEmpty())
+    USkeletalMeshComponent* MeshComp = GetMesh();
+    if (!MeshComp)
     {
-        bool bPlayed = PlayAnimationFromPath(CharacterClassData.Ability2AnimationPath);
-        UE_LOG(LogTemp, Warning, TEXT("🎭 Ability 2 animation result: %s"), bPlayed ? TEXT("SUCCESS") : TEXT("FAILED"));
+        return;
     }
-    else
+
+    MeshComp->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+    GetWorldTimerManager().SetTimer(ServerHitDetectionPoseTimer, this, &ABloodreadBaseCharacter::EndServerHitDetectionPose,
+                                    Duration + ServerHitDetectionPosePadding, false);
+}
+
+void ABloodreadBaseCharacter::EndServerHitDetectionPose()
+{
+    if (USkeletalMeshComponent* MeshComp = GetMesh())
     {
-        UE_LOG(LogTemp, Error, TEXT("🎭 No ability 2 animation path set for character class"));
+        MeshComp->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
     }
 }
 
@@ -2155,68 +2220,14 @@ bool ABloodreadBaseCharacter::PlayAnimationFromPath(const FString& AnimationPath
         return false;
     }
     
-    USkeletalMeshComponent* MeshComp = GetMesh();
-    if (!MeshComp)
-    {
-        UE_LOG(LogTemp, Error, TEXT("🎭 No skeletal mesh component found"));
-        return false;
-    }
-    
-    // Try to load the animation sequence
-    UAnimSequence* AnimSequence = LoadObject<UAnimSequence>(nullptr, *AnimationPath);
-    if (!AnimSequence)
+    UGameInstance* GameInstance = GetGameInstance();
+    UClassMontageCache* MontageCache = GameInstance ? GameInstance->GetSubsystem<UClassMontageCache>() : nullptr;
+    if (!MontageCache)
     {
-        UE_LOG(LogTemp, Error, TEXT("🎭 Failed to load animation sequence from path: %s"), *AnimationPath);
         return false;
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("🎭 Successfully loaded animation sequence: %s"), *AnimSequence->GetName());
-    
-    // Clear any existing timer
-    GetWorld()->GetTimerManager().ClearTimer(AnimationBlendBackTimer);
-    
-    // Store current animation mode to restore later
-    EAnimationMode::Type OriginalAnimMode = MeshComp->GetAnimationMode();
-    
-    // Play the animation directly (this ensures it actually plays)
-    MeshComp->PlayAnimation(AnimSequence, false); // false = don't loop
-    
-    UE_LOG(LogTemp, Warning, TEXT("🎭 Animation playback started with PlayAnimation"));
-    
-    // Calculate when to restore animation blueprint mode
-    float AnimationDuration = AnimSequence->GetPlayLength();
-    float RestoreDelay = AnimationDuration + 0.2f; // Small buffer time
-    
-    UE_LOG(LogTemp, Warning, TEXT("🎭 Animation duration: %.2f seconds, will restore animation blueprint in %.2f seconds"), 
-           AnimationDuration, RestoreDelay);
-    
-    // Set timer to restore animation blueprint mode after animation completes
-    GetWorld()->GetTimerManager().SetTimer(
-        AnimationBlendBackTimer,
-        [this, MeshComp]()
-        {
-            UE_LOG(LogTemp, Warning, TEXT("🎭 Restoring animation blueprint mode"));
-            if (MeshComp && IsValid(MeshComp))
-            {
-                // Force back to animation blueprint mode
-                MeshComp->SetAnimationMode(EAnimationMode::AnimationBlueprint);
-                
-                // If we have an animation blueprint class, reinitialize it
-                if (UClass* AnimBPClass = MeshComp->GetAnimClass())
-                {
-                    MeshComp->SetAnimInstanceClass(AnimBPClass);
-                    MeshComp->InitializeAnimScriptInstance(true);
-                    UE_LOG(LogTemp, Warning, TEXT("🎭 Animation blueprint reinitialized"));
-                }
-                
-                UE_LOG(LogTemp, Warning, TEXT("🎭 Successfully restored to animation blueprint mode"));
-            }
-        },
-        RestoreDelay,
-        false // Don't loop
-    );
-    
-    return true;
+
+    return PlayMontageLocal(MontageCache->GetMontageForPath(AnimationPath, GetClassDefinition().AnimationSlotName));
 }
 
 // Network replication functions
@@ -2226,19 +2237,82 @@ void ABloodreadBaseCharacter::GetLifetimeReplicatedProps(TArray<FLifetimePropert
     
     DOREPLIFETIME(ABloodreadBaseCharacter, CurrentHealth);
     DOREPLIFETIME(ABloodreadBaseCharacter, CurrentMana);
+    DOREPLIFETIME(ABloodreadBaseCharacter, CurrentCharacterClass);
+    DOREPLIFETIME(ABloodreadBaseCharacter, Team);
+    DOREPLIFETIME(ABloodreadBaseCharacter, MontageState);
+}
+
+void ABloodreadBaseCharacter::OnRep_MontageState()
+{
+    // Attacks and abilities were played by the owner when it pressed them (PlayCombatInputCosmetics); hit reactions
+    // and anything else the server started still need playing here
+    const bool bOwnerPredicted = MontageState.Action == ECharacterAnimAction::BasicAttack
+                              || MontageState.Action == ECharacterAnimAction::Ability1
+                              || MontageState.Action == ECharacterAnimAction::Ability2;
+    if (bOwnerPredicted && IsLocallyControlled())
+    {
+        return;
+    }
+
+    UAnimMontage* Montage = GetActionMontage(MontageState.Action);
+    if (!Montage)
+    {
+        return;
+    }
+
+    // The state also arrives when this character becomes relevant again or a client joins mid-match; a montage
+    // that has already finished on the server is history, one still running is joined where the server is
+    const float Elapsed = FMath::Max(0.0f, static_cast<float>(GetCombatClock()) - MontageState.StartServerTime);
+    if (Elapsed >= Montage->GetPlayLength())
+    {
+        return;
+    }
+    PlayMontageLocal(Montage, Elapsed);
+}
+
+void ABloodreadBaseCharacter::OnRep_CharacterClass()
+{
+    UE_LOG(LogTemp, Warning, TEXT("Character class replicated: %d"), (int32)CurrentCharacterClass);
+
+    // Clients need the class stats too (MaxHealth for health bars, ability costs and cooldowns for prediction);
+    // BindClassDefinition leaves the replicated health and mana alone off the server
+    ECharacterInitStep Steps = ECharacterInitStep::None;
+    if (BoundClass != CurrentCharacterClass)
+    {
+        Steps |= ECharacterInitStep::ClassData;
+    }
+    if (VisualClass != CurrentCharacterClass)
+    {
+        Steps |= ECharacterInitStep::Visuals;
+    }
+    RequestInitSteps(Steps);
+    RunPendingInitSteps();
 }
 
 void ABloodreadBaseCharacter::OnRep_Health()
 {
     UE_LOG(LogTemp, Warning, TEXT("Health replicated: %d"), CurrentHealth);
+    UBloodreadSignificanceSubsystem::NotifyCombat(this);
+    RefreshTeamMembership();
     
     // Update UI and visual effects
     Multicast_OnHealthChanged(CurrentHealth, CurrentStats.MaxHealth);
 }
 
 // Multiplayer RPC implementations
+bool ABloodreadBaseCharacter::Server_UseAbility_Validate(int32 AbilityIndex, FVector TargetLocation)
+{
+    return AbilityIndex >= 0 && AbilityIndex <= 1 && !TargetLocation.ContainsNaN() && TargetLocation.GetAbsMax() < UE_OLD_HALF_WORLD_MAX;
+}
+
 void ABloodreadBaseCharacter::Server_UseAbility_Implementation(int32 AbilityIndex, FVector TargetLocation)
 {
+    // Mana and cooldown are still checked by UseAbility1/2; this just sheds floods before any of that runs
+    if (!URpcRateLimitSubsystem::Allow(this, ECombatRpc::UseAbility))
+    {
+        return;
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("Server: Using ability %d at location %s"), AbilityIndex, *TargetLocation.ToString());
     
     // Validate ability usage on server
@@ -2253,36 +2327,29 @@ void ABloodreadBaseCharacter::Server_UseAbility_Implementation(int32 AbilityInde
         {
             UseAbility2();
         }
-        
-        // Replicate animation to all clients
-        Multicast_PlayAbilityAnimation(AbilityIndex);
+        // Animation reaches other clients through the replicated MontageState set by UseAbility
     }
 }
 
-void ABloodreadBaseCharacter::Multicast_PlayAbilityAnimation_Implementation(int32 AbilityIndex)
+bool ABloodreadBaseCharacter::Server_TakeDamage_Validate(float DamageAmount, ABloodreadBaseCharacter* DamageSource)
 {
-    UE_LOG(LogTemp, Warning, TEXT("Multicast: Playing ability animation %d"), AbilityIndex);
-    
-    // Play animation for ability (call existing animation logic)
-    if (AbilityIndex == 0)
-    {
-        PlayAnimationFromPath(CharacterClassData.Ability1AnimationPath);
-    }
-    else if (AbilityIndex == 1)
-    {
-        PlayAnimationFromPath(CharacterClassData.Ability2AnimationPath);
-    }
+    return FMath::IsFinite(DamageAmount) && DamageAmount >= 0.0f && DamageAmount <= URpcRateLimitSubsystem::GetMaxReportedDamage(this);
 }
 
 void ABloodreadBaseCharacter::Server_TakeDamage_Implementation(float DamageAmount, ABloodreadBaseCharacter* DamageSource)
 {
+    if (!URpcRateLimitSubsystem::Allow(this, ECombatRpc::TakeDamage))
+    {
+        return;
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("Server: Taking %f damage from %s"), DamageAmount, DamageSource ? *DamageSource->GetName() : TEXT("Unknown"));
     
     // Apply damage on server
     DealDamage(DamageAmount);
     
-    // Replicate hit animation
-    Multicast_PlayHitAnimation();
+    // Hit reaction replicates through MontageState
+    PlayActionMontage(ECharacterAnimAction::HitReact);
 }
 
 void ABloodreadBaseCharacter::Multicast_OnHealthChanged_Implementation(int32 NewHealth, int32 MaxHealth)
@@ -2290,7 +2357,7 @@ void ABloodreadBaseCharacter::Multicast_OnHealthChanged_Implementation(int32 New
     UE_LOG(LogTemp, Warning, TEXT("Multicast: Health changed to %d/%d"), NewHealth, MaxHealth);
     
     // Update health bar UI for all clients
-    if (HealthBarWidgetComponent)
+    if (HealthBarWidgetComponent && !BloodreadCosmetics::ShouldSkip(this))
     {
         if (UUniversalHealthBarWidget* HealthWidget = Cast<UUniversalHealthBarWidget>(HealthBarWidgetComponent->GetUserWidgetObject()))
         {
@@ -2299,18 +2366,54 @@ void ABloodreadBaseCharacter::Multicast_OnHealthChanged_Implementation(int32 New
     }
 }
 
+void ABloodreadBaseCharacter::FireProjectile(const FProjectileSpawnParams& Params)
+{
+    if (UProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UProjectileSubsystem>())
+    {
+        Projectiles->FireProjectile(this, Params);
+    }
+}
+
+void ABloodreadBaseCharacter::Multicast_SpawnProjectile_Implementation(const FProjectileSpawnParams& Params)
+{
+    // The server added it when firing
+    if (HasAuthority())
+    {
+        return;
+    }
+
+    if (UProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UProjectileSubsystem>())
+    {
+        Projectiles->AddReplicatedProjectile(this, Params);
+    }
+}
+
+void ABloodreadBaseCharacter::Multicast_ProjectileImpact_Implementation(uint32 ProjectileId, FVector_NetQuantize ImpactLocation)
+{
+    if (!HasAuthority())
+    {
+        if (UProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UProjectileSubsystem>())
+        {
+            Projectiles->RemoveProjectileById(ProjectileId);
+        }
+    }
+    OnProjectileImpact(ImpactLocation);
+}
+
+bool ABloodreadBaseCharacter::Server_BasicAttack_Validate(FVector TargetLocation)
+{
+    return !TargetLocation.ContainsNaN() && TargetLocation.GetAbsMax() < UE_OLD_HALF_WORLD_MAX;
+}
+
 void ABloodreadBaseCharacter::Server_BasicAttack_Implementation(FVector TargetLocation)
 {
+    if (!URpcRateLimitSubsystem::Allow(this, ECombatRpc::BasicAttack))
+    {
+        return;
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("Server: Basic attack at %s"), *TargetLocation.ToString());
     
     // Perform attack logic on server
     PerformAttack();
 }
-
-void ABloodreadBaseCharacter::Multicast_PlayHitAnimation_Implementation()
-{
-    UE_LOG(LogTemp, Warning, TEXT("Multicast: Playing hit animation"));
-    
-    // Play hit animation on all clients - using basic attack animation as placeholder
-    PlayAnimationFromPath(CharacterClassData.BasicAttackAnimationPath);
-}
\ No newline at end of file
@@ -15,11 +15,16 @@
 #include "InputActionValue.h"
 #include "Engine/Engine.h"
 #include "Net/UnrealNetwork.h"
+#include "SkeletonBindingCache.h"
+#include "CombatRules.h"
+#include "ProjectileSubsystem.h"
+#include "BloodreadMovementComponent.h"
 #include "BloodreadBaseCharacter.generated.h"
 
 // Forward declarations
 class UInputMappingContext;
 class UInputAction;
+class UAnimMontage;
 class APracticeDummy;
 class ABloodreadWarriorCharacter;
 class ABloodreadMageCharacter;
@@ -218,6 +223,10 @@ struct FCharacterClassData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Class")
     FString Ability2AnimationPath;
 
+    // Anim blueprint slot the attack/ability montages play through
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Class")
+    FName AnimationSlotName = TEXT("DefaultSlot");
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Class")
     FVector CameraOffset;
 
@@ -234,32 +243,159 @@ struct FCharacterClassData
         BasicAttackAnimationPath = "";
         Ability1AnimationPath = "";
         Ability2AnimationPath = "";
+        AnimationSlotName = TEXT("DefaultSlot");
         CameraOffset = FVector(-39.56f, 1.75f, 64.0f); // Default camera offset
     }
 };
 
+// Per-character mutable ability state (the ability definition itself lives in FCharacterClassRegistry)
+USTRUCT(BlueprintType)
+struct FCharacterAbilityRuntimeState
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Ability")
+    float CooldownRemaining = 0.0f;
+};
+
+// Steps of the character init pipeline; each runs once per class change (see RunPendingInitSteps)
+enum class ECharacterInitStep : uint8
+{
+    None       = 0,
+    ClassData  = 1 << 0, // Stats, health, mana and ability state from the registry
+    Mesh       = 1 << 1,
+    AnimClass  = 1 << 2,
+    Camera     = 1 << 3,
+    ClassHooks = 1 << 4, // Montage warm-up and OnCharacterClassChanged (class UI)
+    Visuals    = Mesh | AnimClass | Camera
+};
+ENUM_CLASS_FLAGS(ECharacterInitStep);
+
+// One-shot animations played through the class montage slot
+UENUM(BlueprintType)
+enum class ECharacterAnimAction : uint8
+{
+    None        UMETA(DisplayName = "None"),
+    BasicAttack UMETA(DisplayName = "Basic Attack"),
+    Ability1    UMETA(DisplayName = "Ability 1"),
+    Ability2    UMETA(DisplayName = "Ability 2"),
+    HitReact    UMETA(DisplayName = "Hit React")
+};
+
+// Replicated "last montage played" so simulated proxies replay it without a multicast
+USTRUCT(BlueprintType)
+struct FReplicatedMontageState
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Animation")
+    ECharacterAnimAction Action = ECharacterAnimAction::None;
+
+    // Bumped on every play so repeating the same action still replicates
+    UPROPERTY(BlueprintReadOnly, Category = "Animation")
+    uint8 PlayCount = 0;
+
+    // Server world time the montage started; late receivers (relevancy, join in progress) join it part-way or skip it
+    UPROPERTY(BlueprintReadOnly, Category = "Animation")
+    float StartServerTime = 0.0f;
+};
+
+// An attack/ability press waiting to become legal; times are on the server clock
+struct FBufferedCombatInput
+{
+    ECharacterAnimAction Action = ECharacterAnimAction::None;
+    double PressTime = 0.0;
+    double ExpireTime = 0.0;
+};
+
+// Short FIFO of pressed actions, fired in press order as soon as each one is allowed
+class FCombatInputBuffer
+{
+public:
+    static constexpr int32 MaxQueued = 3;
+
+    // Queue a press; pressing an action that is already queued just refreshes its expiry
+    void Push(ECharacterAnimAction Action, double PressTime, double ExpireTime)
+    {
+        for (FBufferedCombatInput& Entry : Entries)
+        {
+            if (Entry.Action == Action)
+            {
+                Entry.ExpireTime = ExpireTime;
+                return;
+            }
+        }
+        if (Entries.Num() >= MaxQueued)
+        {
+            Entries.RemoveAt(0);
+        }
+        Entries.Add({ Action, PressTime, ExpireTime });
+    }
+
+    // Drop expired presses (reporting each to Expire) and fire the front of the queue while CanFire allows it;
+    // returns the number fired
+    template<typename CanFireFn, typename FireFn, typename ExpireFn>
+    int32 Process(double Now, CanFireFn&& CanFire, FireFn&& Fire, ExpireFn&& Expire)
+    {
+        int32 Fired = 0;
+        while (Entries.Num() > 0)
+        {
+            const FBufferedCombatInput Front = Entries[0];
+            if (Now > Front.ExpireTime)
+            {
+                Entries.RemoveAt(0);
+                Expire(Front);
+                continue;
+            }
+            if (!CanFire(Front.Action))
+            {
+                break;
+            }
+            Entries.RemoveAt(0);
+            Fire(Front);
+            ++Fired;
+        }
+        return Fired;
+    }
+
+    bool IsEmpty() const { return Entries.Num() == 0; }
+    void Reset() { Entries.Reset(); }
+
+private:
+    TArray<FBufferedCombatInput, TInlineAllocator<MaxQueued>> Entries;
+};
+
 UCLASS()
 class BLOODREADGAME_API ABloodreadBaseCharacter : public ACharacter
 {
     GENERATED_BODY()
 
 public:
-    ABloodreadBaseCharacter();
+    ABloodreadBaseCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
     // Network replication
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void PossessedBy(AController* NewController) override;
     virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
     virtual void Tick(float DeltaTime) override;
 
-    // Character class system
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Class")
+    // Advance cooldowns, regen and other combat state by one UCombatTickSubsystem step (never frame time)
+    virtual void FixedCombatStep(float StepSeconds);
+
+    // Character class system - only the class ID is stored and replicated, definitions come from FCharacterClassRegistry
+    UPROPERTY(ReplicatedUsing = OnRep_CharacterClass, EditAnywhere, BlueprintReadWrite, Category = "Character Class")
     ECharacterClass CurrentCharacterClass = ECharacterClass::Warrior;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Class")
-    FCharacterClassData CharacterClassData;
+    // Runtime cooldown state for the class abilities
+    UPROPERTY(BlueprintReadOnly, Category = "Character Class")
+    FCharacterAbilityRuntimeState Ability1State;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Character Class")
+    FCharacterAbilityRuntimeState Ability2State;
 
     // Core stats
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
@@ -271,6 +407,10 @@ protected:
     UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "Stats")
     int32 CurrentMana = 50;
 
+    // Team for ally/enemy checks; None is assigned by UBloodreadTeamSubsystem when the server possesses the character
+    UPROPERTY(ReplicatedUsing = OnRep_Team, EditAnywhere, BlueprintReadOnly, Category = "Team")
+    ETeam Team = ETeam::None;
+
     // Movement tuning properties (exposed for tweaking in editor/blueprints)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Tuning")
     float CharacterGravityScale = 0.8f; // Reduced from 1.0f for better air control and abilities
@@ -292,6 +432,39 @@ protected:
     UFUNCTION()
     void OnRep_Health();
 
+    UFUNCTION()
+    void OnRep_CharacterClass();
+
+    UFUNCTION()
+    void OnRep_Team();
+
+    // Last one-shot montage, replicated to everyone; the owner skips the actions it already played from its own input
+    UPROPERTY(ReplicatedUsing = OnRep_MontageState, BlueprintReadOnly, Category = "Animation")
+    FReplicatedMontageState MontageState;
+
+    UFUNCTION()
+    void OnRep_MontageState();
+
+    // Point this character at a registry class: sets the class ID, resets stats and ability cooldowns
+    void BindClassDefinition(ECharacterClass NewClass);
+
+    // Apply the mesh, animation blueprint and/or camera offset steps for the current class definition
+    void ApplyClassVisuals(ECharacterInitStep Steps);
+
+    // Init pipeline: steps are marked dirty here and applied by RunPendingInitSteps, so BeginPlay, possession,
+    // the possession RPC and replication can all ask for initialization without repeating work
+    void RequestInitSteps(ECharacterInitStep Steps);
+    void RunPendingInitSteps();
+
+    // Class implied by the native subclass (or Blueprint class name) for characters placed or spawned without one
+    ECharacterClass ResolveNativeCharacterClass() const;
+
+    ECharacterInitStep PendingInitSteps = ECharacterInitStep::None;
+
+    // Class the stats and the visuals were last applied for
+    ECharacterClass BoundClass = ECharacterClass::None;
+    ECharacterClass VisualClass = ECharacterClass::None;
+
     // Mana regeneration system
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
     float ManaRegenRate = 1.0f; // Mana per second
@@ -299,6 +472,25 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
     float ManaRegenTimer = 0.0f; // Timer for mana regeneration
 
+    FDelegateHandle FixedCombatStepHandle;
+
+    // Input buffering
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Input")
+    float InputBufferWindow = 0.25f; // How long a press waits to become legal
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Input")
+    float ActionRecoveryTime = 0.2f; // Minimum time between buffered actions on the owning client
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Input")
+    float MaxInputLatencyCompensation = 0.3f; // Presses older than this plus the buffer window are dropped by the server
+
+    FCombatInputBuffer CombatInputBuffer;
+    double ActionLockedUntil = 0.0;
+
+    void BufferAttackInput() { QueueCombatInput(ECharacterAnimAction::BasicAttack); }
+    void BufferAbility1Input() { QueueCombatInput(ECharacterAnimAction::Ability1); }
+    void BufferAbility2Input() { QueueCombatInput(ECharacterAnimAction::Ability2); }
+
     // Basic Attack System
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float BasicAttackRange = 200.0f;
@@ -369,14 +561,29 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Character Class")
     void SetCharacterClass(ECharacterClass NewClass);
 
+    // Initializes from the registry entry for ClassData.CharacterClass (kept for Blueprint callers)
     UFUNCTION(BlueprintCallable, Category = "Character Class")
     void InitializeFromClassData(const FCharacterClassData& ClassData);
 
+    UFUNCTION(BlueprintCallable, Category = "Character Class")
+    void InitializeFromClass(ECharacterClass NewClass);
+
     UFUNCTION(BlueprintPure, Category = "Character Class")
     ECharacterClass GetCharacterClass() const { return CurrentCharacterClass; }
 
+    UFUNCTION(BlueprintPure, Category = "Team")
+    ETeam GetTeam() const { return Team; }
+
+    // Server only; the new team replicates and the team registries follow
+    UFUNCTION(BlueprintCallable, Category = "Team")
+    void SetTeam(ETeam NewTeam);
+
+    // Blueprint copy of the class definition - native code should use GetClassDefinition()
     UFUNCTION(BlueprintPure, Category = "Character Class")
-    FCharacterClassData GetCharacterClassData() const { return CharacterClassData; }
+    FCharacterClassData GetCharacterClassData() const { return GetClassDefinition(); }
+
+    // Shared, immutable definition for the current class (no copy)
+    const FCharacterClassData& GetClassDefinition() const;
 
     // Blueprint-callable function to set mesh on any skeletal mesh component
     UFUNCTION(BlueprintCallable, Category = "Character Class")
@@ -390,7 +597,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Character Class")
     bool SetAnimationBlueprintOnComponent(USkeletalMeshComponent* MeshComponent, const FString& AnimBPPath);
 
-    // Force initialization of character systems (called by PlayerController on possess)
+    // Resolve the class and run whatever init steps it still needs; safe to call repeatedly (BeginPlay, possession)
     UFUNCTION(BlueprintCallable, Category = "Character Class")
     void ForceInitializeCharacterSystems();
 
@@ -398,12 +605,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Character Class")
     void TestAllMeshPaths();
 
-    // Manual initialization functions for Blueprint characters
-    void InitializeWarriorDataManually();
-    void InitializeMageDataManually();
-    void InitializeRogueDataManually();
-    void InitializeHealerDataManually();
-    void InitializeDragonDataManually();
+    // Bone/socket for a gameplay point on the character mesh (cached per skeleton)
+    UFUNCTION(BlueprintPure, Category = "Character Class")
+    FName GetSkeletonPointName(EBloodreadSkeletonPoint Point) const;
+
+    // World location of a gameplay point, falls back to the actor location when unresolved
+    UFUNCTION(BlueprintPure, Category = "Character Class")
+    FVector GetSkeletonPointLocation(EBloodreadSkeletonPoint Point) const;
 
     // Health system - Helper functions for Blueprint Interface
     UFUNCTION(BlueprintCallable, Category = "Health")
@@ -416,24 +624,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Health")
     void DealDamageWithKnockback(float DamageAmount, FVector KnockbackDirection, float KnockbackForce, ABloodreadBaseCharacter* Attacker = nullptr);
 
-    // Multiplayer RPCs
-    UFUNCTION(Server, Reliable, BlueprintCallable, Category = "Multiplayer")
+    // Multiplayer RPCs (validated, and rate limited per connection by URpcRateLimitSubsystem)
+    UFUNCTION(Server, Reliable, WithValidation, BlueprintCallable, Category = "Multiplayer")
     void Server_UseAbility(int32 AbilityIndex, FVector TargetLocation);
 
-    UFUNCTION(NetMulticast, Reliable, BlueprintCallable, Category = "Multiplayer")
-    void Multicast_PlayAbilityAnimation(int32 AbilityIndex);
-
-    UFUNCTION(Server, Reliable, Category = "Multiplayer")
+    UFUNCTION(Server, Reliable, WithValidation, Category = "Multiplayer")
     void Server_TakeDamage(float DamageAmount, ABloodreadBaseCharacter* DamageSource);
 
     UFUNCTION(NetMulticast, Reliable, Category = "Multiplayer")
     void Multicast_OnHealthChanged(int32 NewHealth, int32 MaxHealth);
 
-    UFUNCTION(Server, Reliable, Category = "Multiplayer")
+    UFUNCTION(Server, Reliable, WithValidation, Category = "Multiplayer")
     void Server_BasicAttack(FVector TargetLocation);
 
+    // Projectiles (simulated by UProjectileSubsystem, no per-projectile actors)
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Combat")
+    void FireProjectile(const FProjectileSpawnParams& Params);
+
     UFUNCTION(NetMulticast, Reliable, Category = "Multiplayer")
-    void Multicast_PlayHitAnimation();
+    void Multicast_SpawnProjectile(const FProjectileSpawnParams& Params);
+
+    UFUNCTION(NetMulticast, Unreliable, Category = "Multiplayer")
+    void Multicast_ProjectileImpact(uint32 ProjectileId, FVector_NetQuantize ImpactLocation);
+
+    // Cosmetic hook for impact effects
+    UFUNCTION(BlueprintImplementableEvent, Category = "Combat")
+    void OnProjectileImpact(FVector ImpactLocation);
 
     UFUNCTION(BlueprintPure, Category = "Health")
     bool GetIsAlive() const { return CurrentHealth > 0; }
@@ -441,6 +657,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Health")
     float GetCurrentHealthFloat() const { return static_cast<float>(CurrentHealth); }
 
+    // Copy health/mana/strength into the plain FCombatRules state and back (no change events fired)
+    FCombatantStats GetCombatantStats() const;
+    void SetCombatantStats(const FCombatantStats& Stats);
+
     UFUNCTION(BlueprintPure, Category = "Health")
     float GetMaxHealthFloat() const { return static_cast<float>(CurrentStats.MaxHealth); }
 
@@ -458,6 +678,7 @@ public:
     void SetCurrentHealth(int32 NewHealth) { 
         int32 OldHealth = CurrentHealth;
         CurrentHealth = FMath::Clamp(NewHealth, 0, CurrentStats.MaxHealth);
+        RefreshTeamMembership();
         OnHealthChanged(OldHealth, CurrentHealth);
     }
 
@@ -506,14 +727,6 @@ public:
     UPROPERTY()
     FTimerHandle HealthBarVisibilityTimerHandle;
 
-    // Timer handle for knockback recovery
-    UPROPERTY()
-    FTimerHandle KnockbackRecoveryTimerHandle;
-
-    // Timer handle for animation blend back
-    UPROPERTY()
-    FTimerHandle AnimationBlendBackTimer;
-
     // Mana system
     UFUNCTION(BlueprintCallable, Category = "Mana")
     bool UseMana(int32 ManaAmount);
@@ -537,12 +750,34 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Abilities")
     virtual void UseAbility2();
 
+    // Buffered input: queue an attack/ability press for InputBufferWindow and fire it as soon as it's legal.
+    // Owning clients play the animation straight away and forward the press; only the server applies its effects.
+    UFUNCTION(BlueprintCallable, Category = "Abilities")
+    void QueueCombatInput(ECharacterAnimAction Action);
+
+    UFUNCTION(Server, Reliable, WithValidation, Category = "Multiplayer")
+    void Server_QueueCombatInput(ECharacterAnimAction Action, float PressServerTime);
+
+    // The server's cooldown for an ability once a forwarded press has been resolved (fired, refused, refunded or
+    // dropped); replaces the owning client's predicted value
+    UFUNCTION(Client, Reliable, Category = "Multiplayer")
+    void Client_SyncAbilityCooldown(ECharacterAnimAction Action, float CooldownRemaining);
+
     UFUNCTION(BlueprintPure, Category = "Abilities")
     bool CanUseAbility1() const;
 
     UFUNCTION(BlueprintPure, Category = "Abilities")
     bool CanUseAbility2() const;
 
+    // Whether a buffered press of the ability may fire now; classes with follow-up presses during the cooldown
+    // (Dragon's Ascent) override these. Defaults to CanUseAbility1/2.
+    virtual bool CanFireAbility1() const { return CanUseAbility1(); }
+    virtual bool CanFireAbility2() const { return CanUseAbility2(); }
+
+    // Alive, out of action recovery and nothing waiting in the input buffer; AI uses this to pace its presses
+    UFUNCTION(BlueprintPure, Category = "Abilities")
+    bool IsReadyForCombatInput() const;
+
     UFUNCTION(BlueprintPure, Category = "Abilities")
     float GetAbility1CooldownPercentage() const;
 
@@ -577,18 +812,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Combat")
     virtual void ApplyKnockback(FVector KnockbackDirection, float Force);
 
-    // Networked knockback - called on server, replicated to all clients
-    UFUNCTION(NetMulticast, Reliable, Category = "Combat")
-    void MulticastApplyKnockback(FVector KnockbackDirection, float Force);
+    // Lets the owning client start the same knockback curve the server is running, so its prediction matches
+    UFUNCTION(Client, Unreliable, Category = "Combat")
+    void ClientApplyKnockback(FVector_NetQuantizeNormal KnockbackDirection, float Force);
+
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    UBloodreadMovementComponent* GetBloodreadMovement() const;
 
     // Server-side knockback initiation (called from attacking player)
-    UFUNCTION(Server, Reliable, Category = "Combat")
+    UFUNCTION(Server, Reliable, WithValidation, Category = "Combat")
     void ServerApplyKnockback(FVector KnockbackDirection, float Force);
 
-    // Server RPC to apply knockback to another player (called by attacker)
-    UFUNCTION(Server, Reliable, Category = "Combat")
-    void ServerApplyKnockbackToTarget(ACharacter* TargetCharacter, FVector KnockbackDirection, float Force);
-
 private:
     // Internal knockback implementation (does the actual physics work)
     void ApplyKnockbackInternal(FVector KnockbackDirection, float Force);
@@ -612,9 +846,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Animation")
     void PlayAbility2Animation();
     
+    // Plays the animation through the class montage slot (montages are resolved once and cached)
     UFUNCTION(BlueprintCallable, Category = "Animation")
     bool PlayAnimationFromPath(const FString& AnimationPath);
 
+    // Play a class action montage locally and, on the server, replicate it to simulated proxies
+    UFUNCTION(BlueprintCallable, Category = "Animation")
+    bool PlayActionMontage(ECharacterAnimAction Action);
+
+protected:
+    // Local-only montage playback shared by PlayActionMontage and OnRep_MontageState; StartPosition is in seconds
+    bool PlayMontageLocal(UAnimMontage* Montage, float StartPosition = 0.0f);
+
+    UAnimMontage* GetActionMontage(ECharacterAnimAction Action) const;
+
+    // Dedicated server only: refresh bones for the duration of an attack so socket/bone hit queries are accurate
+    void BeginServerHitDetectionPose(float Duration);
+    void EndServerHitDetectionPose();
+
+    // Extra time bones stay live on the server after a montage ends (covers late hit notifies)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Animation")
+    float ServerHitDetectionPosePadding = 0.2f;
+
+    FTimerHandle ServerHitDetectionPoseTimer;
+
+public:
+
     // Animation event callbacks (called from Animation Notifies or Blueprint events)
     UFUNCTION(BlueprintImplementableEvent, Category = "Animation")
     void OnAttackHit();
@@ -667,13 +924,14 @@ protected:
     virtual void OnManaChanged(int32 OldMana, int32 NewMana) {}
 
 public:
-    // AI-related functions
-    virtual TArray<ABloodreadBaseCharacter*> GetEnemiesInRadius(float Radius) { return TArray<ABloodreadBaseCharacter*>(); }
-    virtual TArray<ABloodreadBaseCharacter*> GetAlliesInRadius(float Radius) { return TArray<ABloodreadBaseCharacter*>(); }
-    virtual TArray<ABloodreadBaseCharacter*> GetAllAllies() { return TArray<ABloodreadBaseCharacter*>(); }
-    virtual void ActivateAbility1() {}
-    virtual void ActivateAbility2() {}
-    virtual void PerformAttack() {}
+    // AI-related functions (living characters from the team registry, never including this one)
+    virtual TArray<ABloodreadBaseCharacter*> GetEnemiesInRadius(float Radius);
+    virtual TArray<ABloodreadBaseCharacter*> GetAlliesInRadius(float Radius);
+    virtual TArray<ABloodreadBaseCharacter*> GetAllAllies();
+    // Go through the combat input buffer, so AI obeys the same cooldown/mana/recovery gates as players
+    virtual void ActivateAbility1() { QueueCombatInput(ECharacterAnimAction::Ability1); }
+    virtual void ActivateAbility2() { QueueCombatInput(ECharacterAnimAction::Ability2); }
+    virtual void PerformAttack() { QueueCombatInput(ECharacterAnimAction::BasicAttack); }
     
     // Additional methods
     void ReactivateAnimationBlueprints();
@@ -683,4 +941,20 @@ public:
 
 private:
     void UpdateAbilityCooldowns(float DeltaTime);
+
+    // Keep this character's entry in the team registry in step with its team and alive state
+    void RefreshTeamMembership();
+
+    void ProcessCombatInputBuffer();
+    bool CanFireCombatInput(ECharacterAnimAction Action) const;
+    void FireCombatInput(const FBufferedCombatInput& Input);
+
+    // Owning-client side of a fired input: montage, Blueprint effects and the predicted cooldown
+    void PlayCombatInputCosmetics(ECharacterAnimAction Action);
+
+    // Server side: send the ability's real cooldown to a remote owner that predicted it
+    void SyncPredictedCooldown(ECharacterAnimAction Action);
+
+    // Server clock on every machine, so client press times mean the same thing to the server
+    double GetCombatClock() const;
 };
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "BloodreadBotController.h"
+#include "BloodreadBaseCharacter.h"
+#include "BloodreadBotSubsystem.h"
+#include "Components/StateTreeAIComponent.h"
+#include "StateTree.h"
+
+ABloodreadBotController::ABloodreadBotController(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    // Bots take a player slot (scoreboard, team balance) like a human would
+    bWantsPlayerState = true;
+
+    StateTreeAIComponent = CreateDefaultSubobject<UStateTreeAIComponent>(TEXT("StateTreeAIComponent"));
+
+    // The tree is chosen per class on possession
+    StateTreeAIComponent->SetStartLogicAutomatically(false);
+}
+
+ABloodreadBaseCharacter* ABloodreadBotController::GetBotCharacter() const
+{
+    return Cast<ABloodreadBaseCharacter>(GetPawn());
+}
+
+void ABloodreadBotController::OnPossess(APawn* InPawn)
+{
+    Super::OnPossess(InPawn);
+
+    HomeLocation = InPawn ? InPawn->GetActorLocation() : FVector::ZeroVector;
+
+    UBloodreadBotSubsystem* Bots = UBloodreadBotSubsystem::Get(this);
+    const ABloodreadBaseCharacter* BotCharacter = GetBotCharacter();
+    if (!Bots || !BotCharacter)
+    {
+        return;
+    }
+
+    Bots->RegisterBot(this);
+
+    UStateTree* StateTree = Bots->GetStateTreeForClass(BotCharacter->GetCharacterClass());
+    if (!StateTree)
+    {
+        UE_LOG(LogTemp, Error, TEXT("BloodreadBot: No StateTree for class %d, %s will stand idle"), (int32)BotCharacter->GetCharacterClass(), *GetName());
+        return;
+    }
+
+    StateTreeAIComponent->SetStateTree(StateTree);
+    StateTreeAIComponent->StartLogic();
+}
+
+void ABloodreadBotController::OnUnPossess()
+{
+    StateTreeAIComponent->StopLogic(TEXT("Unpossessed"));
+
+    if (UBloodreadBotSubsystem* Bots = UBloodreadBotSubsystem::Get(this))
+    {
+        Bots->UnregisterBot(this);
+    }
+
+    PerceivedTarget.Reset();
+    bTargetVisible = false;
+
+    Super::OnUnPossess();
+}
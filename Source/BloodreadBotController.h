@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "BloodreadBotController.generated.h"
+
+class UStateTreeAIComponent;
+class ABloodreadBaseCharacter;
+
+/**
+ * Server-side combat bot. Decisions come from a StateTree picked per character class (see
+ * UBloodreadBotSubsystem::GetStateTreeForClass); what the bot knows about the world comes from the batched
+ * perception in UBloodreadBotSubsystem rather than traces of its own. Attacks and abilities go through the
+ * character's input buffer, so bots obey exactly the cooldown and mana rules players do.
+ */
+UCLASS()
+class BLOODREADGAME_API ABloodreadBotController : public AAIController
+{
+    GENERATED_BODY()
+
+public:
+    ABloodreadBotController(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    UStateTreeAIComponent* GetStateTreeComponent() const { return StateTreeAIComponent; }
+
+    ABloodreadBaseCharacter* GetBotCharacter() const;
+
+    // Perception result, written by UBloodreadBotSubsystem
+    UFUNCTION(BlueprintPure, Category = "Bot")
+    ABloodreadBaseCharacter* GetPerceivedTarget() const { return PerceivedTarget.Get(); }
+
+    UFUNCTION(BlueprintPure, Category = "Bot")
+    bool HasLineOfSightToTarget() const { return bTargetVisible; }
+
+    // Where the bot was spawned; roaming stays near it
+    FVector GetHomeLocation() const { return HomeLocation; }
+
+protected:
+    virtual void OnPossess(APawn* InPawn) override;
+    virtual void OnUnPossess() override;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Bot")
+    TObjectPtr<UStateTreeAIComponent> StateTreeAIComponent;
+
+private:
+    friend class UBloodreadBotSubsystem;
+
+    TWeakObjectPtr<ABloodreadBaseCharacter> PerceivedTarget;
+    bool bTargetVisible = false;
+    FVector HomeLocation = FVector::ZeroVector;
+};
@@ -0,0 +1,367 @@
+#include "BloodreadBotSubsystem.h"
+#include "BloodreadBotController.h"
+#include "CharacterClassRegistry.h"
+#include "CharacterSelectionManager.h"
+#include "TeamSubsystem.h"
+#include "Components/StateTreeAIComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "Misc/CommandLine.h"
+#include "StateTree.h"
+
+namespace
+{
+    const TCHAR* BotsSection = TEXT("/Script/BloodreadGame.BloodreadBots");
+}
+
+void UBloodreadBotSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetFloat(BotsSection, TEXT("SightRadius"), SightRadius, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("AttackRange"), AttackRange, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("PerceptionInterval"), PerceptionInterval, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("NearDistance"), NearDistance, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("FarDistance"), FarDistance, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("NearDecisionInterval"), NearDecisionInterval, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("MidDecisionInterval"), MidDecisionInterval, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("FarDecisionInterval"), FarDecisionInterval, GGameIni);
+        GConfig->GetInt(BotsSection, TEXT("TargetPlayerCount"), TargetPlayerCount, GGameIni);
+        GConfig->GetInt(BotsSection, TEXT("LoadTestBots"), LoadTestBots, GGameIni);
+        GConfig->GetInt(BotsSection, TEXT("MaxBots"), MaxBots, GGameIni);
+        GConfig->GetFloat(BotsSection, TEXT("BackfillInterval"), BackfillInterval, GGameIni);
+    }
+
+    // Capacity test runs set the bot count per server instance
+    FParse::Value(FCommandLine::Get(), TEXT("BloodreadBots="), LoadTestBots);
+
+    PerceptionInterval = FMath::Max(0.05f, PerceptionInterval);
+    SightTraceDelegate.BindUObject(this, &UBloodreadBotSubsystem::OnSightTraceDone);
+    BackfillInterval = FMath::Max(0.5f, BackfillInterval);
+
+    if (LoadTestBots > 0 || TargetPlayerCount > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("BloodreadBots: %s"), LoadTestBots > 0
+               ? *FString::Printf(TEXT("Load test with %d bots"), FMath::Min(LoadTestBots, MaxBots))
+               : *FString::Printf(TEXT("Backfilling to %d players"), TargetPlayerCount));
+    }
+}
+
+void UBloodreadBotSubsystem::Deinitialize()
+{
+    Bots.Reset();
+    StateTrees.Reset();
+    Super::Deinitialize();
+}
+
+bool UBloodreadBotSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Bots only ever run where the match is simulated
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && World->GetNetMode() != NM_Client;
+}
+
+TStatId UBloodreadBotSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBloodreadBotSubsystem, STATGROUP_Tickables);
+}
+
+UBloodreadBotSubsystem* UBloodreadBotSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UBloodreadBotSubsystem>() : nullptr;
+}
+
+void UBloodreadBotSubsystem::RegisterBot(ABloodreadBotController* Bot)
+{
+    if (!Bot || Bots.ContainsByPredicate([Bot](const FBotRecord& Record) { return Record.Controller == Bot; }))
+    {
+        return;
+    }
+
+    FBotRecord& Record = Bots.AddDefaulted_GetRef();
+    Record.Controller = Bot;
+    ApplyLOD(Record, EBotLOD::Near);
+}
+
+void UBloodreadBotSubsystem::UnregisterBot(ABloodreadBotController* Bot)
+{
+    Bots.RemoveAllSwap([Bot](const FBotRecord& Record) { return Record.Controller == Bot; });
+}
+
+UStateTree* UBloodreadBotSubsystem::GetStateTreeForClass(ECharacterClass CharacterClass)
+{
+    if (const TObjectPtr<UStateTree>* Cached = StateTrees.Find(CharacterClass))
+    {
+        return Cached->Get();
+    }
+
+    // StateTree_<ClassName>, falling back to DefaultStateTree
+    FString Path;
+    const FString ClassKey = FString::Printf(TEXT("StateTree_%s"), *FCharacterClassRegistry::Get().GetDefinition(CharacterClass).ClassName);
+    if (GConfig && !GConfig->GetString(BotsSection, *ClassKey, Path, GGameIni))
+    {
+        GConfig->GetString(BotsSection, TEXT("DefaultStateTree"), Path, GGameIni);
+    }
+
+    UStateTree* StateTree = Path.IsEmpty() ? nullptr : LoadObject<UStateTree>(nullptr, *Path);
+    if (Path.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("BloodreadBots: No StateTree configured for %s; set DefaultStateTree or %s in [%s]"),
+               *FCharacterClassRegistry::Get().GetDefinition(CharacterClass).ClassName, *ClassKey, BotsSection);
+    }
+    else if (!StateTree)
+    {
+        UE_LOG(LogTemp, Error, TEXT("BloodreadBots: Failed to load StateTree from path: %s"), *Path);
+    }
+
+    // Cache misses too so a bad path only costs one load attempt
+    StateTrees.Add(CharacterClass, StateTree);
+    return StateTree;
+}
+
+ABloodreadBotController* UBloodreadBotSubsystem::SpawnBot(ECharacterClass CharacterClass)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    if (CharacterClass == ECharacterClass::None)
+    {
+        const TArray<ECharacterClass>& Classes = FCharacterClassRegistry::Get().GetAvailableClasses();
+        if (Classes.Num() == 0)
+        {
+            return nullptr;
+        }
+        CharacterClass = Classes[NextClassIndex++ % Classes.Num()];
+    }
+
+    // A bot without a tree would only stand in the match as a free kill
+    if (!GetStateTreeForClass(CharacterClass))
+    {
+        return nullptr;
+    }
+
+    TArray<const APlayerStart*> PlayerStarts;
+    for (TActorIterator<APlayerStart> It(World); It; ++It)
+    {
+        PlayerStarts.Add(*It);
+    }
+    const APlayerStart* Start = PlayerStarts.Num() > 0 ? PlayerStarts[FMath::RandHelper(PlayerStarts.Num())] : nullptr;
+    const FVector SpawnLocation = Start ? Start->GetActorLocation() : FVector(0.0f, 0.0f, 100.0f);
+    const FRotator SpawnRotation = Start ? Start->GetActorRotation() : FRotator::ZeroRotator;
+
+    ABloodreadBaseCharacter* Character = GetDefault<UCharacterSelectionManager>()->SpawnCharacterOfClass(World, CharacterClass, SpawnLocation, SpawnRotation);
+    if (!Character)
+    {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ABloodreadBotController* Bot = World->SpawnActor<ABloodreadBotController>(SpawnLocation, SpawnRotation, SpawnParams);
+    if (!Bot)
+    {
+        Character->Destroy();
+        return nullptr;
+    }
+
+    Bot->Possess(Character);
+    UE_LOG(LogTemp, Log, TEXT("BloodreadBots: Spawned %s as class %d"), *Character->GetName(), (int32)CharacterClass);
+    return Bot;
+}
+
+void UBloodreadBotSubsystem::RemoveBot(ABloodreadBotController* Bot)
+{
+    if (!Bot)
+    {
+        return;
+    }
+
+    APawn* BotPawn = Bot->GetPawn();
+    Bot->UnPossess();
+    if (BotPawn)
+    {
+        BotPawn->Destroy();
+    }
+    Bot->Destroy();
+}
+
+int32 UBloodreadBotSubsystem::CountHumanPlayers() const
+{
+    // Bots never get a PlayerController
+    const UWorld* World = GetWorld();
+    return World ? World->GetNumPlayerControllers() : 0;
+}
+
+int32 UBloodreadBotSubsystem::GetDesiredBotCount() const
+{
+    const int32 Desired = LoadTestBots > 0 ? LoadTestBots : (TargetPlayerCount > 0 ? TargetPlayerCount - CountHumanPlayers() : 0);
+    return FMath::Clamp(Desired, 0, MaxBots);
+}
+
+void UBloodreadBotSubsystem::UpdateBackfill()
+{
+    const int32 Desired = GetDesiredBotCount();
+
+    // One change per check so a big difference doesn't spawn a wave of characters in a single frame
+    if (Bots.Num() < Desired)
+    {
+        SpawnBot();
+    }
+    else if (Bots.Num() > Desired)
+    {
+        RemoveBot(Bots.Last().Controller.Get());
+    }
+}
+
+void UBloodreadBotSubsystem::ApplyLOD(FBotRecord& Record, EBotLOD NewLOD)
+{
+    Record.LOD = NewLOD;
+
+    ABloodreadBotController* Bot = Record.Controller.Get();
+    UStateTreeAIComponent* StateTreeComponent = Bot ? Bot->GetStateTreeComponent() : nullptr;
+    if (!StateTreeComponent)
+    {
+        return;
+    }
+
+    switch (NewLOD)
+    {
+        case EBotLOD::Near: StateTreeComponent->SetComponentTickInterval(NearDecisionInterval); break;
+        case EBotLOD::Mid:  StateTreeComponent->SetComponentTickInterval(MidDecisionInterval); break;
+        case EBotLOD::Far:  StateTreeComponent->SetComponentTickInterval(FarDecisionInterval); break;
+    }
+}
+
+void UBloodreadBotSubsystem::UpdatePerception()
+{
+    UWorld* World = GetWorld();
+    const UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(World);
+    if (!World || !Teams)
+    {
+        return;
+    }
+
+    // Human positions once per pass for every bot's LOD
+    TArray<FVector, TInlineAllocator<16>> HumanLocations;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APawn* HumanPawn = It->IsValid() ? (*It)->GetPawn() : nullptr)
+        {
+            HumanLocations.Add(HumanPawn->GetActorLocation());
+        }
+    }
+
+    TArray<ABloodreadBaseCharacter*> Enemies;
+    for (int32 Index = Bots.Num() - 1; Index >= 0; --Index)
+    {
+        FBotRecord& Record = Bots[Index];
+        ABloodreadBotController* Bot = Record.Controller.Get();
+        ABloodreadBaseCharacter* BotCharacter = Bot ? Bot->GetBotCharacter() : nullptr;
+        if (!BotCharacter)
+        {
+            Bots.RemoveAtSwap(Index);
+            continue;
+        }
+
+        const FVector BotLocation = BotCharacter->GetActorLocation();
+
+        float NearestHumanSquared = TNumericLimits<float>::Max();
+        for (const FVector& HumanLocation : HumanLocations)
+        {
+            NearestHumanSquared = FMath::Min(NearestHumanSquared, static_cast<float>(FVector::DistSquared(BotLocation, HumanLocation)));
+        }
+        const EBotLOD LOD = NearestHumanSquared <= FMath::Square(NearDistance) ? EBotLOD::Near
+                          : NearestHumanSquared <= FMath::Square(FarDistance) ? EBotLOD::Mid : EBotLOD::Far;
+        if (LOD != Record.LOD)
+        {
+            ApplyLOD(Record, LOD);
+        }
+
+        // Nearest living enemy from the team registry
+        ABloodreadBaseCharacter* Target = nullptr;
+        if (BotCharacter->GetIsAlive())
+        {
+            Enemies.Reset();
+            Teams->GetEnemiesInRadius(BotCharacter, SightRadius, Enemies);
+            double BestDistanceSquared = TNumericLimits<double>::Max();
+            for (ABloodreadBaseCharacter* Enemy : Enemies)
+            {
+                const double DistanceSquared = FVector::DistSquared(BotLocation, Enemy->GetActorLocation());
+                if (DistanceSquared < BestDistanceSquared)
+                {
+                    BestDistanceSquared = DistanceSquared;
+                    Target = Enemy;
+                }
+            }
+        }
+
+        if (Target != Bot->PerceivedTarget.Get())
+        {
+            Bot->PerceivedTarget = Target;
+            Bot->bTargetVisible = false;
+        }
+
+        // Far bots nobody is watching skip the trace and assume sight
+        if (!Target || LOD == EBotLOD::Far)
+        {
+            Bot->bTargetVisible = Target != nullptr;
+            continue;
+        }
+
+        // Queued with the engine's async traces; OnSightTraceDone reports back next frame
+        FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BloodreadBotSight), false, BotCharacter);
+        QueryParams.AddIgnoredActor(Target);
+        Record.PendingTrace = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, BotCharacter->GetPawnViewLocation(),
+                                                             Target->GetActorLocation(), ECC_Visibility, QueryParams,
+                                                             FCollisionResponseParams::DefaultResponseParam, &SightTraceDelegate);
+        Record.TracedTarget = Target;
+    }
+}
+
+void UBloodreadBotSubsystem::OnSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceData)
+{
+    FBotRecord* Record = Bots.FindByPredicate([&TraceHandle](const FBotRecord& Candidate) { return Candidate.PendingTrace == TraceHandle; });
+    ABloodreadBotController* Bot = Record ? Record->Controller.Get() : nullptr;
+    if (!Bot)
+    {
+        return;
+    }
+
+    Record->PendingTrace = FTraceHandle();
+
+    // Only counts if the bot is still after the target the trace was fired at
+    if (Record->TracedTarget == Bot->PerceivedTarget)
+    {
+        Bot->bTargetVisible = !TraceData.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+    }
+}
+
+void UBloodreadBotSubsystem::Tick(float DeltaTime)
+{
+    TimeSincePerception += DeltaTime;
+    if (TimeSincePerception >= PerceptionInterval)
+    {
+        TimeSincePerception = 0.0f;
+        UpdatePerception();
+    }
+
+    TimeSinceBackfill += DeltaTime;
+    if (TimeSinceBackfill >= BackfillInterval)
+    {
+        TimeSinceBackfill = 0.0f;
+        UpdateBackfill();
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BloodreadBaseCharacter.h"
+#include "WorldCollision.h"
+#include "BloodreadBotSubsystem.generated.h"
+
+class ABloodreadBotController;
+class UStateTree;
+
+// How often a bot thinks, from the distance to the nearest human
+UENUM(BlueprintType)
+enum class EBotLOD : uint8
+{
+    Near    UMETA(DisplayName = "Near"),
+    Mid     UMETA(DisplayName = "Mid"),
+    Far     UMETA(DisplayName = "Far")
+};
+
+/**
+ * Server-side bot management.
+ *  - Perception: every PerceptionInterval all bots are updated in one pass. Targets come from the team
+ *    registry's enemy queries (no world scans); line of sight uses async traces, one per Near/Mid bot per pass,
+ *    which the engine runs as a batch and reports back the following frame.
+ *  - AI LOD: each bot's StateTree tick interval follows the distance to the nearest human player, so bots
+ *    nobody can see make decisions a few times a second instead of every frame.
+ *  - Backfill and load: keeps bots in the match until humans + bots reaches TargetPlayerCount, and removes them
+ *    as humans join. LoadTestBots (or -BloodreadBots=N on the command line) spawns a fixed number instead.
+ * StateTrees per class and all tuning come from [/Script/BloodreadGame.BloodreadBots] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UBloodreadBotSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UBloodreadBotSubsystem* Get(const UObject* WorldContextObject);
+
+    void RegisterBot(ABloodreadBotController* Bot);
+    void UnregisterBot(ABloodreadBotController* Bot);
+
+    // StateTree for a class (class-specific entry, else DefaultStateTree); loaded once and cached
+    UStateTree* GetStateTreeForClass(ECharacterClass CharacterClass);
+
+    // Spawn one bot of a class at a player start (None picks the next class in rotation)
+    UFUNCTION(BlueprintCallable, Category = "Bot")
+    ABloodreadBotController* SpawnBot(ECharacterClass CharacterClass = ECharacterClass::None);
+
+    UFUNCTION(BlueprintCallable, Category = "Bot")
+    void RemoveBot(ABloodreadBotController* Bot);
+
+    UFUNCTION(BlueprintPure, Category = "Bot")
+    int32 GetBotCount() const { return Bots.Num(); }
+
+    float GetAttackRange() const { return AttackRange; }
+
+private:
+    struct FBotRecord
+    {
+        TWeakObjectPtr<ABloodreadBotController> Controller;
+        EBotLOD LOD = EBotLOD::Near;
+        FTraceHandle PendingTrace;
+        TWeakObjectPtr<ABloodreadBaseCharacter> TracedTarget;
+    };
+
+    void UpdatePerception();
+    void OnSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceData);
+    void UpdateBackfill();
+    void ApplyLOD(FBotRecord& Record, EBotLOD NewLOD);
+    int32 CountHumanPlayers() const;
+    int32 GetDesiredBotCount() const;
+
+    // Enemies are looked for within this radius (cm)
+    float SightRadius = 3000.0f;
+
+    // Bots try to close to this distance before attacking (cm)
+    float AttackRange = 200.0f;
+
+    // Seconds between perception passes
+    float PerceptionInterval = 0.2f;
+
+    // Nearest-human distance bands (cm) for AI LOD
+    float NearDistance = 3000.0f;
+    float FarDistance = 8000.0f;
+
+    // StateTree tick interval per LOD (seconds, 0 = every frame)
+    float NearDecisionInterval = 0.0f;
+    float MidDecisionInterval = 0.25f;
+    float FarDecisionInterval = 1.0f;
+
+    // Fill matches up to this many players with bots (0 = off)
+    int32 TargetPlayerCount = 0;
+
+    // Fixed bot count for capacity testing (0 = off; overrides backfill)
+    int32 LoadTestBots = 0;
+
+    // Upper bound on bots from either source
+    int32 MaxBots = 16;
+
+    // Seconds between backfill checks
+    float BackfillInterval = 2.0f;
+
+    UPROPERTY()
+    TMap<ECharacterClass, TObjectPtr<UStateTree>> StateTrees;
+
+    TArray<FBotRecord> Bots;
+    FTraceDelegate SightTraceDelegate;
+    float TimeSincePerception = 0.0f;
+    float TimeSinceBackfill = 0.0f;
+    int32 NextClassIndex = 0;
+};
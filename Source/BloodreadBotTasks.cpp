@@ -0,0 +1,179 @@
+#include "BloodreadBotTasks.h"
+#include "BloodreadBaseCharacter.h"
+#include "BloodreadBotController.h"
+#include "BloodreadBotSubsystem.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "StateTreeExecutionContext.h"
+
+namespace
+{
+    float GetBotAttackRange(const UObject* WorldContextObject)
+    {
+        const UBloodreadBotSubsystem* Bots = UBloodreadBotSubsystem::Get(WorldContextObject);
+        return Bots ? Bots->GetAttackRange() : 200.0f;
+    }
+}
+
+// --- Perception ---
+
+void FStateTreeBloodreadBotPerceptionEvaluator::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    const ABloodreadBotController* Bot = Cast<ABloodreadBotController>(InstanceData.AIController);
+    const ABloodreadBaseCharacter* BotCharacter = Bot ? Bot->GetBotCharacter() : nullptr;
+    ABloodreadBaseCharacter* Target = Bot ? Bot->GetPerceivedTarget() : nullptr;
+    if (!BotCharacter || (Target && !Target->GetIsAlive()))
+    {
+        Target = nullptr;
+    }
+
+    InstanceData.Target = Target;
+    InstanceData.TargetDistance = Target ? FVector::Dist(BotCharacter->GetActorLocation(), Target->GetActorLocation()) : 0.0f;
+    InstanceData.bHasLineOfSight = Target && Bot->HasLineOfSightToTarget();
+    InstanceData.bInAttackRange = Target && InstanceData.TargetDistance <= GetBotAttackRange(Bot);
+    InstanceData.bCanUseAbility1 = BotCharacter && BotCharacter->CanFireAbility1();
+    InstanceData.bCanUseAbility2 = BotCharacter && BotCharacter->CanFireAbility2();
+}
+
+// --- Chase ---
+
+EStateTreeRunStatus FStateTreeBloodreadBotChaseTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (!InstanceData.AIController || !InstanceData.Target)
+    {
+        return EStateTreeRunStatus::Failed;
+    }
+
+    const float Radius = InstanceData.AcceptanceRadius > 0.0f ? InstanceData.AcceptanceRadius : GetBotAttackRange(InstanceData.AIController);
+    InstanceData.AIController->MoveToActor(InstanceData.Target, Radius * 0.8f);
+    return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FStateTreeBloodreadBotChaseTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    AAIController* AIController = InstanceData.AIController;
+    const APawn* BotPawn = AIController ? AIController->GetPawn() : nullptr;
+    if (!BotPawn || !InstanceData.Target || !InstanceData.Target->GetIsAlive())
+    {
+        return EStateTreeRunStatus::Failed;
+    }
+
+    const float Radius = InstanceData.AcceptanceRadius > 0.0f ? InstanceData.AcceptanceRadius : GetBotAttackRange(AIController);
+    if (FVector::DistSquared(BotPawn->GetActorLocation(), InstanceData.Target->GetActorLocation()) <= FMath::Square(Radius))
+    {
+        return EStateTreeRunStatus::Succeeded;
+    }
+
+    // Path following gives up on a moving goal now and then; pick it back up
+    if (AIController->GetMoveStatus() == EPathFollowingStatus::Idle)
+    {
+        AIController->MoveToActor(InstanceData.Target, Radius * 0.8f);
+    }
+    return EStateTreeRunStatus::Running;
+}
+
+void FStateTreeBloodreadBotChaseTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (InstanceData.AIController)
+    {
+        InstanceData.AIController->StopMovement();
+    }
+}
+
+// --- Attack ---
+
+EStateTreeRunStatus FStateTreeBloodreadBotAttackTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (!InstanceData.AIController || !InstanceData.Target)
+    {
+        return EStateTreeRunStatus::Failed;
+    }
+
+    InstanceData.AIController->SetFocus(InstanceData.Target);
+    return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FStateTreeBloodreadBotAttackTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    AAIController* AIController = InstanceData.AIController;
+    ABloodreadBaseCharacter* BotCharacter = AIController ? Cast<ABloodreadBaseCharacter>(AIController->GetPawn()) : nullptr;
+    const ABloodreadBaseCharacter* Target = InstanceData.Target;
+    if (!BotCharacter || !BotCharacter->GetIsAlive() || !Target)
+    {
+        return EStateTreeRunStatus::Failed;
+    }
+    if (!Target->GetIsAlive())
+    {
+        return EStateTreeRunStatus::Succeeded;
+    }
+
+    const float LeashRange = GetBotAttackRange(AIController) * InstanceData.LeashMultiplier;
+    if (FVector::DistSquared(BotCharacter->GetActorLocation(), Target->GetActorLocation()) > FMath::Square(LeashRange))
+    {
+        return EStateTreeRunStatus::Failed;
+    }
+
+    // One press per recovery window: queueing every tick would keep the buffer full and re-run its checks for nothing.
+    // The buffer still applies the same cooldown, mana and recovery rules a player's presses get.
+    if (!BotCharacter->IsReadyForCombatInput())
+    {
+        return EStateTreeRunStatus::Running;
+    }
+
+    ECharacterAnimAction Action = ECharacterAnimAction::BasicAttack;
+    if (InstanceData.bUseAbilities && BotCharacter->CanFireAbility2())
+    {
+        Action = ECharacterAnimAction::Ability2;
+    }
+    else if (InstanceData.bUseAbilities && BotCharacter->CanFireAbility1())
+    {
+        Action = ECharacterAnimAction::Ability1;
+    }
+    BotCharacter->QueueCombatInput(Action);
+
+    return EStateTreeRunStatus::Running;
+}
+
+void FStateTreeBloodreadBotAttackTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (InstanceData.AIController)
+    {
+        InstanceData.AIController->ClearFocus(EAIFocusPriority::Gameplay);
+    }
+}
+
+// --- Roam ---
+
+EStateTreeRunStatus FStateTreeBloodreadBotRoamTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    const ABloodreadBotController* Bot = Cast<ABloodreadBotController>(InstanceData.AIController);
+    if (!Bot)
+    {
+        return EStateTreeRunStatus::Failed;
+    }
+
+    const FVector2D Offset = FMath::RandPointInCircle(InstanceData.RoamRadius);
+    const FVector Destination = Bot->GetHomeLocation() + FVector(Offset.X, Offset.Y, 0.0f);
+
+    // Projected onto the navmesh by the move request itself
+    const EPathFollowingRequestResult::Type Result = InstanceData.AIController->MoveToLocation(Destination);
+    return Result == EPathFollowingRequestResult::Failed ? EStateTreeRunStatus::Failed : EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FStateTreeBloodreadBotRoamTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (!InstanceData.AIController)
+    {
+        return EStateTreeRunStatus::Failed;
+    }
+    return InstanceData.AIController->GetMoveStatus() == EPathFollowingStatus::Idle ? EStateTreeRunStatus::Succeeded : EStateTreeRunStatus::Running;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeEvaluatorBase.h"
+#include "StateTreeTaskBase.h"
+#include "BloodreadBotTasks.generated.h"
+
+class AAIController;
+class ABloodreadBaseCharacter;
+
+/*
+ * StateTree nodes for Bloodread bots (StateTree AI Component schema). Per-class trees are assets built from these:
+ * the perception evaluator publishes the bot's target and what it can do, and the tasks bind to those outputs.
+ */
+
+USTRUCT()
+struct FBloodreadBotPerceptionInstanceData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = "Context")
+    TObjectPtr<AAIController> AIController = nullptr;
+
+    // Nearest living enemy from UBloodreadBotSubsystem's last perception pass
+    UPROPERTY(EditAnywhere, Category = "Output")
+    TObjectPtr<ABloodreadBaseCharacter> Target = nullptr;
+
+    UPROPERTY(EditAnywhere, Category = "Output")
+    float TargetDistance = 0.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Output")
+    bool bHasLineOfSight = false;
+
+    UPROPERTY(EditAnywhere, Category = "Output")
+    bool bInAttackRange = false;
+
+    UPROPERTY(EditAnywhere, Category = "Output")
+    bool bCanUseAbility1 = false;
+
+    UPROPERTY(EditAnywhere, Category = "Output")
+    bool bCanUseAbility2 = false;
+};
+
+// Publishes the batched perception result for this bot; does no queries of its own
+USTRUCT(meta = (DisplayName = "Bloodread Bot Perception"))
+struct BLOODREADGAME_API FStateTreeBloodreadBotPerceptionEvaluator : public FStateTreeEvaluatorCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FBloodreadBotPerceptionInstanceData;
+
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+    virtual void Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+};
+
+USTRUCT()
+struct FBloodreadBotChaseInstanceData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = "Context")
+    TObjectPtr<AAIController> AIController = nullptr;
+
+    UPROPERTY(EditAnywhere, Category = "Input")
+    TObjectPtr<ABloodreadBaseCharacter> Target = nullptr;
+
+    // Stop this close to the target (cm); 0 uses the bot AttackRange from config. Ranged classes use more.
+    UPROPERTY(EditAnywhere, Category = "Parameter")
+    float AcceptanceRadius = 0.0f;
+};
+
+// Path towards the target; succeeds once within AcceptanceRadius, fails if the target is lost
+USTRUCT(meta = (DisplayName = "Bloodread Bot Chase"))
+struct BLOODREADGAME_API FStateTreeBloodreadBotChaseTask : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FBloodreadBotChaseInstanceData;
+
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+    virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+};
+
+USTRUCT()
+struct FBloodreadBotAttackInstanceData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = "Context")
+    TObjectPtr<AAIController> AIController = nullptr;
+
+    UPROPERTY(EditAnywhere, Category = "Input")
+    TObjectPtr<ABloodreadBaseCharacter> Target = nullptr;
+
+    // Spend mana on abilities when they are ready (Ability2 first), otherwise only basic attacks
+    UPROPERTY(EditAnywhere, Category = "Parameter")
+    bool bUseAbilities = true;
+
+    // Give up once the target is this much further than the attack range
+    UPROPERTY(EditAnywhere, Category = "Parameter")
+    float LeashMultiplier = 1.5f;
+};
+
+// Faces the target and feeds attacks/abilities into the character's input buffer
+USTRUCT(meta = (DisplayName = "Bloodread Bot Attack"))
+struct BLOODREADGAME_API FStateTreeBloodreadBotAttackTask : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FBloodreadBotAttackInstanceData;
+
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+    virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+};
+
+USTRUCT()
+struct FBloodreadBotRoamInstanceData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = "Context")
+    TObjectPtr<AAIController> AIController = nullptr;
+
+    // Wander this far from the bot's spawn point (cm)
+    UPROPERTY(EditAnywhere, Category = "Parameter")
+    float RoamRadius = 1500.0f;
+};
+
+// Walk to a random navigable point near home; succeeds on arrival
+USTRUCT(meta = (DisplayName = "Bloodread Bot Roam"))
+struct BLOODREADGAME_API FStateTreeBloodreadBotRoamTask : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FBloodreadBotRoamInstanceData;
+
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+};
@@ -1,4 +1,5 @@
 #include "BloodreadDragonCharacter.h"
+#include "BloodreadStats.h"
 #include "Engine/Engine.h"
 #include "Animation/AnimBlueprint.h"
 #include "Engine/StreamableManager.h"
@@ -7,6 +8,8 @@
 #include "Kismet/GameplayStatics.h"
 #include "Engine/DamageEvents.h"
 #include "PracticeDummy.h"
+#include "FrameScratch.h"
+#include "Net/UnrealNetwork.h"
 
 ABloodreadDragonCharacter::ABloodreadDragonCharacter()
 {
@@ -25,8 +28,7 @@ void ABloodreadDragonCharacter::BeginPlay()
     Super::BeginPlay();
     
     // Apply dragon-specific initialization
-    InitializeDragonData();
-    InitializeFromClassData(CharacterClassData);
+    InitializeFromClass(ECharacterClass::Dragon);
     
     // Ensure dragon air control is applied (better for aerial abilities)
     GetCharacterMovement()->AirControl = 0.8f; // Better air control for aerial maneuvers
@@ -49,11 +51,12 @@ void ABloodreadDragonCharacter::UseAbility1()
         // First press: Normal ability consumption (mana + cooldown)
         if (CanUseAbility1())
         {
-            if (UseMana(CharacterClassData.Ability1.ManaCost))
+            const FCharacterAbilityData& Ascent = GetClassDefinition().Ability1;
+            if (UseMana(Ascent.ManaCost))
             {
-                CharacterClassData.Ability1.CooldownRemaining = CharacterClassData.Ability1.Cooldown;
+                Ability1State.CooldownRemaining = Ascent.Cooldown;
                 OnAbility1Used();
-                UE_LOG(LogTemp, Warning, TEXT("Dragon Ascent First Press - Used Ability 1: %s"), *CharacterClassData.Ability1.Name);
+                UE_LOG(LogTemp, Warning, TEXT("Dragon Ascent First Press - Used Ability 1: %s"), *Ascent.Name);
             }
             else
             {
@@ -80,8 +83,26 @@ void ABloodreadDragonCharacter::UseAbility1()
     }
 }
 
+void ABloodreadDragonCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME_CONDITION(ABloodreadDragonCharacter, bAscentFirstPress, COND_OwnerOnly);
+}
+
+bool ABloodreadDragonCharacter::CanFireAbility1() const
+{
+    // bIsInAir is only tracked where the leap ran (the server); the owning client goes by its movement mode
+    if (bAscentFirstPress && GetIsAlive() && (bIsInAir || GetCharacterMovement()->IsFalling()))
+    {
+        return true;
+    }
+    return Super::CanFireAbility1();
+}
+
 bool ABloodreadDragonCharacter::OnAbility1Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility1Used();
     Ascent();
     return true;
@@ -89,6 +110,7 @@ bool ABloodreadDragonCharacter::OnAbility1Used()
 
 bool ABloodreadDragonCharacter::OnAbility2Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility2Used();
     KingsGreed();
     return true;
@@ -160,8 +182,8 @@ void ABloodreadDragonCharacter::PerformAscentLeap()
     MegaJumpVelocity.Y = FMath::Sin(YawRadians) * AscentLaunchForce * ForwardMultiplier;
     MegaJumpVelocity.Z = AscentLaunchForce * HeightMultiplier * 1.8f; // Extra vertical boost for mega jump
     
-    // Launch the character with dramatic force
-    LaunchCharacter(MegaJumpVelocity, true, true);
+    // Launch the character with dramatic force (carried by the movement component's saved moves)
+    GetBloodreadMovement()->RequestAbilityLaunch(MegaJumpVelocity);
     
     // Set a timer to automatically reset ability state if player doesn't use second press
     GetWorldTimerManager().ClearTimer(AscentResetTimerHandle);
@@ -215,7 +237,7 @@ void ABloodreadDragonCharacter::PerformBlitzDown()
     FVector GroundSlamVelocity = GravityBiasedDirection * BlitzDownwardForce * 2.0f;
     
     // Apply the gravity-biased ground slam movement
-    LaunchCharacter(GroundSlamVelocity, true, true);
+    GetBloodreadMovement()->RequestAbilityLaunch(GroundSlamVelocity);
     
     // Clear the auto-reset timer since player used second press
     GetWorldTimerManager().ClearTimer(AscentResetTimerHandle);
@@ -230,6 +252,7 @@ void ABloodreadDragonCharacter::PerformBlitzDown()
 
 void ABloodreadDragonCharacter::Landed(const FHitResult& Hit)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::Landed(Hit);
     
     // Check if we're landing from an ascent ability
@@ -255,13 +278,13 @@ void ABloodreadDragonCharacter::Landed(const FHitResult& Hit)
             // Check for enemies within blitz radius when landing
             FVector LandingLocation = GetActorLocation();
             
-            TArray<FHitResult> HitResults;
+            TFrameScratch<FHitResult> HitResults(this);
             FCollisionShape Sphere = FCollisionShape::MakeSphere(BlitzRadius);
             FCollisionQueryParams QueryParams;
             QueryParams.AddIgnoredActor(this);
             
             bool bFoundTargets = GetWorld()->SweepMultiByChannel(
-                HitResults,
+                *HitResults,
                 LandingLocation,
                 LandingLocation + FVector(0, 0, 1),
                 FQuat::Identity,
@@ -272,7 +295,7 @@ void ABloodreadDragonCharacter::Landed(const FHitResult& Hit)
             
             if (bFoundTargets)
             {
-                for (const FHitResult& TargetHit : HitResults)
+                for (const FHitResult& TargetHit : *HitResults)
                 {
                     if (ABloodreadBaseCharacter* Enemy = Cast<ABloodreadBaseCharacter>(TargetHit.GetActor()))
                     {
@@ -296,7 +319,9 @@ void ABloodreadDragonCharacter::Landed(const FHitResult& Hit)
             
             // Take recoil damage from ground slam
             int32 RecoilDamage = static_cast<int32>(BlitzRecoilDamage);
-            CurrentHealth = FMath::Max(1, CurrentHealth - RecoilDamage); // Don't let it kill the dragon
+            FCombatantStats Stats = GetCombatantStats();
+            FCombatRules::ApplyNonLethalDamage(Stats, RecoilDamage); // Don't let it kill the dragon
+            SetCombatantStats(Stats);
             UE_LOG(LogTemp, Warning, TEXT("Dragon took %d recoil damage from ground slam"), RecoilDamage);
         }
     }
@@ -314,17 +339,15 @@ void ABloodreadDragonCharacter::KingsGreed()
     bKingsGreedActive = true;
     KingsGreedHitCount = 0;
     
-    // Apply 30% movement speed immediately
-    float CurrentSpeed = GetCharacterMovement()->MaxWalkSpeed;
-    GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed * (1.0f + MovementSpeedBonus);
+    // Apply 30% movement speed immediately - the movement component times it out itself
+    GetBloodreadMovement()->ApplySpeedBuff(1.0f + MovementSpeedBonus, GreedDuration);
     
     // Set timer for base duration
-    GetWorldTimerManager().SetTimer(GreedTimerHandle, [this, CurrentSpeed]()
+    GetWorldTimerManager().SetTimer(GreedTimerHandle, [this]()
     {
         // End King's Greed
         bKingsGreedActive = false;
         KingsGreedHitCount = 0;
-        GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed;
         
         UE_LOG(LogTemp, Warning, TEXT("King's Greed ended"));
     }, GreedDuration, false);
@@ -345,17 +368,16 @@ void ABloodreadDragonCharacter::OnKingsGreedHit()
         bDamageBoostActive = true;
         
         // Extend both movement speed and add damage boost for 5 more seconds
-        float CurrentSpeed = GetCharacterMovement()->MaxWalkSpeed / (1.0f + MovementSpeedBonus); // Get base speed
+        GetBloodreadMovement()->ApplySpeedBuff(1.0f + MovementSpeedBonus, 5.0f);
         
         // Clear existing timer and set new extended timer
         GetWorldTimerManager().ClearTimer(GreedTimerHandle);
-        GetWorldTimerManager().SetTimer(GreedTimerHandle, [this, CurrentSpeed]()
+        GetWorldTimerManager().SetTimer(GreedTimerHandle, [this]()
         {
             // End all effects
             bKingsGreedActive = false;
             bDamageBoostActive = false;
             KingsGreedHitCount = 0;
-            GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed;
             
             UE_LOG(LogTemp, Warning, TEXT("King's Greed (enhanced) ended"));
         }, 5.0f, false); // 5 more seconds
@@ -413,62 +435,6 @@ void ABloodreadDragonCharacter::Attack()
 
 void ABloodreadDragonCharacter::InitializeDragonData()
 {
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Dragon;
-    
-    // Initialize dragon stats (based on new specification)
-    FCharacterStats DragonStats;
-    DragonStats.MaxHealth = 100;   // 100 base health
-    DragonStats.Strength = 12;     // Medium strength
-    DragonStats.Defense = 8;       // Medium defense
-    DragonStats.Speed = 12;        // Medium speed
-    DragonStats.Mana = 120;        // Starting mana
-    DragonStats.CriticalChance = 0.15f; // Medium crit chance
-    
-    // Initialize dragon abilities (new system)
-    FCharacterAbilityData AscentAbility;
-    AscentAbility.Name = "Ascent";
-    AscentAbility.Description = "Two-part leap and blitz ability for aerial combat";
-    AscentAbility.Type = EAbilityType::Movement;
-    AscentAbility.Cooldown = 30.0f;  // 30 second cooldown
-    AscentAbility.ManaCost = 100;    // Costs 100 mana
-    AscentAbility.Damage = BlitzDamage; // Damage on blitz landing
-    AscentAbility.Duration = 0.0f;   // Variable duration based on usage
-    
-    FCharacterAbilityData KingsGreedAbility;
-    KingsGreedAbility.Name = "King's Greed";
-    KingsGreedAbility.Description = "Gain movement speed, potential damage boost from consecutive hits";
-    KingsGreedAbility.Type = EAbilityType::Buff;
-    KingsGreedAbility.Cooldown = 30.0f;  // 30 second cooldown
-    KingsGreedAbility.ManaCost = 50;     // Costs 50 mana
-    KingsGreedAbility.Damage = 0.0f;     // No direct damage
-    KingsGreedAbility.Duration = GreedDuration; // Base 10 seconds
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Dragon;
-    CharacterClassData.ClassName = "Dragon";
-    CharacterClassData.Description = "A powerful aerial combatant with leap attacks and greed-based power scaling";
-    CharacterClassData.BaseStats = DragonStats;
-    CharacterClassData.Ability1 = AscentAbility;
-    CharacterClassData.Ability2 = KingsGreedAbility;
-    
-    // Set dragon mesh (Yin character - mystical dragon-like figure)
-    CharacterClassData.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Meshes/Yin.Yin")));
-    
-    // Set dragon animation blueprint path (will be loaded later by the system)
-    CharacterClassData.AnimationBlueprintPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Yin_AnimBlueprint.Yin_AnimBlueprint_C");
-    UE_LOG(LogTemp, Warning, TEXT("Set Yin animation blueprint path: %s"), *CharacterClassData.AnimationBlueprintPath);
-    
-    // Set dragon attack animation paths (using actual existing animation files)
-    CharacterClassData.BasicAttackAnimationPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Animations/Primary_Attack_A_Slow.Primary_Attack_A_Slow");
-    CharacterClassData.Ability1AnimationPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Animations/Q_Pull_Kick.Q_Pull_Kick");
-    CharacterClassData.Ability2AnimationPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Animations/E_Ability_Attack_A.E_Ability_Attack_A");
-    
-    // Set camera offset adjusted for Yin character
-    CharacterClassData.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
-    
-    // Apply stats
-    CurrentStats = DragonStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
-}
\ No newline at end of file
+    // Stats, abilities, mesh and animation paths are defined once in FCharacterClassRegistry
+    BindClassDefinition(ECharacterClass::Dragon);
+}
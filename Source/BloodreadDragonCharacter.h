@@ -20,6 +20,10 @@ protected:
 
 public:
     virtual void UseAbility1() override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    // The Blitz Down press comes while the Ascent cooldown is running
+    virtual bool CanFireAbility1() const override;
 
     // Dragon-specific properties
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dragon")
@@ -49,8 +53,8 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dragon")
     int32 HitsRequiredForBonus = 5;
 
-    // Ascent ability state tracking
-    UPROPERTY()
+    // Ascent ability state tracking; the owner needs it to buffer the second press
+    UPROPERTY(Replicated)
     bool bAscentFirstPress = false;
 
     UPROPERTY()
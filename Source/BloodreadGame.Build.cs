@@ -23,17 +23,19 @@ public class BloodreadGame : ModuleRules
 			"Json",
 			"Sockets",
 			"OnlineSubsystem",
-			"OnlineSubsystemUtils",
-			"OnlineSubsystemSteam",
-			"AdvancedSessions",
-			"AdvancedSteamSessions"
+			"OnlineSubsystemUtils"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { 
-			"OnlineSubsystemSteam",
-			"AdvancedSessions",
-			"AdvancedSteamSessions"
-		});
+		// Steam sessions are only driven from client Blueprints; the dedicated server target leaves the plugins
+		// out so they are not loaded (or Steam initialised) at boot
+		if (Target.Type != TargetType.Server)
+		{
+			PrivateDependencyModuleNames.AddRange(new string[] {
+				"OnlineSubsystemSteam",
+				"AdvancedSessions",
+				"AdvancedSteamSessions"
+			});
+		}
 
 		PublicIncludePaths.AddRange(new string[] {
 			"BloodreadGame"
@@ -42,6 +44,6 @@ public class BloodreadGame : ModuleRules
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
 
-		// Steam multiplayer is enabled - dependencies added above
+		// Steam multiplayer is enabled for game and client targets - dependencies added above
 	}
 }
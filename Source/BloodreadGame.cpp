@@ -1,8 +1,36 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BloodreadGame.h"
+#include "BootProfiler.h"
 #include "Modules/ModuleManager.h"
+#include "Components/WidgetComponent.h"
+#include "GameFramework/Actor.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, BloodreadGame, "BloodreadGame" );
+IMPLEMENT_PRIMARY_GAME_MODULE( FBloodreadGameModule, BloodreadGame, "BloodreadGame" );
 
-DEFINE_LOG_CATEGORY(LogBloodreadGame)
\ No newline at end of file
+DEFINE_LOG_CATEGORY(LogBloodreadGame)
+
+namespace BloodreadCosmetics
+{
+#if !UE_SERVER
+    bool ShouldSkip(const AActor* Actor)
+    {
+        return IsServerProcess() || (Actor && Actor->GetNetMode() == NM_DedicatedServer);
+    }
+#endif
+
+    void StripWidgetComponents(AActor* Actor)
+    {
+        if (!Actor)
+        {
+            return;
+        }
+
+        TArray<UWidgetComponent*, TInlineAllocator<4>> WidgetComponents;
+        Actor->GetComponents<UWidgetComponent>(WidgetComponents);
+        for (UWidgetComponent* WidgetComponent : WidgetComponents)
+        {
+            WidgetComponent->DestroyComponent();
+        }
+    }
+}
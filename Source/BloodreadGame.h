@@ -3,6 +3,37 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "CoreGlobals.h"
+
+class AActor;
 
 /** Main log category used across the project */
-DECLARE_LOG_CATEGORY_EXTERN(LogBloodreadGame, Log, All);
\ No newline at end of file
+DECLARE_LOG_CATEGORY_EXTERN(LogBloodreadGame, Log, All);
+
+/**
+ * Dedicated servers never render, so health bar widgets, hit flashes and other cosmetic-only work are skipped there.
+ * In the server target (UE_SERVER) these checks are constant and the cosmetic branches compile out; other builds
+ * check -server at runtime, plus the world's net mode for dedicated servers in PIE.
+ */
+namespace BloodreadCosmetics
+{
+    // The whole process is a dedicated server (safe to call from constructors)
+    FORCEINLINE bool IsServerProcess()
+    {
+#if UE_SERVER
+        return true;
+#else
+        return IsRunningDedicatedServer();
+#endif
+    }
+
+    // Cosmetic work for this actor would never be seen
+#if UE_SERVER
+    FORCEINLINE bool ShouldSkip(const AActor*) { return true; }
+#else
+    BLOODREADGAME_API bool ShouldSkip(const AActor* Actor);
+#endif
+
+    // Destroys widget components on a server-side actor, including ones added by Blueprint defaults
+    BLOODREADGAME_API void StripWidgetComponents(AActor* Actor);
+}
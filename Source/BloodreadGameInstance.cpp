@@ -2,6 +2,7 @@
 #include "Engine/GameInstance.h"
 #include "Engine/Engine.h"
 #include "Http.h"
+#include "CharacterClassRegistry.h"
 
 DEFINE_LOG_CATEGORY(BloodreadGameInstanceLog);
 
@@ -13,6 +14,9 @@ UBloodreadGameInstance::UBloodreadGameInstance()
 void UBloodreadGameInstance::Init()
 {
     UGameInstance::Init();
+
+    // Build the shared class definition table once, before any character spawns
+    FCharacterClassRegistry::LoadDefinitionAsset();
     UE_LOG(BloodreadGameInstanceLog, Log, TEXT("BloodreadGameInstance initialized - using Blueprint-based Steam multiplayer"));
 }
 
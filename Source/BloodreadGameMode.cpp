@@ -1,4 +1,5 @@
 #include "BloodreadGameMode.h"
+#include "BloodreadStats.h"
 #include "BloodreadGameInstance.h"
 #include "BloodreadPlayerCharacter.h"
 #include "BloodreadBaseCharacter.h"
@@ -215,6 +216,7 @@ void ABloodreadGameMode::HandleCharacterSelection(int32 CharacterClassIndex, APl
 
 void ABloodreadGameMode::SpawnSelectedCharacter(ECharacterClass SelectedClass, APlayerController* PlayerController, int32 CharacterClassIndex)
 {
+    BLOODREAD_SCOPE(STAT_BloodreadSpawn);
     UE_LOG(LogTemp, Error, TEXT("🚨 SPAWN SELECTED CHARACTER CALLED 🚨"));
     UE_LOG(LogTemp, Warning, TEXT("SPAWN SELECTED: PlayerController: %s"), PlayerController ? *PlayerController->GetName() : TEXT("NULL"));
     UE_LOG(LogTemp, Warning, TEXT("SPAWN SELECTED: SelectedClass: %d"), (int32)SelectedClass);
@@ -289,6 +291,7 @@ ABloodreadBaseCharacter* ABloodreadGameMode::CreateCharacterOfClass(ECharacterCl
 
 void ABloodreadGameMode::SpawnNewCharacter(ECharacterClass SelectedClass, APlayerController* PlayerController, FVector SpawnLocation, FRotator SpawnRotation, int32 CharacterClassIndex)
 {
+    BLOODREAD_SCOPE(STAT_BloodreadSpawn);
     UE_LOG(LogTemp, Error, TEXT("🚨 SPAWN NEW CHARACTER CALLED 🚨"));
     UE_LOG(LogTemp, Warning, TEXT("=== SPAWNING NEW CHARACTER ==="));
     UE_LOG(LogTemp, Warning, TEXT("SPAWN: PlayerController: %s"), PlayerController ? *PlayerController->GetName() : TEXT("NULL"));
@@ -494,6 +497,7 @@ void ABloodreadGameMode::HidePlayerHUD()
 
 APawn* ABloodreadGameMode::SpawnDefaultPawnFor_Implementation(AController* NewPlayer, AActor* StartSpot)
 {
+    BLOODREAD_SCOPE(STAT_BloodreadSpawn);
     UE_LOG(LogTemp, Warning, TEXT("=== SpawnDefaultPawnFor called ==="));
     UE_LOG(LogTemp, Warning, TEXT("Deferring character spawn until character selection"));
     
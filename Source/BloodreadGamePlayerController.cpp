@@ -4,6 +4,7 @@
 
 
 #include "BloodreadGamePlayerController.h"
+#include "BloodreadMemory.h"
 #include "Blueprint/UserWidget.h"
 #include "Engine/Engine.h"
 #include "Engine/AssetManager.h"
@@ -13,6 +14,9 @@
 #include "BloodreadGameMode.h"
 #include "Camera/CameraComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "SkeletonBindingCache.h"
+#include "CombatChecksum.h"
+#include "RpcRateLimiter.h"
 
 
 ABloodreadGamePlayerController::ABloodreadGamePlayerController()
@@ -216,40 +220,8 @@ void ABloodreadGamePlayerController::InitializeCharacterMesh(ABloodreadBaseChara
    UE_LOG(LogTemp, Warning, TEXT("InitializeCharacterMesh: Starting mesh initialization for %s"), *InCharacter->GetName());
 
 
-   // Force the character to initialize its class data
+   // Idempotent: BeginPlay has normally applied the class already, so this only catches what is still pending
    InCharacter->ForceInitializeCharacterSystems();
-
-
-   // Try to find CharacterMesh0 component (commonly used in Blueprints)
-   if (USkeletalMeshComponent* CharacterMesh0 = InCharacter->FindComponentByClass<USkeletalMeshComponent>())
-   {
-       UE_LOG(LogTemp, Warning, TEXT("Found SkeletalMeshComponent, applying class-based mesh"));
-      
-       ECharacterClass CharacterClass = InCharacter->GetCharacterClass();
-       if (InCharacter->ApplyClassDataToMeshComponent(CharacterMesh0, CharacterClass))
-       {
-           UE_LOG(LogTemp, Warning, TEXT("SUCCESS: Mesh applied to CharacterMesh0 component"));
-       }
-       else
-       {
-           UE_LOG(LogTemp, Error, TEXT("FAILED: Could not apply mesh to CharacterMesh0 component"));
-       }
-   }
-   else
-   {
-       UE_LOG(LogTemp, Warning, TEXT("No CharacterMesh0 found, using default character mesh"));
-      
-       // Fallback to the default character mesh
-       ECharacterClass CharacterClass = InCharacter->GetCharacterClass();
-       if (InCharacter->ApplyClassDataToMeshComponent(InCharacter->GetMesh(), CharacterClass))
-       {
-           UE_LOG(LogTemp, Warning, TEXT("SUCCESS: Mesh applied to default character mesh"));
-       }
-       else
-       {
-           UE_LOG(LogTemp, Error, TEXT("FAILED: Could not apply mesh to default character mesh"));
-       }
-   }
 }
 
 void ABloodreadGamePlayerController::InitializePlayerUI()
@@ -269,6 +241,7 @@ void ABloodreadGamePlayerController::InitializePlayerUI()
 
 void ABloodreadGamePlayerController::InitializeCharacterSelectionWidget()
 {
+   LLM_SCOPE_BYTAG(Bloodread_UI);
    UE_LOG(LogTemp, Warning, TEXT("=== InitializeCharacterSelectionWidget START ==="));
    
    // Only create UI for local players
@@ -422,55 +395,8 @@ void ABloodreadGamePlayerController::AttachCameraToHeadBone(ABloodreadBaseCharac
    
    UE_LOG(LogTemp, Warning, TEXT("AttachCameraToHeadBone: Attempting to attach camera to head bone"));
    
-   // Try common head bone names
-   TArray<FString> HeadBoneNames = {
-       TEXT("head"),
-       TEXT("Head"),
-       TEXT("HEAD"),
-       TEXT("head_01"),
-       TEXT("Head_01"),
-       TEXT("b_head"),
-       TEXT("B_Head"),
-       TEXT("Bip01_Head"),
-       TEXT("spine_03"),
-       TEXT("Spine_03")
-   };
-   
-   FName HeadBoneName = NAME_None;
-   
-   // Find the head bone
-   for (const FString& BoneName : HeadBoneNames)
-   {
-       FName TestBoneName(*BoneName);
-       if (MeshComponent->GetBoneIndex(TestBoneName) != INDEX_NONE)
-       {
-           HeadBoneName = TestBoneName;
-           UE_LOG(LogTemp, Warning, TEXT("AttachCameraToHeadBone: Found head bone: %s"), *BoneName);
-           break;
-       }
-   }
-   
-   if (HeadBoneName == NAME_None)
-   {
-       UE_LOG(LogTemp, Warning, TEXT("AttachCameraToHeadBone: No head bone found, listing all bones for reference:"));
-       
-       // List all available bones for debugging
-       const FReferenceSkeleton& RefSkeleton = MeshComponent->GetSkeletalMeshAsset()->GetRefSkeleton();
-       for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
-       {
-           FString BoneName = RefSkeleton.GetBoneName(BoneIndex).ToString();
-           UE_LOG(LogTemp, Warning, TEXT("Available bone %d: %s"), BoneIndex, *BoneName);
-           
-           // If we find any bone with "head" in the name, use it
-           if (BoneName.Contains(TEXT("head"), ESearchCase::IgnoreCase) || 
-               BoneName.Contains(TEXT("skull"), ESearchCase::IgnoreCase))
-           {
-               HeadBoneName = RefSkeleton.GetBoneName(BoneIndex);
-               UE_LOG(LogTemp, Warning, TEXT("AttachCameraToHeadBone: Using bone with 'head' in name: %s"), *BoneName);
-               break;
-           }
-       }
-   }
+   // Head bone is resolved once per mesh and cached (see FSkeletonBindingCache)
+   const FName HeadBoneName = FSkeletonBindingCache::Get().Resolve(MeshComponent->GetSkeletalMeshAsset()).GetName(EBloodreadSkeletonPoint::Head);
    
    // Try to find and attach the camera
    if (UCameraComponent* CameraComponent = PlayerCharacter->FindComponentByClass<UCameraComponent>())
@@ -509,6 +435,7 @@ void ABloodreadGamePlayerController::AttachCameraToHeadBone(ABloodreadBaseCharac
 
 void ABloodreadGamePlayerController::InitializeHealthBarWidget(ABloodreadBaseCharacter* PlayerCharacter)
 {
+   LLM_SCOPE_BYTAG(Bloodread_UI);
    if (!PlayerCharacter)
    {
        UE_LOG(LogTemp, Error, TEXT("InitializeHealthBarWidget: PlayerCharacter is null"));
@@ -807,4 +734,30 @@ void ABloodreadGamePlayerController::ServerRequestPossession_Implementation(APaw
     {
         UE_LOG(LogTemp, Error, TEXT("SERVER POSSESS: FAILED - Possession did not work"));
     }
-}
\ No newline at end of file
+}
+
+bool ABloodreadGamePlayerController::ServerReportCombatChecksum_Validate(uint32 Tick, uint32 SharedHash, uint32 OwnHash)
+{
+    return UCombatChecksumSubsystem::IsPlausibleReportTick(this, Tick);
+}
+
+void ABloodreadGamePlayerController::ServerReportCombatChecksum_Implementation(uint32 Tick, uint32 SharedHash, uint32 OwnHash)
+{
+    if (!URpcRateLimitSubsystem::Allow(this, ECombatRpc::CombatChecksum))
+    {
+        return;
+    }
+
+    if (UCombatChecksumSubsystem* Checksums = UCombatChecksumSubsystem::Get(this))
+    {
+        Checksums->VerifyClientChecksum(this, Tick, SharedHash, OwnHash);
+    }
+}
+
+void ABloodreadGamePlayerController::ClientDumpCombatState_Implementation(uint32 Tick)
+{
+    if (UCombatChecksumSubsystem* Checksums = UCombatChecksumSubsystem::Get(this))
+    {
+        Checksums->DumpTick(Tick, TEXT("Client"));
+    }
+}
@@ -50,6 +50,14 @@ public:
 	UFUNCTION(Server, Reliable, Category = "Character Selection")
 	void ServerRequestPossession(APawn* CharacterToPossess);
 
+	/** Desync detection: report this client's replicated-state and own-pawn hashes for a tick (see UCombatChecksumSubsystem) */
+	UFUNCTION(Server, Unreliable, WithValidation)
+	void ServerReportCombatChecksum(uint32 Tick, uint32 SharedHash, uint32 OwnHash);
+
+	/** Desync detection: server found a mismatch, write this client's state for the tick */
+	UFUNCTION(Client, Reliable)
+	void ClientDumpCombatState(uint32 Tick);
+
 protected:
 
 	/** Gameplay initialization */
@@ -16,5 +16,8 @@ public class BloodreadGameServerTarget : TargetRules
 		bUseLoggingInShipping = true;
 		bCompileWithStatsWithoutEngine = true;
 		bCompileWithPluginSupport = true;
+
+		// Nothing on the server uses Steam sessions; see DedicatedServerEngine.ini for the online subsystem it uses
+		DisablePlugins.AddRange(new string[] { "OnlineSubsystemSteam", "SteamSockets", "AdvancedSessions", "AdvancedSteamSessions" });
 	}
 }
\ No newline at end of file
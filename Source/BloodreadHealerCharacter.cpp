@@ -1,4 +1,5 @@
 #include "BloodreadHealerCharacter.h"
+#include "BloodreadStats.h"
 #include "Engine/Engine.h"
 #include "Animation/AnimBlueprint.h"
 #include "Engine/StreamableManager.h"
@@ -6,6 +7,8 @@
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/DamageEvents.h"
+#include "FrameScratch.h"
+#include "TeamSubsystem.h"
 
 ABloodreadHealerCharacter::ABloodreadHealerCharacter()
 {
@@ -20,8 +23,7 @@ void ABloodreadHealerCharacter::BeginPlay()
     Super::BeginPlay();
     
     // Apply healer-specific initialization
-    InitializeHealerData();
-    InitializeFromClassData(CharacterClassData);
+    InitializeFromClass(ECharacterClass::Healer);
 }
 
 void ABloodreadHealerCharacter::OnCharacterClassChanged()
@@ -32,6 +34,7 @@ void ABloodreadHealerCharacter::OnCharacterClassChanged()
 
 bool ABloodreadHealerCharacter::OnAbility1Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility1Used();
     Bond();
     return true;
@@ -39,6 +42,7 @@ bool ABloodreadHealerCharacter::OnAbility1Used()
 
 bool ABloodreadHealerCharacter::OnAbility2Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility2Used();
     Regeneration();
     return true;
@@ -77,8 +81,7 @@ void ABloodreadHealerCharacter::Bond()
                 // Calculate 50% of missing health
                 int32 CurrentTargetHealth = Target->GetCurrentHealthFloat();
                 int32 MaxTargetHealth = Target->GetMaxHealthFloat();
-                int32 MissingHealth = MaxTargetHealth - CurrentTargetHealth;
-                int32 HealAmount = FMath::RoundToInt(MissingHealth * 0.5f);
+                int32 HealAmount = FCombatRules::BondHealAmount(CurrentTargetHealth, MaxTargetHealth);
                 
                 // Heal the target
                 int32 NewHealth = FMath::Min(CurrentTargetHealth + HealAmount, MaxTargetHealth);
@@ -99,56 +102,51 @@ void ABloodreadHealerCharacter::Regeneration()
     // Note: Mana consumption and cooldown are already handled by BaseCharacter::UseAbility2()
     // This function is called from OnAbility2Used() after the base checks pass
     
-    // Find all characters in the world (teammates)
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABloodreadBaseCharacter::StaticClass(), FoundActors);
-    
-    for (AActor* Actor : FoundActors)
+    // Living teammates from the team registry (never includes self)
+    TFrameScratch<ABloodreadBaseCharacter*> Allies(this);
+    if (const UBloodreadTeamSubsystem* Teams = UBloodreadTeamSubsystem::Get(this))
+    {
+        Teams->GetAllies(this, *Allies);
+    }
+
+    for (ABloodreadBaseCharacter* Character : *Allies)
     {
-        if (ABloodreadBaseCharacter* Character = Cast<ABloodreadBaseCharacter>(Actor))
+        // Start regeneration timer for this character
+        FTimerHandle RegenTimerHandle;
+        
+        auto RegenFunction = [this, Character]()
         {
-            // TODO: Add team check when multiplayer is implemented
-            // For now, regenerate all characters except self
-            if (Character != this)
+            if (IsValid(Character))
             {
-                // Start regeneration timer for this character
-                FTimerHandle RegenTimerHandle;
+                int32 CurrentHealth = Character->GetCurrentHealthFloat();
+                int32 MaxHealth = Character->GetMaxHealthFloat();
                 
-                auto RegenFunction = [this, Character]()
+                if (CurrentHealth < MaxHealth)
                 {
-                    if (IsValid(Character))
-                    {
-                        int32 CurrentHealth = Character->GetCurrentHealthFloat();
-                        int32 MaxHealth = Character->GetMaxHealthFloat();
-                        
-                        if (CurrentHealth < MaxHealth)
-                        {
-                            int32 NewHealth = FMath::Min(CurrentHealth + TeamRegenRate, MaxHealth);
-                            Character->SetCurrentHealth(NewHealth);
-                            
-                            UE_LOG(LogTemp, Warning, TEXT("Regeneration healed %s for %d health"), 
-                                   *Character->GetName(), (int32)TeamRegenRate);
-                        }
-                    }
-                };
-                
-                // Set timer to regenerate every second for 10 seconds
-                GetWorldTimerManager().SetTimer(RegenTimerHandle, RegenFunction, 1.0f, true);
-                ActiveRegenTimers.Add(RegenTimerHandle);
-                
-                // Clear the timer after duration
-                FTimerHandle ClearTimerHandle;
-                GetWorldTimerManager().SetTimer(ClearTimerHandle, [this, Character, RegenFunction]()
-                {
-                    // Clear by finding the matching timer for this character
-                    for (int32 i = ActiveRegenTimers.Num() - 1; i >= 0; i--)
-                    {
-                        GetWorldTimerManager().ClearTimer(ActiveRegenTimers[i]);
-                        ActiveRegenTimers.RemoveAt(i);
-                    }
-                }, TeamRegenDuration, false);
+                    int32 NewHealth = FMath::Min(CurrentHealth + TeamRegenRate, MaxHealth);
+                    Character->SetCurrentHealth(NewHealth);
+                    
+                    UE_LOG(LogTemp, Warning, TEXT("Regeneration healed %s for %d health"), 
+                           *Character->GetName(), (int32)TeamRegenRate);
+                }
             }
-        }
+        };
+        
+        // Set timer to regenerate every second for 10 seconds
+        GetWorldTimerManager().SetTimer(RegenTimerHandle, RegenFunction, 1.0f, true);
+        ActiveRegenTimers.Add(RegenTimerHandle);
+        
+        // Clear the timer after duration
+        FTimerHandle ClearTimerHandle;
+        GetWorldTimerManager().SetTimer(ClearTimerHandle, [this, Character, RegenFunction]()
+        {
+            // Clear by finding the matching timer for this character
+            for (int32 i = ActiveRegenTimers.Num() - 1; i >= 0; i--)
+            {
+                GetWorldTimerManager().ClearTimer(ActiveRegenTimers[i]);
+                ActiveRegenTimers.RemoveAt(i);
+            }
+        }, TeamRegenDuration, false);
     }
     
     UE_LOG(LogTemp, Warning, TEXT("Regeneration activated for all teammates"));
@@ -197,62 +195,6 @@ void ABloodreadHealerCharacter::Attack()
 
 void ABloodreadHealerCharacter::InitializeHealerData()
 {
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Healer;
-    
-    // Initialize healer stats (based on new specification)
-    FCharacterStats HealerStats;
-    HealerStats.MaxHealth = 120;   // 120 base health
-    HealerStats.Strength = 6;      // Low strength
-    HealerStats.Defense = 8;       // Medium defense
-    HealerStats.Speed = 10;        // Medium speed
-    HealerStats.Mana = 150;        // High mana for healing
-    HealerStats.CriticalChance = 0.1f; // Low crit chance
-    
-    // Initialize healer abilities (new system)
-    FCharacterAbilityData BondAbility;
-    BondAbility.Name = "Bond";
-    BondAbility.Description = "Heal teammate for 50% of their missing health";
-    BondAbility.Type = EAbilityType::Heal;
-    BondAbility.Cooldown = 30.0f;  // 30 second cooldown
-    BondAbility.ManaCost = 100;    // Costs 100 mana
-    BondAbility.Damage = 0.0f;     // No damage, healing ability
-    BondAbility.Duration = 0.0f;   // Instant heal
-    
-    FCharacterAbilityData RegenerationAbility;
-    RegenerationAbility.Name = "Regeneration";
-    RegenerationAbility.Description = "Make all teammates regenerate health over time";
-    RegenerationAbility.Type = EAbilityType::Heal;
-    RegenerationAbility.Cooldown = 15.0f;  // 15 second cooldown
-    RegenerationAbility.ManaCost = 50;     // Costs 50 mana
-    RegenerationAbility.Damage = 0.0f;     // No damage, healing ability
-    RegenerationAbility.Duration = TeamRegenDuration; // 10 seconds of regeneration
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Healer;
-    CharacterClassData.ClassName = "Healer";
-    CharacterClassData.Description = "A support character specializing in healing and team regeneration";
-    CharacterClassData.BaseStats = HealerStats;
-    CharacterClassData.Ability1 = BondAbility;
-    CharacterClassData.Ability2 = RegenerationAbility;
-    
-    // Set healer mesh (Fey character - nature healer)
-    CharacterClassData.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Meshes/Fey.Fey")));
-    
-    // Set healer animation blueprint path (will be loaded later by the system)
-    CharacterClassData.AnimationBlueprintPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Fey_AnimBlueprint.Fey_AnimBlueprint_C");
-    UE_LOG(LogTemp, Warning, TEXT("Set Fey animation blueprint path: %s"), *CharacterClassData.AnimationBlueprintPath);
-    
-    // Set healer attack animation paths (using actual existing animation files)
-    CharacterClassData.BasicAttackAnimationPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Animations/Ability_LMB_A_Slow.Ability_LMB_A_Slow");
-    CharacterClassData.Ability1AnimationPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Animations/Ability_Q.Ability_Q");
-    CharacterClassData.Ability2AnimationPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Animations/Ability_E.Ability_E");
-    
-    // Set camera offset adjusted for Muriel character
-    CharacterClassData.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
-    
-    // Apply stats
-    CurrentStats = HealerStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
+    // Stats, abilities, mesh and animation paths are defined once in FCharacterClassRegistry
+    BindClassDefinition(ECharacterClass::Healer);
 }
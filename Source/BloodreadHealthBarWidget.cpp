@@ -1,4 +1,5 @@
 #include "BloodreadHealthBarWidget.h"
+#include "BloodreadStats.h"
 #include "BloodreadBaseCharacter.h"
 #include "BloodreadPlayerCharacter.h"
 #include "Components/ProgressBar.h"
@@ -192,6 +193,7 @@ void UBloodreadHealthBarWidget::InitializeHealthBar(ABloodreadBaseCharacter* Cha
 
 void UBloodreadHealthBarWidget::UpdateHealthDisplay()
 {
+    BLOODREAD_SCOPE(STAT_BloodreadHUD);
     // Log network mode details
     UWorld* World = GetWorld();
     bool bIsClient = World && (World->GetNetMode() == NM_Client || World->GetNetMode() == NM_Standalone);
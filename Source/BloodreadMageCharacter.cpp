@@ -1,9 +1,12 @@
 #include "BloodreadMageCharacter.h"
+#include "BloodreadStats.h"
 #include "Engine/Engine.h"
 #include "Animation/AnimBlueprint.h"
 #include "Engine/StreamableManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/DamageEvents.h"
+#include "CombatTickSubsystem.h"
+#include "FrameScratch.h"
 
 ABloodreadMageCharacter::ABloodreadMageCharacter()
 {
@@ -18,8 +21,7 @@ void ABloodreadMageCharacter::BeginPlay()
     Super::BeginPlay();
     
     // Apply mage-specific initialization
-    InitializeMageData();
-    InitializeFromClassData(CharacterClassData);
+    InitializeFromClass(ECharacterClass::Mage);
 }
 
 void ABloodreadMageCharacter::OnCharacterClassChanged()
@@ -30,6 +32,7 @@ void ABloodreadMageCharacter::OnCharacterClassChanged()
 
 bool ABloodreadMageCharacter::OnAbility1Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility1Used();
     FieryAura();
     return true;
@@ -37,15 +40,28 @@ bool ABloodreadMageCharacter::OnAbility1Used()
 
 bool ABloodreadMageCharacter::OnAbility2Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility2Used();
     Explosion();
     return true;
 }
 
-void ABloodreadMageCharacter::Tick(float DeltaTime)
+void ABloodreadMageCharacter::FixedCombatStep(float StepSeconds)
 {
-    Super::Tick(DeltaTime);
-    RegenerateMana(DeltaTime);
+    Super::FixedCombatStep(StepSeconds);
+    RegenerateMana(StepSeconds);
+
+    // Pulse auras on whole steps so the damage interval doesn't depend on tick rate
+    const UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this);
+    const int32 PulseIntervalSteps = CombatTick ? CombatTick->SecondsToSteps(AuraDamageInterval) : 1;
+    for (FMageFieryAura& Aura : ActiveAuras)
+    {
+        if (--Aura.StepsUntilPulse <= 0)
+        {
+            Aura.StepsUntilPulse = PulseIntervalSteps;
+            PulseFieryAura(Aura.Center);
+        }
+    }
 }
 
 void ABloodreadMageCharacter::FieryAura()
@@ -56,62 +72,60 @@ void ABloodreadMageCharacter::FieryAura()
     // Note: Mana consumption and cooldown are already handled by BaseCharacter::UseAbility1()
     // This function is called from OnAbility1Used() after the base checks pass
     
-    // Create a timer for the aura damage
-    FTimerHandle AuraTimerHandle;
-    FVector AuraCenter = GetActorLocation();
+    // Auras pulse from FixedCombatStep, first damage one interval after placement (as the looping timer did)
+    const FVector AuraCenter = GetActorLocation();
+    const UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this);
+
+    FMageFieryAura& Aura = ActiveAuras.AddDefaulted_GetRef();
+    Aura.Center = AuraCenter;
+    Aura.StepsUntilPulse = CombatTick ? CombatTick->SecondsToSteps(AuraDamageInterval) : 1;
+    
+    UE_LOG(LogTemp, Warning, TEXT("Fiery Aura created at %s with %f radius"), *AuraCenter.ToString(), AuraRadius);
+}
+
+void ABloodreadMageCharacter::PulseFieryAura(const FVector& AuraCenter)
+{
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
+    // Find all enemies within aura radius
+    TFrameScratch<FHitResult> HitResults(this);
+    FVector StartLocation = AuraCenter;
+    FVector EndLocation = StartLocation + FVector(0, 0, 1); // Small vertical offset for sphere trace
+    
+    FCollisionShape Sphere = FCollisionShape::MakeSphere(AuraRadius);
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(this);
+    
+    bool bHit = GetWorld()->SweepMultiByChannel(
+        *HitResults,
+        StartLocation,
+        EndLocation,
+        FQuat::Identity,
+        ECC_Pawn,
+        Sphere,
+        QueryParams
+    );
     
-    // Function to handle aura damage
-    auto AuraDamageFunction = [this, AuraCenter]()
+    if (bHit)
     {
-        // Find all enemies within aura radius
-        TArray<FHitResult> HitResults;
-        FVector StartLocation = AuraCenter;
-        FVector EndLocation = StartLocation + FVector(0, 0, 1); // Small vertical offset for sphere trace
-        
-        FCollisionShape Sphere = FCollisionShape::MakeSphere(AuraRadius);
-        FCollisionQueryParams QueryParams;
-        QueryParams.AddIgnoredActor(this);
-        
-        bool bHit = GetWorld()->SweepMultiByChannel(
-            HitResults,
-            StartLocation,
-            EndLocation,
-            FQuat::Identity,
-            ECC_Pawn,
-            Sphere,
-            QueryParams
-        );
-        
-        if (bHit)
+        for (const FHitResult& Hit : *HitResults)
         {
-            for (const FHitResult& Hit : HitResults)
+            if (ABloodreadBaseCharacter* Enemy = Cast<ABloodreadBaseCharacter>(Hit.GetActor()))
             {
-                if (ABloodreadBaseCharacter* Enemy = Cast<ABloodreadBaseCharacter>(Hit.GetActor()))
+                if (Enemy != this) // Don't damage self
                 {
-                    if (Enemy != this) // Don't damage self
-                    {
-                        // Use enhanced damage system with light knockback
-                        FVector KnockbackDirection = (Enemy->GetActorLocation() - GetActorLocation()).GetSafeNormal();
-                        float KnockbackForce = 200.0f; // Light knockback for DOT effect
-                        Enemy->DealDamageWithKnockback(1.0f, KnockbackDirection, KnockbackForce, this);
-                        
-                        // Mage gains 20 mana per damage dealt
-                        CurrentMana = FMath::Min(CurrentMana + 20, 500); // Cap at reasonable limit
-                        
-                        UE_LOG(LogTemp, Warning, TEXT("Fiery Aura damaged %s, mage gained 20 mana (current: %d)"), *Enemy->GetName(), CurrentMana);
-                    }
+                    // Use enhanced damage system with light knockback
+                    FVector KnockbackDirection = (Enemy->GetActorLocation() - GetActorLocation()).GetSafeNormal();
+                    float KnockbackForce = 200.0f; // Light knockback for DOT effect
+                    Enemy->DealDamageWithKnockback(1.0f, KnockbackDirection, KnockbackForce, this);
+                    
+                    // Mage gains 20 mana per damage dealt
+                    CurrentMana = FMath::Min(CurrentMana + 20, 500); // Cap at reasonable limit
+                    
+                    UE_LOG(LogTemp, Warning, TEXT("Fiery Aura damaged %s, mage gained 20 mana (current: %d)"), *Enemy->GetName(), CurrentMana);
                 }
             }
         }
-    };
-    
-    // Set timer to repeat damage every 0.5 seconds indefinitely (or until character dies/aura is destroyed)
-    GetWorldTimerManager().SetTimer(AuraTimerHandle, AuraDamageFunction, AuraDamageInterval, true);
-    
-    // Store the timer handle so we can track multiple auras
-    ActiveAuraTimers.Add(AuraTimerHandle);
-    
-    UE_LOG(LogTemp, Warning, TEXT("Fiery Aura created at %s with %f radius"), *AuraCenter.ToString(), AuraRadius);
+    }
 }
 
 void ABloodreadMageCharacter::Explosion()
@@ -125,13 +139,13 @@ void ABloodreadMageCharacter::Explosion()
     FVector ExplosionCenter = GetActorLocation();
     
     // Find all enemies within explosion radius
-    TArray<FHitResult> HitResults;
+    TFrameScratch<FHitResult> HitResults(this);
     FCollisionShape Sphere = FCollisionShape::MakeSphere(ExplosionRadius);
     FCollisionQueryParams QueryParams;
     QueryParams.AddIgnoredActor(this);
     
     bool bHit = GetWorld()->SweepMultiByChannel(
-        HitResults,
+        *HitResults,
         ExplosionCenter,
         ExplosionCenter + FVector(0, 0, 1),
         FQuat::Identity,
@@ -142,7 +156,7 @@ void ABloodreadMageCharacter::Explosion()
     
     if (bHit)
     {
-        for (const FHitResult& Hit : HitResults)
+        for (const FHitResult& Hit : *HitResults)
         {
             if (ABloodreadBaseCharacter* Enemy = Cast<ABloodreadBaseCharacter>(Hit.GetActor()))
             {
@@ -207,64 +221,8 @@ void ABloodreadMageCharacter::Attack()
 
 void ABloodreadMageCharacter::InitializeMageData()
 {
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Mage;
-    
-    // Initialize mage stats (based on new specification)
-    FCharacterStats MageStats;
-    MageStats.MaxHealth = 100;     // 100 base health
-    MageStats.Strength = 6;        // Low strength
-    MageStats.Defense = 4;         // Low defense
-    MageStats.Speed = 12;          // High speed
-    MageStats.Mana = 150;          // Starting mana
-    MageStats.CriticalChance = 0.2f; // Higher crit for spells
-    
-    // Initialize mage abilities (new system)
-    FCharacterAbilityData FieryAuraAbility;
-    FieryAuraAbility.Name = "Fiery Aura";
-    FieryAuraAbility.Description = "Spawn a spherical aura that deals damage and grants mana";
-    FieryAuraAbility.Type = EAbilityType::Damage;
-    FieryAuraAbility.Cooldown = 2.0f;   // 2 second cooldown
-    FieryAuraAbility.ManaCost = 100;    // Costs 100 mana
-    FieryAuraAbility.Damage = 1.0f;     // Deals 1 damage per tick
-    FieryAuraAbility.Duration = 0.0f;   // Permanent until destroyed
-    
-    FCharacterAbilityData ExplosionAbility;
-    ExplosionAbility.Name = "Explosion";
-    ExplosionAbility.Description = "Deal knockback and damage in omnidirectional radius";
-    ExplosionAbility.Type = EAbilityType::Damage;
-    ExplosionAbility.Cooldown = 30.0f;  // 30 second cooldown
-    ExplosionAbility.ManaCost = 50;     // Costs 50 mana
-    ExplosionAbility.Damage = 10.0f;    // Deals 10 damage
-    ExplosionAbility.Duration = 0.0f;   // Instant effect
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Mage;
-    CharacterClassData.ClassName = "Mage";
-    CharacterClassData.Description = "A powerful spellcaster with aura creation and explosive abilities";
-    CharacterClassData.BaseStats = MageStats;
-    CharacterClassData.Ability1 = FieryAuraAbility;
-    CharacterClassData.Ability2 = ExplosionAbility;
-    
-    // Set mage mesh (Aurora character)
-    CharacterClassData.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Meshes/Aurora.Aurora")));
-    
-    // Set mage animation blueprint path (will be loaded later by the system)
-    CharacterClassData.AnimationBlueprintPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Aurora_AnimBlueprint.Aurora_AnimBlueprint_C");
-    UE_LOG(LogTemp, Warning, TEXT("Set Aurora animation blueprint path: %s"), *CharacterClassData.AnimationBlueprintPath);
-    
-    // Set mage attack animation paths (using actual existing animation files)
-    CharacterClassData.BasicAttackAnimationPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Primary_Attack_Slow_A.Primary_Attack_Slow_A");
-    CharacterClassData.Ability1AnimationPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Ability_Q.Ability_Q");
-    CharacterClassData.Ability2AnimationPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Ability_E.Ability_E");
-    
-    // Set camera offset adjusted for Aurora character
-    CharacterClassData.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
-    
-    // Apply stats
-    CurrentStats = MageStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
+    // Stats, abilities, mesh and animation paths are defined once in FCharacterClassRegistry
+    BindClassDefinition(ECharacterClass::Mage);
 }
 
 void ABloodreadMageCharacter::RegenerateMana(float DeltaTime)
@@ -273,8 +231,10 @@ void ABloodreadMageCharacter::RegenerateMana(float DeltaTime)
     if (CurrentMana < CurrentStats.Mana)
     {
         int32 OldMana = CurrentMana;
-        float ManaToAdd = 10.0f * DeltaTime; // 10 mana per second
-        CurrentMana = FMath::Min(CurrentStats.Mana, CurrentMana + FMath::RoundToInt(ManaToAdd));
+        ManaRegenRemainder += 10.0f * DeltaTime; // 10 mana per second
+        const int32 ManaToAdd = FMath::FloorToInt(ManaRegenRemainder);
+        ManaRegenRemainder -= ManaToAdd;
+        CurrentMana = FMath::Min(CurrentStats.Mana, CurrentMana + ManaToAdd);
         
         if (CurrentMana != OldMana)
         {
@@ -4,6 +4,20 @@
 #include "BloodreadBaseCharacter.h"
 #include "BloodreadMageCharacter.generated.h"
 
+// A placed Fiery Aura, pulsing on the fixed combat step
+USTRUCT()
+struct FMageFieryAura
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FVector Center = FVector::ZeroVector;
+
+    // Combat steps until the next damage pulse
+    UPROPERTY()
+    int32 StepsUntilPulse = 0;
+};
+
 UCLASS()
 class BLOODREADGAME_API ABloodreadMageCharacter : public ABloodreadBaseCharacter
 {
@@ -18,7 +32,7 @@ protected:
     public:
     virtual bool OnAbility1Used() override;
     virtual bool OnAbility2Used() override;
-    virtual void Tick(float DeltaTime) override;
+    virtual void FixedCombatStep(float StepSeconds) override;
 
     // Mage-specific properties
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mage")
@@ -35,7 +49,7 @@ protected:
 
     // Active aura tracking
     UPROPERTY()
-    TArray<FTimerHandle> ActiveAuraTimers;
+    TArray<FMageFieryAura> ActiveAuras;
 
 public:
     // Mage-specific abilities
@@ -54,4 +68,8 @@ public:
 
 private:
     void RegenerateMana(float DeltaTime);
+    void PulseFieryAura(const FVector& AuraCenter);
+
+    // Fractional mana carried between steps (regen per step is well under one point)
+    float ManaRegenRemainder = 0.0f;
 };
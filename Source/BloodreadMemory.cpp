@@ -0,0 +1,175 @@
+#include "BloodreadMemory.h"
+#include "BloodreadBaseCharacter.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+LLM_DEFINE_TAG(Bloodread_Characters);
+LLM_DEFINE_TAG(Bloodread_Abilities);
+LLM_DEFINE_TAG(Bloodread_UI);
+LLM_DEFINE_TAG(Bloodread_ServerManager);
+LLM_DEFINE_TAG(Bloodread_SessionBrowser);
+
+namespace
+{
+    const TCHAR* MemoryBudgetsSection = TEXT("/Script/BloodreadGame.MemoryBudgets");
+
+    struct FGameTag
+    {
+        const TCHAR* Label;
+        const TCHAR* BudgetKey;
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+        const FLLMTagDeclaration* Declaration;
+#endif
+    };
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    #define BLOODREAD_GAME_TAG(Label, BudgetKey, TagName) { TEXT(Label), TEXT(BudgetKey), &LLMTagDeclaration_##TagName }
+#else
+    #define BLOODREAD_GAME_TAG(Label, BudgetKey, TagName) { TEXT(Label), TEXT(BudgetKey) }
+#endif
+
+    const FGameTag GameTags[] =
+    {
+        BLOODREAD_GAME_TAG("Characters", "CharactersMB", Bloodread_Characters),
+        BLOODREAD_GAME_TAG("Abilities", "AbilitiesMB", Bloodread_Abilities),
+        BLOODREAD_GAME_TAG("UI", "UIMB", Bloodread_UI),
+        BLOODREAD_GAME_TAG("ServerManager", "ServerManagerMB", Bloodread_ServerManager),
+        BLOODREAD_GAME_TAG("SessionBrowser", "SessionBrowserMB", Bloodread_SessionBrowser),
+    };
+
+    #undef BLOODREAD_GAME_TAG
+
+    int64 ReadBudgetBytes(const TCHAR* Key, double BytesPerUnit)
+    {
+        float Budget = 0.0f;
+        if (GConfig)
+        {
+            GConfig->GetFloat(MemoryBudgetsSection, Key, Budget, GGameIni);
+        }
+        return static_cast<int64>(FMath::Max(0.0f, Budget) * BytesPerUnit);
+    }
+
+    double ToKB(int64 Bytes) { return Bytes / 1024.0; }
+    double ToMB(int64 Bytes) { return Bytes / (1024.0 * 1024.0); }
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+        TEXT("bloodread.MemReport"),
+        TEXT("Per-tag game memory (needs -llm) and per-character footprint, checked against [MemoryBudgets]"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            UBloodreadMemoryReport::WriteReport(World, Ar);
+        }));
+}
+
+TArray<FBloodreadMemoryTagUsage> UBloodreadMemoryReport::GetTagUsage()
+{
+    TArray<FBloodreadMemoryTagUsage> Usage;
+    for (const FGameTag& GameTag : GameTags)
+    {
+        FBloodreadMemoryTagUsage& Entry = Usage.AddDefaulted_GetRef();
+        Entry.Tag = GameTag.Label;
+        Entry.BudgetBytes = ReadBudgetBytes(GameTag.BudgetKey, 1024.0 * 1024.0);
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+        if (FLowLevelMemTracker::IsEnabled())
+        {
+            Entry.Bytes = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, GameTag.Declaration->GetUniqueName(), ELLMTagSet::None);
+        }
+#endif
+    }
+    return Usage;
+}
+
+TArray<FBloodreadCharacterFootprint> UBloodreadMemoryReport::GetCharacterFootprints(const UObject* WorldContextObject)
+{
+    TArray<FBloodreadCharacterFootprint> Footprints;
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    if (!World)
+    {
+        return Footprints;
+    }
+
+    for (TActorIterator<ABloodreadBaseCharacter> It(World); It; ++It)
+    {
+        ABloodreadBaseCharacter* Character = *It;
+
+        FBloodreadCharacterFootprint& Footprint = Footprints.AddDefaulted_GetRef();
+        Footprint.Name = Character->GetName();
+        Footprint.ClassName = Character->GetClass()->GetName();
+        Footprint.ActorBytes = Character->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+
+        for (const UActorComponent* Component : Character->GetComponents())
+        {
+            if (Component)
+            {
+                ++Footprint.ComponentCount;
+                Footprint.ComponentBytes += Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+            }
+        }
+    }
+    return Footprints;
+}
+
+bool UBloodreadMemoryReport::CheckMemoryBudgets(const UObject* WorldContextObject)
+{
+    return WriteReport(WorldContextObject ? WorldContextObject->GetWorld() : nullptr, *GLog);
+}
+
+bool UBloodreadMemoryReport::WriteReport(UWorld* World, FOutputDevice& Ar)
+{
+    bool bWithinBudget = true;
+
+    Ar.Logf(TEXT("=== Bloodread memory report (%s) ==="), World && World->GetNetMode() == NM_DedicatedServer ? TEXT("server") : TEXT("client"));
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    const bool bLLMEnabled = FLowLevelMemTracker::IsEnabled();
+#else
+    const bool bLLMEnabled = false;
+#endif
+    if (!bLLMEnabled)
+    {
+        Ar.Logf(TEXT("LLM is off (run with -llm); tag totals unavailable"));
+    }
+    else
+    {
+        for (const FBloodreadMemoryTagUsage& Usage : GetTagUsage())
+        {
+            if (Usage.IsOverBudget())
+            {
+                bWithinBudget = false;
+                Ar.Logf(ELogVerbosity::Error, TEXT("  %-16s %9.2f MB  OVER BUDGET (%.2f MB)"), *Usage.Tag, ToMB(Usage.Bytes), ToMB(Usage.BudgetBytes));
+            }
+            else if (Usage.BudgetBytes > 0)
+            {
+                Ar.Logf(TEXT("  %-16s %9.2f MB  (budget %.2f MB)"), *Usage.Tag, ToMB(Usage.Bytes), ToMB(Usage.BudgetBytes));
+            }
+            else
+            {
+                Ar.Logf(TEXT("  %-16s %9.2f MB"), *Usage.Tag, ToMB(Usage.Bytes));
+            }
+        }
+    }
+
+    const int64 PerCharacterBudget = ReadBudgetBytes(TEXT("PerCharacterKB"), 1024.0);
+    const TArray<FBloodreadCharacterFootprint> Footprints = GetCharacterFootprints(World);
+
+    int64 TotalBytes = 0;
+    Ar.Logf(TEXT("Characters: %d"), Footprints.Num());
+    for (const FBloodreadCharacterFootprint& Footprint : Footprints)
+    {
+        TotalBytes += Footprint.GetTotalBytes();
+
+        const bool bOverBudget = PerCharacterBudget > 0 && Footprint.GetTotalBytes() > PerCharacterBudget;
+        bWithinBudget &= !bOverBudget;
+        Ar.Logf(bOverBudget ? ELogVerbosity::Error : ELogVerbosity::Log, TEXT("  %-32s %-28s actor %7.1f KB, %2d components %8.1f KB, total %8.1f KB%s"),
+                *Footprint.Name, *Footprint.ClassName, ToKB(Footprint.ActorBytes), Footprint.ComponentCount, ToKB(Footprint.ComponentBytes),
+                ToKB(Footprint.GetTotalBytes()), bOverBudget ? TEXT("  OVER BUDGET") : TEXT(""));
+    }
+    if (Footprints.Num() > 0)
+    {
+        Ar.Logf(TEXT("  average %.1f KB per character, %.2f MB total"), ToKB(TotalBytes / Footprints.Num()), ToMB(TotalBytes));
+    }
+
+    Ar.Logf(TEXT("=== %s ==="), bWithinBudget ? TEXT("Within budget") : TEXT("Over budget"));
+    return bWithinBudget;
+}
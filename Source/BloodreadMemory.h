@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "BloodreadMemory.generated.h"
+
+/*
+ * Low-Level Memory Tracker tags for game code. Allocations inside an LLM_SCOPE_BYTAG(Bloodread_...) are charged to
+ * that tag; run with -llm to see them in "stat LLM", LLM CSVs and bloodread.MemReport. Compiled out with LLM.
+ */
+LLM_DECLARE_TAG_API(Bloodread_Characters, BLOODREADGAME_API);
+LLM_DECLARE_TAG_API(Bloodread_Abilities, BLOODREADGAME_API);
+LLM_DECLARE_TAG_API(Bloodread_UI, BLOODREADGAME_API);
+LLM_DECLARE_TAG_API(Bloodread_ServerManager, BLOODREADGAME_API);
+LLM_DECLARE_TAG_API(Bloodread_SessionBrowser, BLOODREADGAME_API);
+
+// Memory charged to one game LLM tag, against its budget
+USTRUCT(BlueprintType)
+struct FBloodreadMemoryTagUsage
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    FString Tag;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int64 Bytes = 0;
+
+    // 0 = no budget
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int64 BudgetBytes = 0;
+
+    bool IsOverBudget() const { return BudgetBytes > 0 && Bytes > BudgetBytes; }
+};
+
+// Estimated resident size of one character actor and its components
+USTRUCT(BlueprintType)
+struct FBloodreadCharacterFootprint
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    FString Name;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    FString ClassName;
+
+    // The actor object itself (exclusive, no shared assets)
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int64 ActorBytes = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int32 ComponentCount = 0;
+
+    // Sum of the components' exclusive sizes (widgets, meshes, movement, ...)
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int64 ComponentBytes = 0;
+
+    int64 GetTotalBytes() const { return ActorBytes + ComponentBytes; }
+};
+
+/**
+ * Memory budget report for servers and clients: per-tag LLM totals and a per-character footprint, checked against
+ * the budgets in [/Script/BloodreadGame.MemoryBudgets] in DefaultGame.ini.
+ * Console: bloodread.MemReport. Automation (functional tests, Gauntlet): CheckMemoryBudgets, which logs the same report
+ * and errors for every budget exceeded.
+ */
+UCLASS()
+class BLOODREADGAME_API UBloodreadMemoryReport : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    // Current bytes per game tag (all zero unless running with -llm)
+    UFUNCTION(BlueprintCallable, Category = "Memory")
+    static TArray<FBloodreadMemoryTagUsage> GetTagUsage();
+
+    UFUNCTION(BlueprintCallable, Category = "Memory", meta = (WorldContext = "WorldContextObject"))
+    static TArray<FBloodreadCharacterFootprint> GetCharacterFootprints(const UObject* WorldContextObject);
+
+    // Log the full report; returns false if any tag or character is over budget
+    UFUNCTION(BlueprintCallable, Category = "Memory", meta = (WorldContext = "WorldContextObject"))
+    static bool CheckMemoryBudgets(const UObject* WorldContextObject);
+
+    static bool WriteReport(UWorld* World, FOutputDevice& Ar);
+};
@@ -0,0 +1,638 @@
+#include "BloodreadMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+const FName UBloodreadMovementComponent::KnockbackInstanceName(TEXT("BloodreadKnockback"));
+
+// --- FRootMotionSource_BloodreadKnockback ---
+
+FRootMotionSource_BloodreadKnockback::FRootMotionSource_BloodreadKnockback()
+{
+    // Velocity at the end of the curve carries on into normal falling/walking
+    FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::MaintainLastRootMotionVelocity;
+}
+
+FRootMotionSource* FRootMotionSource_BloodreadKnockback::Clone() const
+{
+    return new FRootMotionSource_BloodreadKnockback(*this);
+}
+
+bool FRootMotionSource_BloodreadKnockback::Matches(const FRootMotionSource* Other) const
+{
+    if (!FRootMotionSource::Matches(Other))
+    {
+        return false;
+    }
+
+    // Matches() already compared script structs, so the cast is safe
+    const FRootMotionSource_BloodreadKnockback* OtherKnockback = static_cast<const FRootMotionSource_BloodreadKnockback*>(Other);
+    return HorizontalVelocity.Equals(OtherKnockback->HorizontalVelocity, 1.0f)
+        && FMath::IsNearlyEqual(VerticalVelocity, OtherKnockback->VerticalVelocity, 1.0f)
+        && FMath::IsNearlyEqual(GravityZ, OtherKnockback->GravityZ);
+}
+
+bool FRootMotionSource_BloodreadKnockback::MatchesAndHasSameState(const FRootMotionSource* Other) const
+{
+    // Only time changes during playback, which the base class compares
+    return FRootMotionSource::MatchesAndHasSameState(Other) && Matches(Other);
+}
+
+FVector FRootMotionSource_BloodreadKnockback::GetOffsetAtTime(float Time) const
+{
+    const float T = FMath::Clamp(Time, 0.0f, Duration);
+
+    // Integral of V0 * (1 - t/D) dt
+    const float HorizontalScale = Duration > SMALL_NUMBER ? T - (T * T) / (2.0f * Duration) : 0.0f;
+    FVector Offset = FVector(HorizontalVelocity.X, HorizontalVelocity.Y, 0.0f) * HorizontalScale;
+    Offset.Z = VerticalVelocity * T + 0.5f * GravityZ * T * T;
+    return Offset;
+}
+
+void FRootMotionSource_BloodreadKnockback::PrepareRootMotion(float SimulationTime, float MovementTickTime, const ACharacter& Character, const UCharacterMovementComponent& MoveComponent)
+{
+    RootMotionParams.Clear();
+
+    if (Duration > SMALL_NUMBER && MovementTickTime > SMALL_NUMBER && SimulationTime > SMALL_NUMBER)
+    {
+        const float StartTime = GetTime();
+        const float EndTime = FMath::Min(StartTime + SimulationTime, Duration);
+        const FVector Displacement = GetOffsetAtTime(EndTime) - GetOffsetAtTime(StartTime);
+
+        // Root motion sources output velocity for the movement tick
+        FTransform NewTransform(Displacement / MovementTickTime);
+        RootMotionParams.Set(NewTransform);
+    }
+
+    SetTime(GetTime() + SimulationTime);
+}
+
+bool FRootMotionSource_BloodreadKnockback::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    if (!FRootMotionSource::NetSerialize(Ar, Map, bOutSuccess))
+    {
+        return false;
+    }
+
+    Ar << HorizontalVelocity;
+    Ar << VerticalVelocity;
+    Ar << GravityZ;
+
+    bOutSuccess = true;
+    return true;
+}
+
+UScriptStruct* FRootMotionSource_BloodreadKnockback::GetScriptStruct() const
+{
+    return FRootMotionSource_BloodreadKnockback::StaticStruct();
+}
+
+FString FRootMotionSource_BloodreadKnockback::ToSimpleString() const
+{
+    return FString::Printf(TEXT("[ID:%u]FRootMotionSource_BloodreadKnockback %s"), LocalID, *InstanceName.GetPlainNameString());
+}
+
+// --- Network move data ---
+
+void FBloodreadNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+    FCharacterNetworkMoveData::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+    const FSavedMove_Bloodread& BloodreadMove = static_cast<const FSavedMove_Bloodread&>(ClientMove);
+    AbilityLaunchVelocity = BloodreadMove.AbilityLaunchVelocity;
+    TeleportLocation = BloodreadMove.TeleportLocation;
+    TeleportYaw = BloodreadMove.TeleportYaw;
+    SpeedBuffMultiplier = BloodreadMove.RequestedSpeedBuffMultiplier;
+    SpeedBuffDuration = BloodreadMove.RequestedSpeedBuffDuration;
+}
+
+bool FBloodreadNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+    FCharacterNetworkMoveData::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+    // Payloads only go over the wire on the moves that carry the matching request
+    bool bLocalSuccess = true;
+    if (CompressedMoveFlags & UBloodreadMovementComponent::FLAG_AbilityLaunch)
+    {
+        AbilityLaunchVelocity.NetSerialize(Ar, PackageMap, bLocalSuccess);
+    }
+    if (CompressedMoveFlags & UBloodreadMovementComponent::FLAG_Teleport)
+    {
+        TeleportLocation.NetSerialize(Ar, PackageMap, bLocalSuccess);
+        uint16 CompressedYaw = FRotator::CompressAxisToShort(TeleportYaw);
+        Ar << CompressedYaw;
+        TeleportYaw = FRotator::DecompressAxisFromShort(CompressedYaw);
+    }
+    if (CompressedMoveFlags & UBloodreadMovementComponent::FLAG_SpeedBuff)
+    {
+        Ar << SpeedBuffMultiplier;
+        Ar << SpeedBuffDuration;
+    }
+
+    return !Ar.IsError() && bLocalSuccess;
+}
+
+FBloodreadNetworkMoveDataContainer::FBloodreadNetworkMoveDataContainer()
+{
+    NewMoveData = &MoveData[0];
+    PendingMoveData = &MoveData[1];
+    OldMoveData = &MoveData[2];
+}
+
+// --- FSavedMove_Bloodread ---
+
+FSavedMove_Bloodread::FSavedMove_Bloodread()
+{
+    Clear();
+}
+
+void FSavedMove_Bloodread::Clear()
+{
+    Super::Clear();
+
+    bWantsAbilityLaunch = false;
+    bWantsTeleport = false;
+    bWantsSpeedBuff = false;
+    AbilityLaunchVelocity = FVector::ZeroVector;
+    TeleportLocation = FVector::ZeroVector;
+    TeleportYaw = 0.0f;
+    RequestedSpeedBuffMultiplier = 1.0f;
+    RequestedSpeedBuffDuration = 0.0f;
+    SavedSpeedBuffMultiplier = 1.0f;
+    SavedSpeedBuffTimeRemaining = 0.0f;
+}
+
+uint8 FSavedMove_Bloodread::GetCompressedFlags() const
+{
+    uint8 Flags = Super::GetCompressedFlags();
+    if (bWantsAbilityLaunch)
+    {
+        Flags |= UBloodreadMovementComponent::FLAG_AbilityLaunch;
+    }
+    if (bWantsTeleport)
+    {
+        Flags |= UBloodreadMovementComponent::FLAG_Teleport;
+    }
+    if (bWantsSpeedBuff)
+    {
+        Flags |= UBloodreadMovementComponent::FLAG_SpeedBuff;
+    }
+    return Flags;
+}
+
+bool FSavedMove_Bloodread::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+    const FSavedMove_Bloodread* Other = static_cast<const FSavedMove_Bloodread*>(NewMove.Get());
+
+    // Moves that carry a request must reach the server on their own
+    if (bWantsAbilityLaunch || bWantsTeleport || bWantsSpeedBuff ||
+        Other->bWantsAbilityLaunch || Other->bWantsTeleport || Other->bWantsSpeedBuff)
+    {
+        return false;
+    }
+    if (SavedSpeedBuffMultiplier != Other->SavedSpeedBuffMultiplier)
+    {
+        return false;
+    }
+    return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Bloodread::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+    Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+    const UBloodreadMovementComponent* Movement = Cast<UBloodreadMovementComponent>(C->GetCharacterMovement());
+    if (!Movement)
+    {
+        return;
+    }
+
+    bWantsAbilityLaunch = Movement->bWantsAbilityLaunch;
+    bWantsTeleport = Movement->bWantsTeleport;
+    bWantsSpeedBuff = Movement->bWantsSpeedBuff;
+    AbilityLaunchVelocity = Movement->PendingAbilityLaunchVelocity;
+    TeleportLocation = Movement->PendingTeleportLocation;
+    TeleportYaw = Movement->PendingTeleportYaw;
+    RequestedSpeedBuffMultiplier = Movement->PendingSpeedBuffMultiplier;
+    RequestedSpeedBuffDuration = Movement->PendingSpeedBuffDuration;
+    SavedSpeedBuffMultiplier = Movement->SpeedBuffMultiplier;
+    SavedSpeedBuffTimeRemaining = Movement->SpeedBuffTimeRemaining;
+}
+
+void FSavedMove_Bloodread::PrepMoveFor(ACharacter* C)
+{
+    Super::PrepMoveFor(C);
+
+    UBloodreadMovementComponent* Movement = Cast<UBloodreadMovementComponent>(C->GetCharacterMovement());
+    if (!Movement)
+    {
+        return;
+    }
+
+    // Request flags come back through UpdateFromCompressedFlags; restore their payload and the buff state
+    Movement->PendingAbilityLaunchVelocity = AbilityLaunchVelocity;
+    Movement->PendingTeleportLocation = TeleportLocation;
+    Movement->PendingTeleportYaw = TeleportYaw;
+    Movement->PendingSpeedBuffMultiplier = RequestedSpeedBuffMultiplier;
+    Movement->PendingSpeedBuffDuration = RequestedSpeedBuffDuration;
+    Movement->SpeedBuffMultiplier = SavedSpeedBuffMultiplier;
+    Movement->SpeedBuffTimeRemaining = SavedSpeedBuffTimeRemaining;
+}
+
+FNetworkPredictionData_Client_Bloodread::FNetworkPredictionData_Client_Bloodread(const UCharacterMovementComponent& ClientMovement)
+    : Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Bloodread::AllocateNewMove()
+{
+    return FSavedMovePtr(new FSavedMove_Bloodread());
+}
+
+// --- UBloodreadMovementComponent ---
+
+UBloodreadMovementComponent::UBloodreadMovementComponent()
+{
+    bWantsAbilityLaunch = false;
+    bWantsTeleport = false;
+    bWantsSpeedBuff = false;
+
+    // Ability movement grants are sent to the owning client through this component
+    SetIsReplicatedByDefault(true);
+    SetNetworkMoveDataContainer(BloodreadMoveDataContainer);
+
+    // The proxy snapshot buffer is keyed on the server's transform update time, which is only replicated with this
+    // set (or with Linear smoothing)
+    bNetworkAlwaysReplicateTransformUpdateTimestamp = true;
+}
+
+FKnockbackTuning UBloodreadMovementComponent::GetKnockbackTuning(float HorizontalMultiplier) const
+{
+    FKnockbackTuning Tuning;
+    Tuning.HorizontalMultiplier = HorizontalMultiplier;
+    Tuning.VerticalRatio = KnockbackVerticalRatio;
+    Tuning.ForceForMaxDuration = KnockbackForceForMaxDuration;
+    Tuning.MinDuration = KnockbackMinDuration;
+    Tuning.MaxDuration = KnockbackMaxDuration;
+    return Tuning;
+}
+
+FKnockbackShape UBloodreadMovementComponent::ApplyKnockback(const FVector& Direction, float Force, float HorizontalMultiplier)
+{
+    const FKnockbackShape Shape = FCombatRules::ShapeKnockback(Direction, Force, GetKnockbackTuning(HorizontalMultiplier));
+
+    // A new hit replaces the current knockback rather than stacking with it
+    if (KnockbackSourceID != 0)
+    {
+        RemoveRootMotionSourceByID(KnockbackSourceID);
+        KnockbackSourceID = 0;
+    }
+
+    TSharedPtr<FRootMotionSource_BloodreadKnockback> Knockback = MakeShared<FRootMotionSource_BloodreadKnockback>();
+    Knockback->InstanceName = KnockbackInstanceName;
+    Knockback->AccumulateMode = ERootMotionAccumulateMode::Override;
+    Knockback->Priority = 500;
+    Knockback->Duration = Shape.Duration;
+    Knockback->HorizontalVelocity = Shape.HorizontalVelocity;
+    Knockback->VerticalVelocity = Shape.VerticalVelocity;
+    Knockback->GravityZ = GetGravityZ();
+
+    // Leave the ground immediately so the arc isn't clipped by walking mode
+    if (IsMovingOnGround())
+    {
+        SetMovementMode(MOVE_Falling);
+    }
+
+    KnockbackSourceID = ApplyRootMotionSource(Knockback);
+    return Shape;
+}
+
+bool UBloodreadMovementComponent::IsKnockbackActive() const
+{
+    return GetRootMotionSource(KnockbackInstanceName).IsValid();
+}
+
+void UBloodreadMovementComponent::RequestAbilityLaunch(const FVector& LaunchVelocity)
+{
+    if (IsServerForRemoteClient())
+    {
+        FBloodreadAbilityMoveGrant Grant;
+        Grant.Flag = FLAG_AbilityLaunch;
+        Grant.Vector = LaunchVelocity.GetClampedToMaxSize(MaxAbilityLaunchSpeed);
+        GrantAbilityMove(Grant);
+        return;
+    }
+
+    PendingAbilityLaunchVelocity = LaunchVelocity;
+    bWantsAbilityLaunch = true;
+}
+
+void UBloodreadMovementComponent::RequestTeleport(const FVector& Location, const FRotator& Rotation)
+{
+    FVector Destination = Location;
+    if (GetOwnerRole() == ROLE_Authority && !IsTeleportDestinationValid(Destination, Rotation))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("BloodreadMovement: Refused teleport to %s for %s"), *Location.ToString(), *GetNameSafe(CharacterOwner));
+        return;
+    }
+
+    if (IsServerForRemoteClient())
+    {
+        FBloodreadAbilityMoveGrant Grant;
+        Grant.Flag = FLAG_Teleport;
+        Grant.Vector = Destination;
+        Grant.Value = Rotation.Yaw;
+        GrantAbilityMove(Grant);
+        return;
+    }
+
+    PendingTeleportLocation = Destination;
+    PendingTeleportYaw = Rotation.Yaw;
+    bWantsTeleport = true;
+}
+
+void UBloodreadMovementComponent::ApplySpeedBuff(float Multiplier, float Duration)
+{
+    if (IsServerForRemoteClient())
+    {
+        FBloodreadAbilityMoveGrant Grant;
+        Grant.Flag = FLAG_SpeedBuff;
+        Grant.Value = FMath::Clamp(Multiplier, 0.0f, MaxSpeedBuffMultiplier);
+        Grant.Duration = FMath::Max(Duration, 0.0f);
+        GrantAbilityMove(Grant);
+        return;
+    }
+
+    PendingSpeedBuffMultiplier = Multiplier;
+    PendingSpeedBuffDuration = Duration;
+    bWantsSpeedBuff = true;
+}
+
+bool UBloodreadMovementComponent::IsServerForRemoteClient() const
+{
+    return CharacterOwner && GetOwnerRole() == ROLE_Authority && !CharacterOwner->IsLocallyControlled()
+        && CharacterOwner->GetRemoteRole() == ROLE_AutonomousProxy;
+}
+
+void UBloodreadMovementComponent::GrantAbilityMove(FBloodreadAbilityMoveGrant Grant)
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    PendingGrants.RemoveAll([Now](const FBloodreadAbilityMoveGrant& Existing) { return Existing.ExpiresAt < Now; });
+
+    Grant.ExpiresAt = Now + AbilityGrantTimeout;
+    PendingGrants.Add(Grant);
+    ClientAbilityMoveGranted(Grant);
+}
+
+bool UBloodreadMovementComponent::ClaimGrant(uint8 Flag, FBloodreadAbilityMoveGrant& OutGrant)
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    PendingGrants.RemoveAll([Now](const FBloodreadAbilityMoveGrant& Existing) { return Existing.ExpiresAt < Now; });
+
+    const int32 Index = PendingGrants.IndexOfByPredicate([Flag](const FBloodreadAbilityMoveGrant& Existing) { return Existing.Flag == Flag; });
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutGrant = PendingGrants[Index];
+    PendingGrants.RemoveAt(Index);
+    return true;
+}
+
+void UBloodreadMovementComponent::ClientAbilityMoveGranted_Implementation(const FBloodreadAbilityMoveGrant& Grant)
+{
+    // Queued as an ordinary local request, so it rides the next saved move and the server claims the grant with it
+    switch (Grant.Flag)
+    {
+        case FLAG_AbilityLaunch: RequestAbilityLaunch(Grant.Vector); break;
+        case FLAG_Teleport:      RequestTeleport(Grant.Vector, FRotator(0.0f, Grant.Value, 0.0f)); break;
+        case FLAG_SpeedBuff:     ApplySpeedBuff(Grant.Value, Grant.Duration); break;
+        default: break;
+    }
+}
+
+bool UBloodreadMovementComponent::IsTeleportDestinationValid(FVector& InOutLocation, const FRotator& Rotation) const
+{
+    UWorld* World = GetWorld();
+    if (!World || !CharacterOwner || !UpdatedComponent)
+    {
+        return false;
+    }
+
+    const FVector Start = UpdatedComponent->GetComponentLocation();
+    if (FVector::Dist(Start, InOutLocation) > MaxTeleportDistance)
+    {
+        return false;
+    }
+
+    // Nudge out of anything the capsule would overlap, then make sure no world geometry lies between here and there
+    if (!World->FindTeleportSpot(CharacterOwner, InOutLocation, Rotation))
+    {
+        return false;
+    }
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(BloodreadTeleport), false, CharacterOwner);
+    return !World->LineTraceTestByChannel(Start, InOutLocation, ECC_WorldStatic, Params);
+}
+
+float UBloodreadMovementComponent::GetMaxSpeed() const
+{
+    const float BaseSpeed = Super::GetMaxSpeed();
+
+    // Buffs only ever scaled walk speed
+    if (IsSpeedBuffActive() && (MovementMode == MOVE_Walking || MovementMode == MOVE_NavWalking))
+    {
+        return BaseSpeed * SpeedBuffMultiplier;
+    }
+    return BaseSpeed;
+}
+
+FNetworkPredictionData_Client* UBloodreadMovementComponent::GetPredictionData_Client() const
+{
+    if (!ClientPredictionData)
+    {
+        UBloodreadMovementComponent* MutableThis = const_cast<UBloodreadMovementComponent*>(this);
+        MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Bloodread(*this);
+    }
+    return ClientPredictionData;
+}
+
+void UBloodreadMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+    Super::UpdateFromCompressedFlags(Flags);
+
+    bWantsAbilityLaunch = (Flags & FLAG_AbilityLaunch) != 0;
+    bWantsTeleport = (Flags & FLAG_Teleport) != 0;
+    bWantsSpeedBuff = (Flags & FLAG_SpeedBuff) != 0;
+}
+
+void UBloodreadMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+    // Server: pull the payload for this move before the flags are applied (null during client replay)
+    if (const FBloodreadNetworkMoveData* MoveData = static_cast<const FBloodreadNetworkMoveData*>(GetCurrentNetworkMoveData()))
+    {
+        PendingAbilityLaunchVelocity = MoveData->AbilityLaunchVelocity;
+        PendingTeleportLocation = MoveData->TeleportLocation;
+        PendingTeleportYaw = MoveData->TeleportYaw;
+        PendingSpeedBuffMultiplier = MoveData->SpeedBuffMultiplier;
+        PendingSpeedBuffDuration = MoveData->SpeedBuffDuration;
+    }
+
+    Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+}
+
+void UBloodreadMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+    Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+    if (SpeedBuffTimeRemaining > 0.0f)
+    {
+        SpeedBuffTimeRemaining -= DeltaSeconds;
+        if (SpeedBuffTimeRemaining <= 0.0f)
+        {
+            SpeedBuffTimeRemaining = 0.0f;
+            SpeedBuffMultiplier = 1.0f;
+        }
+    }
+
+    ConsumeAbilityRequests();
+}
+
+void UBloodreadMovementComponent::ConsumeAbilityRequests()
+{
+    if (!CharacterOwner || !UpdatedComponent)
+    {
+        return;
+    }
+
+    // A remote client's flags only count when they claim a grant from a server-side activation, and the granted
+    // payload is used rather than what the move carried; locally generated requests are trusted
+    const bool bFromRemoteClient = IsServerForRemoteClient();
+    FBloodreadAbilityMoveGrant Grant;
+
+    if (bWantsSpeedBuff)
+    {
+        bWantsSpeedBuff = false;
+        if (!bFromRemoteClient)
+        {
+            SpeedBuffMultiplier = PendingSpeedBuffMultiplier;
+            SpeedBuffTimeRemaining = FMath::Max(PendingSpeedBuffDuration, 0.0f);
+        }
+        else if (ClaimGrant(FLAG_SpeedBuff, Grant))
+        {
+            SpeedBuffMultiplier = Grant.Value;
+            SpeedBuffTimeRemaining = Grant.Duration;
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("BloodreadMovement: Rejected ungranted speed buff for %s"), *CharacterOwner->GetName());
+        }
+    }
+
+    if (bWantsTeleport)
+    {
+        bWantsTeleport = false;
+        FVector Location = PendingTeleportLocation;
+        float Yaw = PendingTeleportYaw;
+        bool bAllowed = !bFromRemoteClient;
+        if (bFromRemoteClient && ClaimGrant(FLAG_Teleport, Grant))
+        {
+            // Checked against walls and encroachment when granted; the client may have moved a little since
+            Location = Grant.Vector;
+            Yaw = Grant.Value;
+            bAllowed = FVector::Dist(Location, UpdatedComponent->GetComponentLocation()) <= MaxTeleportDistance;
+        }
+
+        if (bAllowed)
+        {
+            UpdatedComponent->SetWorldLocationAndRotation(Location, FRotator(0.0f, Yaw, 0.0f), false, nullptr, ETeleportType::TeleportPhysics);
+            bJustTeleported = true;
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("BloodreadMovement: Rejected teleport to %s for %s"), *Location.ToString(), *CharacterOwner->GetName());
+        }
+    }
+
+    if (bWantsAbilityLaunch)
+    {
+        bWantsAbilityLaunch = false;
+        // Applied by HandlePendingLaunch later in this same move
+        if (!bFromRemoteClient)
+        {
+            Launch(PendingAbilityLaunchVelocity);
+        }
+        else if (ClaimGrant(FLAG_AbilityLaunch, Grant))
+        {
+            Launch(Grant.Vector);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("BloodreadMovement: Rejected ungranted ability launch for %s"), *CharacterOwner->GetName());
+        }
+    }
+}
+
+UNetInterpolationSubsystem* UBloodreadMovementComponent::GetProxyInterpolation() const
+{
+    return CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy ? UNetInterpolationSubsystem::Get(this) : nullptr;
+}
+
+void UBloodreadMovementComponent::SmoothCorrection(const FVector& OldLocation, const FQuat& OldRotation, const FVector& NewLocation, const FQuat& NewRotation)
+{
+    UNetInterpolationSubsystem* Interpolation = GetProxyInterpolation();
+    if (!Interpolation)
+    {
+        Super::SmoothCorrection(OldLocation, OldRotation, NewLocation, NewRotation);
+        return;
+    }
+
+    // Velocity has already been updated from the same replicated movement
+    FNetProxySnapshot Snapshot;
+    Snapshot.ServerTime = CharacterOwner->GetReplicatedServerLastTransformUpdateTimeStamp();
+    Snapshot.Location = NewLocation;
+    Snapshot.Rotation = NewRotation;
+    Snapshot.Velocity = Velocity;
+
+    const FNetProxySnapshot* Previous = ProxySnapshots.GetNewest();
+    if (Previous)
+    {
+        // Further than either velocity could have carried it (teleport, respawn) - snap rather than slide
+        const double Span = FMath::Max(Snapshot.ServerTime - Previous->ServerTime, 0.0);
+        const double Reachable = FMath::Max(Previous->Velocity.Size(), Velocity.Size()) * Span * 2.0;
+        Snapshot.bTeleport = FVector::Dist(Previous->Location, NewLocation) > FMath::Max(static_cast<double>(Interpolation->GetTeleportSnapDistance()), Reachable);
+    }
+
+    Interpolation->ReportSnapshot(Snapshot.ServerTime, Previous ? Previous->ServerTime : -1.0, Previous && !Previous->Velocity.IsNearlyZero(1.0f));
+    ProxySnapshots.Add(Snapshot);
+
+    // Keeps SimulatedTick calling SmoothClientPosition while the buffer drives the mesh
+    bNetworkSmoothingComplete = false;
+}
+
+void UBloodreadMovementComponent::SmoothClientPosition(float DeltaSeconds)
+{
+    UNetInterpolationSubsystem* Interpolation = GetProxyInterpolation();
+    USkeletalMeshComponent* Mesh = CharacterOwner ? CharacterOwner->GetMesh() : nullptr;
+    if (!Interpolation || ProxySnapshots.IsEmpty() || !Mesh || Mesh->IsSimulatingPhysics() || !UpdatedComponent)
+    {
+        Super::SmoothClientPosition(DeltaSeconds);
+        return;
+    }
+
+    const double RenderTime = Interpolation->GetRenderServerTime();
+    FVector Location;
+    FQuat Rotation;
+    if (ProxySnapshots.Sample(RenderTime, Interpolation->GetMaxExtrapolation(), Location, Rotation))
+    {
+        Interpolation->NoteExtrapolation();
+    }
+    ProxySnapshots.Prune(RenderTime);
+
+    // The capsule stays where replication put it (collision, traces); only the mesh is drawn at the buffered position
+    const FTransform& CapsuleTransform = UpdatedComponent->GetComponentTransform();
+    const FVector RelativeLocation = CapsuleTransform.InverseTransformVectorNoScale(Location - CapsuleTransform.GetLocation()) + CharacterOwner->GetBaseTranslationOffset();
+    const FQuat RelativeRotation = CapsuleTransform.GetRotation().Inverse() * Rotation * CharacterOwner->GetBaseRotationOffset();
+    Mesh->SetRelativeLocationAndRotation(RelativeLocation, RelativeRotation, false, nullptr, ETeleportType::TeleportPhysics);
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/RootMotionSource.h"
+#include "CombatRules.h"
+#include "NetInterpolation.h"
+#include "BloodreadMovementComponent.generated.h"
+
+/**
+ * Knockback as a root motion source: horizontal speed decays linearly to zero over Duration while the
+ * vertical component follows a ballistic arc. Position at any time is a closed-form function of the launch
+ * parameters, so server, owning client and replays during move correction all produce the same path.
+ */
+USTRUCT()
+struct BLOODREADGAME_API FRootMotionSource_BloodreadKnockback : public FRootMotionSource
+{
+    GENERATED_BODY()
+
+    FRootMotionSource_BloodreadKnockback();
+
+    // Initial horizontal velocity (world space, Z ignored)
+    UPROPERTY()
+    FVector HorizontalVelocity = FVector::ZeroVector;
+
+    // Initial upward speed
+    UPROPERTY()
+    float VerticalVelocity = 0.0f;
+
+    // Gravity applied to the vertical arc (negative = down)
+    UPROPERTY()
+    float GravityZ = -980.0f;
+
+    virtual FRootMotionSource* Clone() const override;
+    virtual bool Matches(const FRootMotionSource* Other) const override;
+    virtual bool MatchesAndHasSameState(const FRootMotionSource* Other) const override;
+    virtual void PrepareRootMotion(float SimulationTime, float MovementTickTime, const ACharacter& Character, const UCharacterMovementComponent& MoveComponent) override;
+    virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+    virtual UScriptStruct* GetScriptStruct() const override;
+    virtual FString ToSimpleString() const override;
+
+    // Offset from the launch point after Time seconds
+    FVector GetOffsetAtTime(float Time) const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FRootMotionSource_BloodreadKnockback> : public TStructOpsTypeTraitsBase2<FRootMotionSource_BloodreadKnockback>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithCopy = true
+    };
+};
+
+// Ability movement the server has authorised for a remote client. The client receives it over RPC and puts it on
+// its next move; the server only honours a move flag that matches one of these, and uses the granted payload.
+USTRUCT()
+struct BLOODREADGAME_API FBloodreadAbilityMoveGrant
+{
+    GENERATED_BODY()
+
+    // One of UBloodreadMovementComponent::EBloodreadMoveFlags
+    UPROPERTY()
+    uint8 Flag = 0;
+
+    // Launch velocity or teleport location
+    UPROPERTY()
+    FVector_NetQuantize10 Vector = FVector::ZeroVector;
+
+    // Teleport yaw, or speed buff multiplier
+    UPROPERTY()
+    float Value = 0.0f;
+
+    // Speed buff duration
+    UPROPERTY()
+    float Duration = 0.0f;
+
+    // Server world time after which an unclaimed grant is dropped (not replicated)
+    double ExpiresAt = 0.0;
+};
+
+// Extra per-move payload sent with ability flags (only serialized when the matching flag is set)
+struct FBloodreadNetworkMoveData : public FCharacterNetworkMoveData
+{
+    FVector_NetQuantize10 AbilityLaunchVelocity;
+    FVector_NetQuantize10 TeleportLocation;
+    float TeleportYaw = 0.0f;
+    float SpeedBuffMultiplier = 1.0f;
+    float SpeedBuffDuration = 0.0f;
+
+    virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+struct FBloodreadNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+    FBloodreadNetworkMoveDataContainer();
+
+    FBloodreadNetworkMoveData MoveData[3];
+};
+
+// Saved move carrying the ability requests and speed buff state needed to replay a move after a correction
+class FSavedMove_Bloodread : public FSavedMove_Character
+{
+public:
+    typedef FSavedMove_Character Super;
+
+    uint8 bWantsAbilityLaunch : 1;
+    uint8 bWantsTeleport : 1;
+    uint8 bWantsSpeedBuff : 1;
+
+    FVector AbilityLaunchVelocity;
+    FVector TeleportLocation;
+    float TeleportYaw;
+    float RequestedSpeedBuffMultiplier;
+    float RequestedSpeedBuffDuration;
+
+    // Buff state at the start of the move
+    float SavedSpeedBuffMultiplier;
+    float SavedSpeedBuffTimeRemaining;
+
+    FSavedMove_Bloodread();
+
+    virtual void Clear() override;
+    virtual uint8 GetCompressedFlags() const override;
+    virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+    virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+    virtual void PrepMoveFor(ACharacter* C) override;
+};
+
+class FNetworkPredictionData_Client_Bloodread : public FNetworkPredictionData_Client_Character
+{
+public:
+    typedef FNetworkPredictionData_Client_Character Super;
+
+    FNetworkPredictionData_Client_Bloodread(const UCharacterMovementComponent& ClientMovement);
+
+    virtual FSavedMovePtr AllocateNewMove() override;
+};
+
+/**
+ * Character movement for all Bloodread characters.
+ * Knockback runs through the root motion source system so it is simulated by the movement component on the
+ * server and the owning client, recorded in saved moves, and replayed on correction instead of being a raw
+ * velocity poke applied separately on every machine.
+ *
+ * Ability movement (Dragon Ascent/Blitz launches, Rogue teleport) and timed speed buffs are requested here
+ * rather than applied directly: the request rides the next saved move as a compressed flag plus move data,
+ * so the server performs it at the same point in the move stream as the owning client and corrections replay it.
+ * Abilities only run on the server, so for a remote client the request becomes a grant sent to that client;
+ * a move flag without a matching grant is rejected.
+ *
+ * On network clients, simulated proxies draw their mesh from a buffer of replicated snapshots at the adaptive
+ * delay chosen by UNetInterpolationSubsystem instead of the default exponential smoothing.
+ */
+UCLASS()
+class BLOODREADGAME_API UBloodreadMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+
+public:
+    UBloodreadMovementComponent();
+
+    // Start a knockback from a direction and force; the whole curve is derived from these two values (see FCombatRules::ShapeKnockback)
+    FKnockbackShape ApplyKnockback(const FVector& Direction, float Force, float HorizontalMultiplier);
+
+    FKnockbackTuning GetKnockbackTuning(float HorizontalMultiplier) const;
+
+    UFUNCTION(BlueprintPure, Category = "Movement|Knockback")
+    bool IsKnockbackActive() const;
+
+    // Replace velocity on the next move (Dragon Ascent leap and Blitz slam)
+    UFUNCTION(BlueprintCallable, Category = "Movement|Abilities")
+    void RequestAbilityLaunch(const FVector& LaunchVelocity);
+
+    // Move to a location on the next move (Rogue teleport); the location should already be a valid spot.
+    // The server refuses spots that are too far, behind world geometry or encroaching.
+    UFUNCTION(BlueprintCallable, Category = "Movement|Abilities")
+    void RequestTeleport(const FVector& Location, const FRotator& Rotation);
+
+    // Scale max walk speed for Duration seconds of movement time; a new buff replaces the current one
+    UFUNCTION(BlueprintCallable, Category = "Movement|Abilities")
+    void ApplySpeedBuff(float Multiplier, float Duration);
+
+    UFUNCTION(BlueprintPure, Category = "Movement|Abilities")
+    bool IsSpeedBuffActive() const { return SpeedBuffTimeRemaining > 0.0f; }
+
+    // Current speed multiplier (1 when no buff is running)
+    float GetActiveSpeedBuffMultiplier() const { return IsSpeedBuffActive() ? SpeedBuffMultiplier : 1.0f; }
+
+    virtual float GetMaxSpeed() const override;
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+    virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+    virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+    virtual void SmoothCorrection(const FVector& OldLocation, const FQuat& OldRotation, const FVector& NewLocation, const FQuat& NewRotation) override;
+
+    // Owning client: perform ability movement the server has granted
+    UFUNCTION(Client, Reliable)
+    void ClientAbilityMoveGranted(const FBloodreadAbilityMoveGrant& Grant);
+
+    // Knockback duration (seconds) at zero force and at KnockbackForceForMaxDuration
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Knockback")
+    float KnockbackMinDuration = 0.25f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Knockback")
+    float KnockbackMaxDuration = 0.6f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Knockback")
+    float KnockbackForceForMaxDuration = 1000.0f;
+
+    // Upward launch speed as a fraction of force
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Knockback")
+    float KnockbackVerticalRatio = 0.6f;
+
+    // Server-side limits on ability movement (teleport distance also bounds Rogue teleports on the server)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Abilities")
+    float MaxAbilityLaunchSpeed = 10000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Abilities")
+    float MaxTeleportDistance = 1500.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Abilities")
+    float MaxSpeedBuffMultiplier = 2.0f;
+
+    // Seconds a grant waits for the client move that claims it
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Abilities")
+    float AbilityGrantTimeout = 2.0f;
+
+    static const FName KnockbackInstanceName;
+
+    // Compressed flag bits for ability requests
+    enum EBloodreadMoveFlags : uint8
+    {
+        FLAG_AbilityLaunch = FSavedMove_Character::FLAG_Custom_0,
+        FLAG_Teleport      = FSavedMove_Character::FLAG_Custom_1,
+        FLAG_SpeedBuff     = FSavedMove_Character::FLAG_Custom_2
+    };
+
+protected:
+    virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+    virtual void SmoothClientPosition(float DeltaSeconds) override;
+
+private:
+    friend class FSavedMove_Bloodread;
+    friend struct FBloodreadNetworkMoveData;
+
+    void ConsumeAbilityRequests();
+
+    // Server, pawn controlled by a remote client: requests become grants instead of local flags
+    bool IsServerForRemoteClient() const;
+    void GrantAbilityMove(FBloodreadAbilityMoveGrant Grant);
+
+    // Removes and returns the oldest live grant for Flag
+    bool ClaimGrant(uint8 Flag, FBloodreadAbilityMoveGrant& OutGrant);
+
+    bool IsTeleportDestinationValid(FVector& InOutLocation, const FRotator& Rotation) const;
+
+    // Adaptive interpolation for this character when it is a simulated proxy, nullptr otherwise
+    UNetInterpolationSubsystem* GetProxyInterpolation() const;
+
+    uint16 KnockbackSourceID = 0;
+
+    // Pending requests (cleared once the move that carries them has run)
+    uint8 bWantsAbilityLaunch : 1;
+    uint8 bWantsTeleport : 1;
+    uint8 bWantsSpeedBuff : 1;
+
+    FVector PendingAbilityLaunchVelocity = FVector::ZeroVector;
+    FVector PendingTeleportLocation = FVector::ZeroVector;
+    float PendingTeleportYaw = 0.0f;
+    float PendingSpeedBuffMultiplier = 1.0f;
+    float PendingSpeedBuffDuration = 0.0f;
+
+    // Active buff, advanced by move time so client and server agree on when it ends
+    float SpeedBuffMultiplier = 1.0f;
+    float SpeedBuffTimeRemaining = 0.0f;
+
+    FBloodreadNetworkMoveDataContainer BloodreadMoveDataContainer;
+
+    // Server: ability movement granted to the owning client and not yet claimed by a move
+    TArray<FBloodreadAbilityMoveGrant> PendingGrants;
+
+    // Replicated movement received as a simulated proxy, drawn at the adaptive interpolation delay
+    FNetSnapshotBuffer ProxySnapshots;
+};
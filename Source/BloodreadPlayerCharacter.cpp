@@ -8,6 +8,8 @@
 #include "DrawDebugHelpers.h"
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
+#include "RpcRateLimiter.h"
+#include "FrameScratch.h"
 
 ABloodreadPlayerCharacter::ABloodreadPlayerCharacter()
 {
@@ -195,7 +197,7 @@ void ABloodreadPlayerCharacter::UseAbility1()
                                 else
                                 {
                                     // Multiplayer - route through our owned RPC
-                                    ServerApplyKnockbackToTarget(PlayerTarget, KnockbackDirection, PlayerLoadout.Ability1.KnockbackForce);
+                                    ServerApplyKnockbackToTarget(PlayerTarget, 1);
                                 }
                             }
                         }
@@ -269,7 +271,7 @@ void ABloodreadPlayerCharacter::UseAbility2()
                                 else
                                 {
                                     // Multiplayer - route through our owned RPC
-                                    ServerApplyKnockbackToTarget(PlayerTarget, KnockbackDirection, PlayerLoadout.Ability2.KnockbackForce);
+                                    ServerApplyKnockbackToTarget(PlayerTarget, 2);
                                 }
                             }
                         }
@@ -377,8 +379,35 @@ void ABloodreadPlayerCharacter::ApplyKnockback(FVector KnockbackDirection, float
     UE_LOG(LogTemp, Log, TEXT("PlayerChar Knockback applied with enhanced force: %.2f"), EnhancedKnockback.Size());
 }
 
-void ABloodreadPlayerCharacter::ServerApplyKnockbackToTarget_Implementation(ACharacter* TargetCharacter, FVector KnockbackDirection, float Force)
+bool ABloodreadPlayerCharacter::ServerApplyKnockbackToTarget_Validate(ACharacter* TargetCharacter, uint8 AbilitySlot)
 {
+    return AbilitySlot == 1 || AbilitySlot == 2;
+}
+
+void ABloodreadPlayerCharacter::ServerApplyKnockbackToTarget_Implementation(ACharacter* TargetCharacter, uint8 AbilitySlot)
+{
+    if (!URpcRateLimitSubsystem::Allow(this, ECombatRpc::Knockback))
+    {
+        return;
+    }
+
+    // Dead attackers and far-away targets are never legitimate knockback sources
+    if (!IsAlive() || (TargetCharacter && FVector::DistSquared(GetActorLocation(), TargetCharacter->GetActorLocation())
+                                          > FMath::Square(URpcRateLimitSubsystem::GetMaxKnockbackTargetRange(this))))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PlayerChar ServerApplyKnockbackToTarget: Rejected request from %s"), *GetName());
+        return;
+    }
+
+    // The force belongs to the ability being resolved, as the server knows it; heals and unset slots push nothing
+    const FAbilityData& Ability = AbilitySlot == 1 ? PlayerLoadout.Ability1 : PlayerLoadout.Ability2;
+    const float Force = FMath::Min(Ability.KnockbackForce, URpcRateLimitSubsystem::GetMaxKnockbackForce(this));
+    if (Ability.Id <= 0 || Force <= 0.0f)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PlayerChar ServerApplyKnockbackToTarget: Ability %d has no knockback, rejected"), AbilitySlot);
+        return;
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("PlayerChar ServerApplyKnockbackToTarget: Applying knockback to %s from %s"), 
            TargetCharacter ? *TargetCharacter->GetName() : TEXT("NULL"), *GetName());
     
@@ -387,6 +416,8 @@ void ABloodreadPlayerCharacter::ServerApplyKnockbackToTarget_Implementation(ACha
         UE_LOG(LogTemp, Warning, TEXT("PlayerChar ServerApplyKnockbackToTarget: NULL target"));
         return;
     }
+
+    const FVector KnockbackDirection = (TargetCharacter->GetActorLocation() - GetActorLocation()).GetSafeNormal();
     
     // Handle different character types
     if (ABloodreadBaseCharacter* BaseCharacter = Cast<ABloodreadBaseCharacter>(TargetCharacter))
@@ -713,10 +744,10 @@ FVector ABloodreadPlayerCharacter::GetDirectionToOtherPlayer()
 
 ABloodreadPlayerCharacter* ABloodreadPlayerCharacter::FindOtherPlayer()
 {
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABloodreadPlayerCharacter::StaticClass(), FoundActors);
+    TFrameScratch<AActor*> FoundActors(this);
+    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABloodreadPlayerCharacter::StaticClass(), *FoundActors);
     
-    for (AActor* Actor : FoundActors)
+    for (AActor* Actor : *FoundActors)
     {
         ABloodreadPlayerCharacter* Player = Cast<ABloodreadPlayerCharacter>(Actor);
         if (Player && Player != this)
@@ -749,10 +780,10 @@ float ABloodreadPlayerCharacter::GetHealthPercentage() const
 TArray<ABloodreadPlayerCharacter*> ABloodreadPlayerCharacter::GetPlayersInRange(float Range)
 {
     TArray<ABloodreadPlayerCharacter*> PlayersInRange;
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABloodreadPlayerCharacter::StaticClass(), FoundActors);
+    TFrameScratch<AActor*> FoundActors(this);
+    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABloodreadPlayerCharacter::StaticClass(), *FoundActors);
     
-    for (AActor* Actor : FoundActors)
+    for (AActor* Actor : *FoundActors)
     {
         ABloodreadPlayerCharacter* Player = Cast<ABloodreadPlayerCharacter>(Actor);
         if (Player && Player != this)
@@ -773,10 +804,10 @@ TArray<ABloodreadPlayerCharacter::FDamageableTarget> ABloodreadPlayerCharacter::
     TArray<FDamageableTarget> TargetsInRange;
     
     // Get all players in range
-    TArray<AActor*> FoundPlayers;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABloodreadPlayerCharacter::StaticClass(), FoundPlayers);
+    TFrameScratch<AActor*> FoundPlayers(this);
+    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABloodreadPlayerCharacter::StaticClass(), *FoundPlayers);
     
-    for (AActor* Actor : FoundPlayers)
+    for (AActor* Actor : *FoundPlayers)
     {
         ABloodreadPlayerCharacter* Player = Cast<ABloodreadPlayerCharacter>(Actor);
         if (Player && Player != this)
@@ -790,10 +821,10 @@ TArray<ABloodreadPlayerCharacter::FDamageableTarget> ABloodreadPlayerCharacter::
     }
     
     // Get all practice dummies in range
-    TArray<AActor*> FoundDummies;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), APracticeDummy::StaticClass(), FoundDummies);
+    TFrameScratch<AActor*> FoundDummies(this);
+    UGameplayStatics::GetAllActorsOfClass(GetWorld(), APracticeDummy::StaticClass(), *FoundDummies);
     
-    for (AActor* Actor : FoundDummies)
+    for (AActor* Actor : *FoundDummies)
     {
         APracticeDummy* Dummy = Cast<APracticeDummy>(Actor);
         if (Dummy)
@@ -125,9 +125,10 @@ public:
     UFUNCTION(BlueprintCallable, Category="Combat")
     void ApplyKnockback(FVector KnockbackDirection, float Force);
 
-    // Server RPC to apply knockback to another player (called by attacker)
-    UFUNCTION(Server, Reliable, Category = "Combat")
-    void ServerApplyKnockbackToTarget(ACharacter* TargetCharacter, FVector KnockbackDirection, float Force);
+    // Server RPC to apply an ability's knockback to another player (called by attacker); AbilitySlot is 1 or 2,
+    // and the force comes from the server's copy of that loadout ability
+    UFUNCTION(Server, Reliable, WithValidation, Category = "Combat")
+    void ServerApplyKnockbackToTarget(ACharacter* TargetCharacter, uint8 AbilitySlot);
 
     UFUNCTION(BlueprintCallable, Category="Combat")
     void Heal(int32 Amount);
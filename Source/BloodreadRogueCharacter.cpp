@@ -1,4 +1,5 @@
 #include "BloodreadRogueCharacter.h"
+#include "BloodreadStats.h"
 #include "Engine/Engine.h"
 #include "Animation/AnimBlueprint.h"
 #include "Engine/StreamableManager.h"
@@ -28,8 +29,7 @@ void ABloodreadRogueCharacter::BeginPlay()
     Super::BeginPlay();
     
     // Apply rogue-specific initialization
-    InitializeRogueData();  
-    InitializeFromClassData(CharacterClassData);
+    InitializeFromClass(ECharacterClass::Rogue);
     
     // Ensure rogue movement settings are applied (in case base class overrode them)
     GetCharacterMovement()->MaxWalkSpeed = 600.f; // Faster movement
@@ -48,15 +48,16 @@ void ABloodreadRogueCharacter::OnCharacterClassChanged()
 
 bool ABloodreadRogueCharacter::OnAbility1Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility1Used();
     bool bTeleportSuccessful = Teleport();
     
     // If teleport failed, refund the mana cost
     if (!bTeleportSuccessful)
     {
-        CurrentMana += CharacterClassData.Ability1.ManaCost;
+        CurrentMana += GetClassDefinition().Ability1.ManaCost;
         CurrentMana = FMath::Min(CurrentMana, CurrentStats.Mana); // Don't exceed max mana
-        UE_LOG(LogTemp, Warning, TEXT("Teleport failed - refunding %d mana"), CharacterClassData.Ability1.ManaCost);
+        UE_LOG(LogTemp, Warning, TEXT("Teleport failed - refunding %d mana"), GetClassDefinition().Ability1.ManaCost);
     }
     
     return bTeleportSuccessful;
@@ -64,6 +65,7 @@ bool ABloodreadRogueCharacter::OnAbility1Used()
 
 bool ABloodreadRogueCharacter::OnAbility2Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility2Used();
     ShadowPush();
     return true;
@@ -159,111 +161,38 @@ bool ABloodreadRogueCharacter::Teleport()
             UE_LOG(LogTemp, Warning, TEXT("Teleport: TO - Position: %s, Rotation: %s"), 
                    *TeleportLocation.ToString(), *MatchTargetRotation.ToString());
             
-            // Use networked teleport for multiplayer compatibility
-            bool bTeleportSuccess = false;
-            
-            if (GetNetMode() == NM_Standalone)
+            // Resolve a valid spot up front (retrying slightly higher), then hand the move to the movement
+            // component so the owning client and the server perform it at the same move
+            bool bTeleportSuccess = GetWorld()->FindTeleportSpot(this, TeleportLocation, MatchTargetRotation);
+            if (!bTeleportSuccess)
             {
-                // Standalone game - apply directly
-                UE_LOG(LogTemp, Warning, TEXT("Teleport: Standalone - applying directly"));
-                bTeleportSuccess = TeleportTo(TeleportLocation, MatchTargetRotation);
-                if (!bTeleportSuccess)
-                {
-                    FVector ElevatedLocation = TeleportLocation + FVector(0, 0, 100.0f);
-                    bTeleportSuccess = TeleportTo(ElevatedLocation, MatchTargetRotation);
-                    if (bTeleportSuccess)
-                    {
-                        TeleportLocation = ElevatedLocation;
-                    }
-                }
-                if (!bTeleportSuccess)
+                FVector ElevatedLocation = TeleportLocation + FVector(0, 0, 100.0f);
+                bTeleportSuccess = GetWorld()->FindTeleportSpot(this, ElevatedLocation, MatchTargetRotation);
+                if (bTeleportSuccess)
                 {
-                    bTeleportSuccess = SetActorLocation(TeleportLocation, false, nullptr, ETeleportType::TeleportPhysics);
-                    if (bTeleportSuccess)
-                    {
-                        SetActorRotation(MatchTargetRotation);
-                        if (GetController())
-                        {
-                            GetController()->SetControlRotation(MatchTargetRotation);
-                        }
-                    }
+                    TeleportLocation = ElevatedLocation;
                 }
             }
-            else
-            {
-                // Multiplayer - use Server RPC
-                UE_LOG(LogTemp, Warning, TEXT("Teleport: Multiplayer - using Server RPC"));
-                ServerTeleport(TeleportLocation, MatchTargetRotation);
-                bTeleportSuccess = true; // Assume success for mana purposes - server will handle actual teleport
-            }
             
-            // Ensure rotation is properly set regardless of teleport method
             if (bTeleportSuccess)
             {
-                // Double-check rotation setting after successful teleport
-                SetActorRotation(MatchTargetRotation);
+                GetBloodreadMovement()->RequestTeleport(TeleportLocation, MatchTargetRotation);
+                
+                // Actor yaw follows control rotation, which reaches the server with the same move
                 if (GetController())
                 {
                     GetController()->SetControlRotation(MatchTargetRotation);
                 }
                 
-                UE_LOG(LogTemp, Warning, TEXT("Teleport: Final rotation verification - Actor: %s, Control: %s"), 
-                       *GetActorRotation().ToString(), 
-                       GetController() ? *GetController()->GetControlRotation().ToString() : TEXT("No Controller"));
-            }
-            
-            // Log final result
-            if (bTeleportSuccess)
-            {
-                FVector FinalPosition = GetActorLocation();
-                FRotator FinalRotation = GetActorRotation();
-                UE_LOG(LogTemp, Error, TEXT("*** TELEPORT SUCCESS *** Final position: %s, rotation: %s"), 
-                       *FinalPosition.ToString(), *FinalRotation.ToString());
-                UE_LOG(LogTemp, Error, TEXT("*** STEALTH POSITION *** Behind target, same orientation"));
-                UE_LOG(LogTemp, Warning, TEXT("Target was facing: %s"), *TargetRotation.ToString());
-                UE_LOG(LogTemp, Warning, TEXT("Rogue now facing: %s"), *FinalRotation.ToString());
-                UE_LOG(LogTemp, Warning, TEXT("Rotation match: %s"), 
-                       FinalRotation.Equals(TargetRotation, 10.0f) ? TEXT("SUCCESS - Same direction") : TEXT("MISMATCH - Rotation issue"));
+                // Gain 30% movement speed for 5 seconds
+                GetBloodreadMovement()->ApplySpeedBuff(1.0f + MovementSpeedBonus, SpeedBoostDuration);
                 
-                // Ensure rotation sticks by setting it one more time after a tiny delay
-                GetWorld()->GetTimerManager().SetTimerForNextTick([this, MatchTargetRotation]()
-                {
-                    SetActorRotation(MatchTargetRotation);
-                    if (GetController())
-                    {
-                        GetController()->SetControlRotation(MatchTargetRotation);
-                    }
-                    UE_LOG(LogTemp, Warning, TEXT("Teleport: Post-teleport rotation enforcement - Final: %s"), 
-                           *GetActorRotation().ToString());
-                });
+                UE_LOG(LogTemp, Error, TEXT("*** TELEPORT SUCCESS *** Behind %s at %s, facing %s"), 
+                       *Target.Actor->GetName(), *TeleportLocation.ToString(), *MatchTargetRotation.ToString());
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("*** TELEPORT COMPLETELY FAILED *** All methods failed"));
-            }
-            
-            // Only apply movement speed boost if teleport was successful and in standalone mode
-            if (bTeleportSuccess && GetNetMode() == NM_Standalone)
-            {
-                // Gain 30% movement speed for 5 seconds (multiplayer handled in networked functions)
-                float CurrentSpeed = GetCharacterMovement()->MaxWalkSpeed;
-                GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed * (1.0f + MovementSpeedBonus);
-                
-                // Clear any existing speed boost timer
-                GetWorldTimerManager().ClearTimer(SpeedBoostTimerHandle);
-                
-                // Set timer to restore normal speed
-                GetWorldTimerManager().SetTimer(SpeedBoostTimerHandle, [this, CurrentSpeed]()
-                {
-                    GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed;
-                    UE_LOG(LogTemp, Warning, TEXT("Teleport speed boost ended"));
-                }, SpeedBoostDuration, false);
-                
-                UE_LOG(LogTemp, Warning, TEXT("Teleported behind %s with speed boost"), *Target.Actor->GetName());
-            }
-            else if (bTeleportSuccess)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("Teleported behind %s (networked - speed boost handled by RPC)"), *Target.Actor->GetName());
+                UE_LOG(LogTemp, Error, TEXT("*** TELEPORT FAILED *** No valid spot behind %s"), *Target.Actor->GetName());
             }
             
             return bTeleportSuccess;
@@ -285,24 +214,17 @@ bool ABloodreadRogueCharacter::Teleport()
         FVector ForwardVector = CameraRotation.Vector();
         
         FVector TeleportLocation = GetActorLocation() + (ForwardVector * 400.0f);
-        bool bTeleportSuccess = false;
-        
-        if (GetNetMode() == NM_Standalone)
+        bool bTeleportSuccess = GetWorld()->FindTeleportSpot(this, TeleportLocation, GetActorRotation());
+        if (!bTeleportSuccess)
         {
-            // Standalone game - apply directly
-            bTeleportSuccess = TeleportTo(TeleportLocation, GetActorRotation());
-            if (!bTeleportSuccess)
-            {
-                // If teleport failed, try with current ground level
-                TeleportLocation.Z = GetActorLocation().Z;
-                bTeleportSuccess = TeleportTo(TeleportLocation, GetActorRotation());
-            }
+            // If teleport failed, try with current ground level
+            TeleportLocation.Z = GetActorLocation().Z;
+            bTeleportSuccess = GetWorld()->FindTeleportSpot(this, TeleportLocation, GetActorRotation());
         }
-        else
+        
+        if (bTeleportSuccess)
         {
-            // Multiplayer - use Server RPC
-            ServerTeleport(TeleportLocation, GetActorRotation());
-            bTeleportSuccess = true; // Assume success for mana purposes
+            GetBloodreadMovement()->RequestTeleport(TeleportLocation, GetActorRotation());
         }
         
         if (bTeleportSuccess)
@@ -333,7 +255,7 @@ void ABloodreadRogueCharacter::ShadowPush()
     CurrentMana = FMath::Max(0, CurrentMana - 25);
     
     // Start ability cooldown
-    CharacterClassData.Ability2.CooldownRemaining = CharacterClassData.Ability2.Cooldown;
+    Ability2State.CooldownRemaining = GetClassDefinition().Ability2.Cooldown;
     
     // Get camera direction for targeting
     FVector CameraLocation;
@@ -353,35 +275,29 @@ void ABloodreadRogueCharacter::ShadowPush()
     {
         if (ABloodreadBaseCharacter* Target = Cast<ABloodreadBaseCharacter>(HitResult.GetActor()))
         {
-            // Push target in the direction of crosshair (NOT omnidirectional)
-            FVector PushDirection = ForwardVector;
-            PushDirection.Z = 0.0f; // Keep horizontal
-            PushDirection.Normalize();
-            
-            FVector KnockbackForce = PushDirection * ShadowPushKnockback;
-            KnockbackForce.Z += 100.0f; // Add small vertical lift
+            // Push target in the direction of crosshair (NOT omnidirectional); the knockback root motion
+            // source adds the lift, so the push stays in sync with the target's owning client
+            const FVector PushDirection = ForwardVector.GetSafeNormal2D();
             
-            Target->LaunchCharacter(KnockbackForce, true, true);
+            Target->ApplyKnockback(PushDirection, ShadowPushKnockback);
             
             UE_LOG(LogTemp, Warning, TEXT("Shadow Push hit %s"), *Target->GetName());
         }
     }
     
     // Gain shield of 20 health for 5 seconds
-    int32 NewMaxHealth = CurrentStats.MaxHealth + ShieldHealth;
-    int32 NewCurrentHealth = CurrentHealth + ShieldHealth;
-    
-    // Set temporary max health
-    CurrentStats.MaxHealth = NewMaxHealth;
-    CurrentHealth = NewCurrentHealth;
+    FCombatantStats Stats = GetCombatantStats();
+    FCombatRules::AddShield(Stats, static_cast<int32>(ShieldHealth));
+    SetCombatantStats(Stats);
     
     // Start shield duration timer
     FTimerHandle ShieldTimerHandle;
     GetWorldTimerManager().SetTimer(ShieldTimerHandle, [this]()
     {
         // Remove shield after duration
-        CurrentStats.MaxHealth -= ShieldHealth;
-        CurrentHealth = FMath::Min(CurrentHealth, CurrentStats.MaxHealth);
+        FCombatantStats ShieldStats = GetCombatantStats();
+        FCombatRules::RemoveShield(ShieldStats, static_cast<int32>(ShieldHealth));
+        SetCombatantStats(ShieldStats);
         UE_LOG(LogTemp, Warning, TEXT("Shadow Push shield expired"));
     }, ShieldDuration, false);
     
@@ -426,158 +342,6 @@ void ABloodreadRogueCharacter::Attack()
 
 void ABloodreadRogueCharacter::InitializeRogueData()
 {
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Rogue;
-    
-    // Initialize rogue stats (based on new specification)
-    FCharacterStats RogueStats;
-    RogueStats.MaxHealth = 100;    // 100 base health
-    RogueStats.Strength = 12;      // Medium strength
-    RogueStats.Defense = 6;        // Low defense
-    RogueStats.Speed = 16;         // Very high speed
-    RogueStats.Mana = 120;         // Starting mana
-    RogueStats.CriticalChance = 0.3f; // Very high crit chance
-    
-    // Initialize rogue abilities (new system)
-    FCharacterAbilityData TeleportAbility;
-    TeleportAbility.Name = "Teleport";
-    TeleportAbility.Description = "Teleport behind target with same orientation and gain movement speed";
-    TeleportAbility.Type = EAbilityType::Movement;
-    TeleportAbility.Cooldown = 8.0f;   // 8 second cooldown
-    TeleportAbility.ManaCost = 100;    // Costs 100 mana
-    TeleportAbility.Damage = 0.0f;     // No direct damage
-    TeleportAbility.Duration = SpeedBoostDuration; // Movement speed bonus duration
-    
-    FCharacterAbilityData ShadowPushAbility;
-    ShadowPushAbility.Name = "Shadow Push";
-    ShadowPushAbility.Description = "Push opponent back and gain a protective shield";
-    ShadowPushAbility.Type = EAbilityType::Damage;
-    ShadowPushAbility.Cooldown = 8.0f;  // 8 second cooldown
-    ShadowPushAbility.ManaCost = 25;    // Costs 25 mana
-    ShadowPushAbility.Damage = 0.0f;    // No direct damage, just knockback
-    ShadowPushAbility.Duration = ShieldDuration; // Shield duration
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Rogue;
-    CharacterClassData.ClassName = "Rogue";
-    CharacterClassData.Description = "A swift assassin specializing in teleportation and tactical positioning";
-    CharacterClassData.BaseStats = RogueStats;
-    CharacterClassData.Ability1 = TeleportAbility;
-    CharacterClassData.Ability2 = ShadowPushAbility;
-    
-    // Set rogue mesh (Shinbi character)
-    CharacterClassData.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Skins/Tier_1/Shinbi_Dynasty/Meshes/ShinbiDynasty.ShinbiDynasty")));
-    
-    // Set rogue animation blueprint path (will be loaded later by the system)
-    CharacterClassData.AnimationBlueprintPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Shinbi_AnimBlueprint.Shinbi_AnimBlueprint_C");
-    UE_LOG(LogTemp, Warning, TEXT("Set Shinbi animation blueprint path: %s"), *CharacterClassData.AnimationBlueprintPath);
-    
-    // Set rogue attack animation paths (using actual existing animation files)
-    CharacterClassData.BasicAttackAnimationPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Animations/PrimaryMelee_B_Slow.PrimaryMelee_B_Slow");
-    CharacterClassData.Ability1AnimationPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Animations/Ability_Dash.Ability_Dash");
-    CharacterClassData.Ability2AnimationPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Animations/Ability_CirclingWolves.Ability_CirclingWolves");
-    
-    // Set camera offset adjusted for Shinbi Dynasty character
-    CharacterClassData.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
-    
-    // Apply stats
-    CurrentStats = RogueStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
+    // Stats, abilities, mesh and animation paths are defined once in FCharacterClassRegistry
+    BindClassDefinition(ECharacterClass::Rogue);
 }
-
-// Networked teleport functions
-void ABloodreadRogueCharacter::ServerTeleport_Implementation(FVector TargetLocation, FRotator TargetRotation)
-{
-    UE_LOG(LogTemp, Warning, TEXT("ServerTeleport: Server executing teleport to %s"), *TargetLocation.ToString());
-    
-    // Apply teleport on server with authority
-    bool bTeleportSuccess = TeleportTo(TargetLocation, TargetRotation);
-    if (!bTeleportSuccess)
-    {
-        // Try elevated position
-        FVector ElevatedLocation = TargetLocation + FVector(0, 0, 100.0f);
-        bTeleportSuccess = TeleportTo(ElevatedLocation, TargetRotation);
-        if (bTeleportSuccess)
-        {
-            TargetLocation = ElevatedLocation;
-        }
-    }
-    
-    if (!bTeleportSuccess)
-    {
-        // Force teleport
-        bTeleportSuccess = SetActorLocation(TargetLocation, false, nullptr, ETeleportType::TeleportPhysics);
-        if (bTeleportSuccess)
-        {
-            SetActorRotation(TargetRotation);
-            if (GetController())
-            {
-                GetController()->SetControlRotation(TargetRotation);
-            }
-        }
-    }
-    
-    if (bTeleportSuccess)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("ServerTeleport: SUCCESS - Replicating to clients"));
-        // Replicate the successful teleport to all clients
-        MulticastTeleport(TargetLocation, TargetRotation);
-        
-        // Apply movement speed boost on server
-        float CurrentSpeed = GetCharacterMovement()->MaxWalkSpeed;
-        GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed * (1.0f + MovementSpeedBonus);
-        
-        // Clear any existing speed boost timer
-        GetWorldTimerManager().ClearTimer(SpeedBoostTimerHandle);
-        
-        // Set timer to restore normal speed
-        GetWorldTimerManager().SetTimer(SpeedBoostTimerHandle, [this, CurrentSpeed]()
-        {
-            GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed;
-            UE_LOG(LogTemp, Warning, TEXT("Teleport speed boost ended"));
-        }, SpeedBoostDuration, false);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("ServerTeleport: FAILED - All teleport methods failed"));
-    }
-}
-
-void ABloodreadRogueCharacter::MulticastTeleport_Implementation(FVector TargetLocation, FRotator TargetRotation)
-{
-    UE_LOG(LogTemp, Warning, TEXT("MulticastTeleport: Applying teleport on client"));
-    
-    // Don't apply on server again (it already applied in ServerTeleport)
-    if (!HasAuthority())
-    {
-        // Apply teleport on client to match server
-        bool bTeleportSuccess = TeleportTo(TargetLocation, TargetRotation);
-        if (!bTeleportSuccess)
-        {
-            // Use force teleport on client
-            SetActorLocation(TargetLocation, false, nullptr, ETeleportType::TeleportPhysics);
-            SetActorRotation(TargetRotation);
-            if (GetController())
-            {
-                GetController()->SetControlRotation(TargetRotation);
-            }
-        }
-        
-        // Apply movement speed boost on client
-        float CurrentSpeed = GetCharacterMovement()->MaxWalkSpeed;
-        GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed * (1.0f + MovementSpeedBonus);
-        
-        // Clear any existing speed boost timer
-        GetWorldTimerManager().ClearTimer(SpeedBoostTimerHandle);
-        
-        // Set timer to restore normal speed
-        GetWorldTimerManager().SetTimer(SpeedBoostTimerHandle, [this, CurrentSpeed]()
-        {
-            GetCharacterMovement()->MaxWalkSpeed = CurrentSpeed;
-            UE_LOG(LogTemp, Warning, TEXT("Client teleport speed boost ended"));
-        }, SpeedBoostDuration, false);
-    }
-}
-
-
@@ -46,20 +46,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Rogue Abilities")
     void ShadowPush();
 
-    // Networked teleport functions
-    UFUNCTION(Server, Reliable, Category = "Rogue Abilities")
-    void ServerTeleport(FVector TargetLocation, FRotator TargetRotation);
-
-    UFUNCTION(NetMulticast, Reliable, Category = "Rogue Abilities")
-    void MulticastTeleport(FVector TargetLocation, FRotator TargetRotation);
-
     // Override attack for rogue-specific combat
     virtual void Attack() override;
 
-    // Movement speed boost tracking
-    UPROPERTY()
-    FTimerHandle SpeedBoostTimerHandle;
-
     // Rogue data initialization
     UFUNCTION(BlueprintCallable, Category = "Rogue")
     void InitializeRogueData();
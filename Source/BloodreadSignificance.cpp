@@ -0,0 +1,236 @@
+#include "BloodreadSignificance.h"
+#include "BloodreadBaseCharacter.h"
+#include "CharacterAnimationBudget.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/WidgetComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+namespace
+{
+    const TCHAR* SignificanceSection = TEXT("/Script/BloodreadGame.BloodreadSignificance");
+}
+
+void UBloodreadSignificanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetFloat(SignificanceSection, TEXT("MaxDistance"), MaxDistance, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("CombatWindow"), CombatWindow, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("DistanceWeight"), DistanceWeight, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("ScreenSizeWeight"), ScreenSizeWeight, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("ViewAngleWeight"), ViewAngleWeight, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("CombatWeight"), CombatWeight, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("HighThreshold"), HighThreshold, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("MediumThreshold"), MediumThreshold, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("LowThreshold"), LowThreshold, GGameIni);
+        GConfig->GetFloat(SignificanceSection, TEXT("UpdateInterval"), UpdateInterval, GGameIni);
+    }
+
+    // Normalise so the score stays in 0..1 whatever the configured weights add up to
+    const float WeightSum = DistanceWeight + ScreenSizeWeight + ViewAngleWeight + CombatWeight;
+    if (WeightSum > KINDA_SMALL_NUMBER)
+    {
+        DistanceWeight /= WeightSum;
+        ScreenSizeWeight /= WeightSum;
+        ViewAngleWeight /= WeightSum;
+        CombatWeight /= WeightSum;
+    }
+}
+
+void UBloodreadSignificanceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Animation rate follows significance instead of raw distance
+    if (UCharacterAnimationBudgetSubsystem* AnimationBudget = InWorld.GetSubsystem<UCharacterAnimationBudgetSubsystem>())
+    {
+        TWeakObjectPtr<UBloodreadSignificanceSubsystem> WeakThis(this);
+        AnimationBudget->SignificanceOverride = [WeakThis](const ABloodreadBaseCharacter* Character)
+        {
+            return WeakThis.IsValid() ? WeakThis->GetSignificance(Character) : 0.0f;
+        };
+    }
+}
+
+bool UBloodreadSignificanceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Significance is a view-dependent, cosmetic concept - dedicated servers have no view
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && World->GetNetMode() != NM_DedicatedServer;
+}
+
+TStatId UBloodreadSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBloodreadSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+UBloodreadSignificanceSubsystem* UBloodreadSignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UBloodreadSignificanceSubsystem>() : nullptr;
+}
+
+void UBloodreadSignificanceSubsystem::RegisterActor(AActor* Actor)
+{
+    if (!Actor || FindEntry(Actor))
+    {
+        return;
+    }
+
+    FSignificanceEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Actor = Actor;
+}
+
+void UBloodreadSignificanceSubsystem::NotifyCombat(AActor* Actor)
+{
+    UBloodreadSignificanceSubsystem* Subsystem = Get(Actor);
+    if (!Subsystem)
+    {
+        return;
+    }
+
+    for (FSignificanceEntry& Entry : Subsystem->Entries)
+    {
+        if (Entry.Actor.Get() == Actor)
+        {
+            Entry.LastCombatTime = Actor->GetWorld()->GetTimeSeconds();
+            return;
+        }
+    }
+}
+
+const UBloodreadSignificanceSubsystem::FSignificanceEntry* UBloodreadSignificanceSubsystem::FindEntry(const AActor* Actor) const
+{
+    return Entries.FindByPredicate([Actor](const FSignificanceEntry& Entry) { return Entry.Actor.Get() == Actor; });
+}
+
+float UBloodreadSignificanceSubsystem::GetSignificance(const AActor* Actor) const
+{
+    const FSignificanceEntry* Entry = FindEntry(Actor);
+    return Entry ? Entry->Score : 1.0f;
+}
+
+EBloodreadSignificanceTier UBloodreadSignificanceSubsystem::GetTier(const AActor* Actor) const
+{
+    // Untracked actors are treated as fully significant so nothing disappears by accident
+    const FSignificanceEntry* Entry = FindEntry(Actor);
+    return Entry ? Entry->Tier : EBloodreadSignificanceTier::High;
+}
+
+bool UBloodreadSignificanceSubsystem::ShouldPlayCosmetic(const AActor* Actor, EBloodreadSignificanceTier MinimumTier) const
+{
+    return GetTier(Actor) <= MinimumTier;
+}
+
+void UBloodreadSignificanceSubsystem::Tick(float DeltaTime)
+{
+    TimeSinceUpdate += DeltaTime;
+    if (TimeSinceUpdate < UpdateInterval)
+    {
+        return;
+    }
+    TimeSinceUpdate = 0.0f;
+    UpdateSignificance();
+}
+
+float UBloodreadSignificanceSubsystem::ScoreActor(const FSignificanceEntry& Entry, const FVector& ViewLocation, const FVector& ViewDirection, float TanHalfFOV, double Now) const
+{
+    const AActor* Actor = Entry.Actor.Get();
+
+    FVector Origin;
+    FVector Extent;
+    Actor->GetActorBounds(true, Origin, Extent);
+
+    const FVector ToActor = Origin - ViewLocation;
+    const float Distance = FMath::Max(ToActor.Size(), 1.0f);
+
+    const float DistanceTerm = 1.0f - FMath::Clamp(Distance / MaxDistance, 0.0f, 1.0f);
+
+    // Fraction of the view height the bounds occupy
+    const float ScreenSizeTerm = FMath::Clamp(Extent.Size() / (Distance * TanHalfFOV), 0.0f, 1.0f);
+
+    // 1 dead ahead, 0 at 90 degrees or behind
+    const float ViewAngleTerm = FMath::Max(0.0f, FVector::DotProduct(ToActor / Distance, ViewDirection));
+
+    const float CombatTerm = (Now - Entry.LastCombatTime) <= CombatWindow ? 1.0f : 0.0f;
+
+    return DistanceTerm * DistanceWeight + ScreenSizeTerm * ScreenSizeWeight + ViewAngleTerm * ViewAngleWeight + CombatTerm * CombatWeight;
+}
+
+EBloodreadSignificanceTier UBloodreadSignificanceSubsystem::ScoreToTier(float Score) const
+{
+    if (Score >= HighThreshold)
+    {
+        return EBloodreadSignificanceTier::High;
+    }
+    if (Score >= MediumThreshold)
+    {
+        return EBloodreadSignificanceTier::Medium;
+    }
+    if (Score >= LowThreshold)
+    {
+        return EBloodreadSignificanceTier::Low;
+    }
+    return EBloodreadSignificanceTier::Culled;
+}
+
+void UBloodreadSignificanceSubsystem::UpdateSignificance()
+{
+    UWorld* World = GetWorld();
+    APlayerController* LocalController = World ? World->GetFirstPlayerController() : nullptr;
+    if (!LocalController || !LocalController->IsLocalController())
+    {
+        return;
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    LocalController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    const FVector ViewDirection = ViewRotation.Vector();
+
+    const float FOVDegrees = LocalController->PlayerCameraManager ? LocalController->PlayerCameraManager->GetFOVAngle() : 90.0f;
+    const float TanHalfFOV = FMath::Max(FMath::Tan(FMath::DegreesToRadians(FOVDegrees * 0.5f)), KINDA_SMALL_NUMBER);
+    const double Now = World->GetTimeSeconds();
+    const APawn* LocalPawn = LocalController->GetPawn();
+
+    Entries.RemoveAllSwap([](const FSignificanceEntry& Entry) { return !Entry.Actor.IsValid(); });
+
+    for (FSignificanceEntry& Entry : Entries)
+    {
+        AActor* Actor = Entry.Actor.Get();
+
+        // The local player's own pawn is always the most significant thing on screen
+        Entry.Score = Actor == LocalPawn ? 1.0f : ScoreActor(Entry, ViewLocation, ViewDirection, TanHalfFOV, Now);
+
+        const EBloodreadSignificanceTier NewTier = ScoreToTier(Entry.Score);
+        if (NewTier != Entry.Tier)
+        {
+            const EBloodreadSignificanceTier OldTier = Entry.Tier;
+            Entry.Tier = NewTier;
+            ApplyTier(Actor, OldTier, NewTier);
+        }
+    }
+}
+
+void UBloodreadSignificanceSubsystem::ApplyTier(AActor* Actor, EBloodreadSignificanceTier OldTier, EBloodreadSignificanceTier NewTier)
+{
+    // Overhead health bars only draw (and tick their widget) while the actor isn't culled
+    const bool bShowWidgets = NewTier != EBloodreadSignificanceTier::Culled;
+    TInlineComponentArray<UWidgetComponent*> WidgetComponents(Actor);
+    for (UWidgetComponent* WidgetComponent : WidgetComponents)
+    {
+        WidgetComponent->SetVisibility(bShowWidgets);
+        WidgetComponent->SetHiddenInGame(!bShowWidgets);
+        WidgetComponent->SetComponentTickEnabled(bShowWidgets);
+    }
+
+    OnTierChanged.Broadcast(Actor, OldTier, NewTier);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BloodreadSignificance.generated.h"
+
+// Coarse significance bands used for LOD decisions (ordered most to least important)
+UENUM(BlueprintType)
+enum class EBloodreadSignificanceTier : uint8
+{
+    High        UMETA(DisplayName = "High"),
+    Medium      UMETA(DisplayName = "Medium"),
+    Low         UMETA(DisplayName = "Low"),
+    Culled      UMETA(DisplayName = "Culled")
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSignificanceTierChanged, AActor*, Actor, EBloodreadSignificanceTier, OldTier, EBloodreadSignificanceTier, NewTier);
+
+/**
+ * Client-side significance for characters and practice dummies.
+ * Scores each registered actor from distance, screen size, view angle and recent combat involvement
+ * (0..1, higher matters more), buckets it into a tier, and uses that to:
+ *  - rank characters for UCharacterAnimationBudgetSubsystem (animation rate)
+ *  - show/hide overhead health bar widget components
+ *  - gate cosmetic VFX and audio through ShouldPlayCosmetic / OnTierChanged
+ * Weights and thresholds come from [/Script/BloodreadGame.BloodreadSignificance] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UBloodreadSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Convenience lookup - returns nullptr on dedicated servers
+    static UBloodreadSignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+    // Track an actor (safe to call more than once); destroyed actors are pruned automatically
+    void RegisterActor(AActor* Actor);
+
+    // Mark an actor as involved in combat (hit, attacked) so it stays significant for CombatWindow seconds
+    static void NotifyCombat(AActor* Actor);
+
+    UFUNCTION(BlueprintPure, Category = "Significance")
+    float GetSignificance(const AActor* Actor) const;
+
+    UFUNCTION(BlueprintPure, Category = "Significance")
+    EBloodreadSignificanceTier GetTier(const AActor* Actor) const;
+
+    // True if a cosmetic (VFX, audio, widget refresh) on this actor should run at the given minimum tier
+    UFUNCTION(BlueprintPure, Category = "Significance")
+    bool ShouldPlayCosmetic(const AActor* Actor, EBloodreadSignificanceTier MinimumTier = EBloodreadSignificanceTier::Low) const;
+
+    UPROPERTY(BlueprintAssignable, Category = "Significance")
+    FOnSignificanceTierChanged OnTierChanged;
+
+private:
+    struct FSignificanceEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        float Score = 1.0f;
+        double LastCombatTime = -1.0e9;
+        EBloodreadSignificanceTier Tier = EBloodreadSignificanceTier::High;
+    };
+
+    void UpdateSignificance();
+    float ScoreActor(const FSignificanceEntry& Entry, const FVector& ViewLocation, const FVector& ViewDirection, float TanHalfFOV, double Now) const;
+    EBloodreadSignificanceTier ScoreToTier(float Score) const;
+    void ApplyTier(AActor* Actor, EBloodreadSignificanceTier OldTier, EBloodreadSignificanceTier NewTier);
+    const FSignificanceEntry* FindEntry(const AActor* Actor) const;
+
+    TArray<FSignificanceEntry> Entries;
+
+    // Beyond this distance the distance term is zero
+    float MaxDistance = 4000.0f;
+
+    // Seconds a combat notification keeps the combat term active
+    float CombatWindow = 3.0f;
+
+    // Score weights (normalised at load)
+    float DistanceWeight = 0.45f;
+    float ScreenSizeWeight = 0.2f;
+    float ViewAngleWeight = 0.2f;
+    float CombatWeight = 0.15f;
+
+    // Minimum score for each tier; below LowThreshold is Culled
+    float HighThreshold = 0.6f;
+    float MediumThreshold = 0.35f;
+    float LowThreshold = 0.1f;
+
+    // How often scores are recomputed (seconds)
+    float UpdateInterval = 0.2f;
+
+    float TimeSinceUpdate = 0.0f;
+};
@@ -0,0 +1,172 @@
+#include "BloodreadStats.h"
+
+DEFINE_STAT(STAT_BloodreadTargeting);
+DEFINE_STAT(STAT_BloodreadDamage);
+DEFINE_STAT(STAT_BloodreadKnockback);
+DEFINE_STAT(STAT_BloodreadAbility);
+DEFINE_STAT(STAT_BloodreadHUD);
+DEFINE_STAT(STAT_BloodreadSpawn);
+DEFINE_STAT(STAT_BloodreadAssetLoad);
+DEFINE_STAT(STAT_BloodreadCharacterInit);
+
+DEFINE_STAT(STAT_BloodreadDamageEvents);
+DEFINE_STAT(STAT_BloodreadKnockbacks);
+DEFINE_STAT(STAT_BloodreadAbilitiesCast);
+DEFINE_STAT(STAT_BloodreadSpawns);
+DEFINE_STAT(STAT_BloodreadAssetLoads);
+DEFINE_STAT(STAT_BloodreadCharacterInits);
+
+UE_TRACE_CHANNEL_DEFINE(BloodreadCombatChannel);
+
+UE_TRACE_EVENT_BEGIN(Bloodread, DamageEvent)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, TargetId)
+    UE_TRACE_EVENT_FIELD(uint32, AttackerId)
+    UE_TRACE_EVENT_FIELD(float, Amount)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Bloodread, KnockbackEvent)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, TargetId)
+    UE_TRACE_EVENT_FIELD(float, DirectionX)
+    UE_TRACE_EVENT_FIELD(float, DirectionY)
+    UE_TRACE_EVENT_FIELD(float, DirectionZ)
+    UE_TRACE_EVENT_FIELD(float, Force)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Bloodread, AbilityCastEvent)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, CasterId)
+    UE_TRACE_EVENT_FIELD(uint8, AbilityIndex)
+UE_TRACE_EVENT_END()
+
+namespace BloodreadHitch
+{
+    bool GCaptureEnabled = false;
+
+    namespace
+    {
+        constexpr int32 CombatEventCapacity = 64;
+
+        // Indexed by frame parity so the previous frame survives until the one after it starts
+        FFrameCapture Captures[2];
+
+        FCombatEventRecord CombatEvents[CombatEventCapacity];
+        int32 NextCombatEvent = 0;
+        int32 NumCombatEvents = 0;
+
+        FFrameCapture& GetCurrentCapture()
+        {
+            FFrameCapture& Capture = Captures[GFrameCounter & 1];
+            if (Capture.Frame != GFrameCounter)
+            {
+                Capture.Frame = GFrameCounter;
+                Capture.Scopes.Reset();
+                Capture.AssetLoads.Reset();
+            }
+            return Capture;
+        }
+
+        void AddCombatEvent(ECombatEventKind Kind, const UObject* Subject, const UObject* Other, float Value)
+        {
+            if (!GCaptureEnabled || !IsInGameThread())
+            {
+                return;
+            }
+
+            FCombatEventRecord& Record = CombatEvents[NextCombatEvent];
+            Record.Kind = Kind;
+            Record.Frame = GFrameCounter;
+            Record.Time = FPlatformTime::Seconds();
+            Record.Subject = Subject ? Subject->GetFName() : NAME_None;
+            Record.Other = Other ? Other->GetFName() : NAME_None;
+            Record.Value = Value;
+
+            NextCombatEvent = (NextCombatEvent + 1) % CombatEventCapacity;
+            NumCombatEvents = FMath::Min(NumCombatEvents + 1, CombatEventCapacity);
+        }
+    }
+
+    void AddScopeTime(const TCHAR* Name, uint64 Cycles)
+    {
+        FFrameCapture& Capture = GetCurrentCapture();
+        for (FScopeTiming& Timing : Capture.Scopes)
+        {
+            // Names are string literals from the macros, so pointer equality is enough
+            if (Timing.Name == Name)
+            {
+                Timing.Cycles += Cycles;
+                ++Timing.Calls;
+                return;
+            }
+        }
+        Capture.Scopes.Add({ Name, Cycles, 1 });
+    }
+
+    void NoteAssetLoad(const FString& Path)
+    {
+        if (GCaptureEnabled && IsInGameThread())
+        {
+            GetCurrentCapture().AssetLoads.Add(Path);
+        }
+    }
+
+    const FFrameCapture* GetFrameCapture(uint64 Frame)
+    {
+        const FFrameCapture& Capture = Captures[Frame & 1];
+        return Capture.Frame == Frame ? &Capture : nullptr;
+    }
+
+    void GetRecentCombatEvents(TArray<FCombatEventRecord>& OutEvents)
+    {
+        OutEvents.Reset(NumCombatEvents);
+        const int32 First = (NextCombatEvent - NumCombatEvents + CombatEventCapacity) % CombatEventCapacity;
+        for (int32 Index = 0; Index < NumCombatEvents; ++Index)
+        {
+            OutEvents.Add(CombatEvents[(First + Index) % CombatEventCapacity]);
+        }
+    }
+}
+
+namespace BloodreadTrace
+{
+    void Damage(const UObject* Target, const UObject* Attacker, float Amount)
+    {
+        INC_DWORD_STAT(STAT_BloodreadDamageEvents);
+        UE_TRACE_LOG(Bloodread, DamageEvent, BloodreadCombatChannel)
+            << DamageEvent.Cycle(FPlatformTime::Cycles64())
+            << DamageEvent.TargetId(Target ? Target->GetUniqueID() : 0)
+            << DamageEvent.AttackerId(Attacker ? Attacker->GetUniqueID() : 0)
+            << DamageEvent.Amount(Amount);
+        BloodreadHitch::AddCombatEvent(BloodreadHitch::ECombatEventKind::Damage, Target, Attacker, Amount);
+    }
+
+    void Knockback(const UObject* Target, const FVector& Direction, float Force)
+    {
+        INC_DWORD_STAT(STAT_BloodreadKnockbacks);
+        UE_TRACE_LOG(Bloodread, KnockbackEvent, BloodreadCombatChannel)
+            << KnockbackEvent.Cycle(FPlatformTime::Cycles64())
+            << KnockbackEvent.TargetId(Target ? Target->GetUniqueID() : 0)
+            << KnockbackEvent.DirectionX(static_cast<float>(Direction.X))
+            << KnockbackEvent.DirectionY(static_cast<float>(Direction.Y))
+            << KnockbackEvent.DirectionZ(static_cast<float>(Direction.Z))
+            << KnockbackEvent.Force(Force);
+        BloodreadHitch::AddCombatEvent(BloodreadHitch::ECombatEventKind::Knockback, Target, nullptr, Force);
+    }
+
+    void AbilityCast(const UObject* Caster, int32 AbilityIndex)
+    {
+        INC_DWORD_STAT(STAT_BloodreadAbilitiesCast);
+        UE_TRACE_LOG(Bloodread, AbilityCastEvent, BloodreadCombatChannel)
+            << AbilityCastEvent.Cycle(FPlatformTime::Cycles64())
+            << AbilityCastEvent.CasterId(Caster ? Caster->GetUniqueID() : 0)
+            << AbilityCastEvent.AbilityIndex(static_cast<uint8>(AbilityIndex));
+        BloodreadHitch::AddCombatEvent(BloodreadHitch::ECombatEventKind::AbilityCast, Caster, nullptr, static_cast<float>(AbilityIndex));
+    }
+
+    void AssetLoad(const FString& Path)
+    {
+        INC_DWORD_STAT(STAT_BloodreadAssetLoads);
+        BloodreadHitch::NoteAssetLoad(Path);
+    }
+}
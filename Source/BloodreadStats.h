@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/*
+ * Profiling for game code: "stat Bloodread" in game, and named CPU scopes in Unreal Insights.
+ * Combat scopes and events go on their own trace channel, so a capture can take them alone:
+ *   -trace=cpu,BloodreadCombat        (or "Trace.Enable BloodreadCombat" at runtime)
+ */
+
+DECLARE_STATS_GROUP(TEXT("Bloodread"), STATGROUP_Bloodread, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Targeting"), STAT_BloodreadTargeting, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage"), STAT_BloodreadDamage, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Knockback"), STAT_BloodreadKnockback, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ability Execution"), STAT_BloodreadAbility, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Update"), STAT_BloodreadHUD, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn & Possess"), STAT_BloodreadSpawn, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Asset Loads"), STAT_BloodreadAssetLoad, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Init"), STAT_BloodreadCharacterInit, STATGROUP_Bloodread, BLOODREADGAME_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Events"), STAT_BloodreadDamageEvents, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Knockbacks"), STAT_BloodreadKnockbacks, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Abilities Cast"), STAT_BloodreadAbilitiesCast, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Characters Spawned"), STAT_BloodreadSpawns, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Synchronous Asset Loads"), STAT_BloodreadAssetLoads, STATGROUP_Bloodread, BLOODREADGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Character Init Passes"), STAT_BloodreadCharacterInits, STATGROUP_Bloodread, BLOODREADGAME_API);
+
+UE_TRACE_CHANNEL_EXTERN(BloodreadCombatChannel, BLOODREADGAME_API);
+
+/*
+ * Hitch capture (read by UHitchDetectorSubsystem). While a detector is running, game-thread Bloodread scopes add
+ * their inclusive time to a per-frame table, synchronous loads note their path, and combat events go into a ring
+ * buffer, so a slow frame can be explained after it has finished. All of it is skipped when no detector is running.
+ */
+namespace BloodreadHitch
+{
+    struct FScopeTiming
+    {
+        const TCHAR* Name = nullptr;
+        uint64 Cycles = 0;
+        int32 Calls = 0;
+    };
+
+    struct FFrameCapture
+    {
+        uint64 Frame = 0;
+        TArray<FScopeTiming, TInlineAllocator<16>> Scopes;
+        TArray<FString, TInlineAllocator<4>> AssetLoads;
+    };
+
+    enum class ECombatEventKind : uint8
+    {
+        Damage,
+        Knockback,
+        AbilityCast
+    };
+
+    struct FCombatEventRecord
+    {
+        ECombatEventKind Kind = ECombatEventKind::Damage;
+        uint64 Frame = 0;
+        double Time = 0.0;
+        FName Subject;
+        FName Other;
+        float Value = 0.0f;
+    };
+
+    // Set while at least one hitch detector is running
+    extern BLOODREADGAME_API bool GCaptureEnabled;
+
+    BLOODREADGAME_API void AddScopeTime(const TCHAR* Name, uint64 Cycles);
+    BLOODREADGAME_API void NoteAssetLoad(const FString& Path);
+
+    // Capture for the given GFrameCounter value; only the current and previous frames are kept
+    BLOODREADGAME_API const FFrameCapture* GetFrameCapture(uint64 Frame);
+
+    // Oldest first
+    BLOODREADGAME_API void GetRecentCombatEvents(TArray<FCombatEventRecord>& OutEvents);
+
+    struct FScopeTimer
+    {
+        explicit FScopeTimer(const TCHAR* InName)
+            : Name(GCaptureEnabled && IsInGameThread() ? InName : nullptr)
+            , StartCycles(Name ? FPlatformTime::Cycles64() : 0)
+        {
+        }
+
+        ~FScopeTimer()
+        {
+            if (Name)
+            {
+                AddScopeTime(Name, FPlatformTime::Cycles64() - StartCycles);
+            }
+        }
+
+        const TCHAR* Name;
+        uint64 StartCycles;
+    };
+}
+
+// Cycle counter plus an Insights CPU scope of the same name on the combat channel
+#define BLOODREAD_COMBAT_SCOPE(StatName) \
+    SCOPE_CYCLE_COUNTER(StatName); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(StatName, BloodreadCombatChannel); \
+    BloodreadHitch::FScopeTimer ANONYMOUS_VARIABLE(HitchScope_)(TEXT(#StatName))
+
+// Cycle counter plus an Insights CPU scope of the same name (regular cpu channel)
+#define BLOODREAD_SCOPE(StatName) \
+    SCOPE_CYCLE_COUNTER(StatName); \
+    TRACE_CPUPROFILER_EVENT_SCOPE(StatName); \
+    BloodreadHitch::FScopeTimer ANONYMOUS_VARIABLE(HitchScope_)(TEXT(#StatName))
+
+// Discrete combat events for the trace (BloodreadCombat channel); ids are UObject unique ids
+namespace BloodreadTrace
+{
+    BLOODREADGAME_API void Damage(const UObject* Target, const UObject* Attacker, float Amount);
+    BLOODREADGAME_API void Knockback(const UObject* Target, const FVector& Direction, float Force);
+    BLOODREADGAME_API void AbilityCast(const UObject* Caster, int32 AbilityIndex);
+
+    // Counts a synchronous asset load and notes its path for hitch reports
+    BLOODREADGAME_API void AssetLoad(const FString& Path);
+}
@@ -1,4 +1,5 @@
 #include "BloodreadWarriorCharacter.h"
+#include "BloodreadStats.h"
 #include "Engine/Engine.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Animation/AnimBlueprint.h"
@@ -18,8 +19,7 @@ void ABloodreadWarriorCharacter::BeginPlay()
     Super::BeginPlay();
     
     // Apply warrior-specific initialization
-    InitializeWarriorData();
-    InitializeFromClassData(CharacterClassData);
+    InitializeFromClass(ECharacterClass::Warrior);
 }
 
 void ABloodreadWarriorCharacter::OnCharacterClassChanged()
@@ -30,6 +30,7 @@ void ABloodreadWarriorCharacter::OnCharacterClassChanged()
 
 bool ABloodreadWarriorCharacter::OnAbility1Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility1Used();
     HexPunch();
     return true;
@@ -37,6 +38,7 @@ bool ABloodreadWarriorCharacter::OnAbility1Used()
 
 bool ABloodreadWarriorCharacter::OnAbility2Used()
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadAbility);
     Super::OnAbility2Used();
     PowerShield();
     return true;
@@ -97,20 +99,18 @@ void ABloodreadWarriorCharacter::PowerShield()
     // This function is called from OnAbility2Used() after the base checks pass
     
     // Add temporary health (shield)
-    int32 NewMaxHealth = CurrentStats.MaxHealth + ShieldHealthBonus;
-    int32 NewCurrentHealth = CurrentHealth + ShieldHealthBonus;
-    
-    // Set temporary max health
-    CurrentStats.MaxHealth = NewMaxHealth;
-    CurrentHealth = NewCurrentHealth;
+    FCombatantStats Stats = GetCombatantStats();
+    FCombatRules::AddShield(Stats, static_cast<int32>(ShieldHealthBonus));
+    SetCombatantStats(Stats);
     
     // Start shield duration timer
     FTimerHandle ShieldTimerHandle;
     GetWorldTimerManager().SetTimer(ShieldTimerHandle, [this]()
     {
         // Remove shield after duration
-        CurrentStats.MaxHealth -= ShieldHealthBonus;
-        CurrentHealth = FMath::Min(CurrentHealth, CurrentStats.MaxHealth);
+        FCombatantStats ShieldStats = GetCombatantStats();
+        FCombatRules::RemoveShield(ShieldStats, static_cast<int32>(ShieldHealthBonus));
+        SetCombatantStats(ShieldStats);
         UE_LOG(LogTemp, Warning, TEXT("Power Shield expired"));
     }, ShieldDuration, false);
     
@@ -118,10 +118,9 @@ void ABloodreadWarriorCharacter::PowerShield()
     FTimerHandle RegenTimerHandle;
     GetWorldTimerManager().SetTimer(RegenTimerHandle, [this]()
     {
-        if (CurrentHealth < CurrentStats.MaxHealth)
-        {
-            CurrentHealth = FMath::Min(CurrentHealth + ShieldRegenRate, CurrentStats.MaxHealth);
-        }
+        FCombatantStats RegenStats = GetCombatantStats();
+        FCombatRules::ApplyHeal(RegenStats, static_cast<int32>(ShieldRegenRate));
+        SetCombatantStats(RegenStats);
     }, 1.0f, true, 0.0f); // Start immediately, repeat every second
     
     // Clear regen timer after 4 seconds
@@ -175,62 +174,6 @@ void ABloodreadWarriorCharacter::Attack()
 
 void ABloodreadWarriorCharacter::InitializeWarriorData()
 {
-    // Set character class
-    CurrentCharacterClass = ECharacterClass::Warrior;
-    
-    // Initialize warrior stats (based on new specification)
-    FCharacterStats WarriorStats;
-    WarriorStats.MaxHealth = 120;  // 120 base health
-    WarriorStats.Strength = 18;    // High strength
-    WarriorStats.Defense = 12;     // High defense
-    WarriorStats.Speed = 8;        // Lower speed
-    WarriorStats.Mana = 100;       // Starting mana
-    WarriorStats.CriticalChance = 0.15f;
-    
-    // Initialize warrior abilities (new system)
-    FCharacterAbilityData HexPunchAbility;
-    HexPunchAbility.Name = "Hex Punch";
-    HexPunchAbility.Description = "Pull enemies to your location in a smooth motion and deal damage";
-    HexPunchAbility.Type = EAbilityType::Damage;
-    HexPunchAbility.Cooldown = 15.0f;  // 15 second cooldown
-    HexPunchAbility.ManaCost = 100;    // Costs 100 mana
-    HexPunchAbility.Damage = 10.0f;    // Deals 10 damage
-    HexPunchAbility.Duration = 0.5f;   // Pull duration
-    
-    FCharacterAbilityData PowerShieldAbility;
-    PowerShieldAbility.Name = "Power Shield";
-    PowerShieldAbility.Description = "Gain a shield that adds temporary health and regeneration";
-    PowerShieldAbility.Type = EAbilityType::Defense;
-    PowerShieldAbility.Cooldown = 15.0f;  // 15 second cooldown
-    PowerShieldAbility.ManaCost = 30;     // Costs 30 mana
-    PowerShieldAbility.Damage = 0.0f;     // No direct damage
-    PowerShieldAbility.Duration = 10.0f;  // Shield lasts 10 seconds
-    
-    // Set up character class data
-    CharacterClassData.CharacterClass = ECharacterClass::Warrior;
-    CharacterClassData.ClassName = "Warrior";
-    CharacterClassData.Description = "A mighty melee fighter with high health and devastating close-combat abilities";
-    CharacterClassData.BaseStats = WarriorStats;
-    CharacterClassData.Ability1 = HexPunchAbility;
-    CharacterClassData.Ability2 = PowerShieldAbility;
-    
-    // Set warrior mesh (Gideon character)
-    CharacterClassData.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Meshes/Gideon.Gideon")));
-    
-    // Set warrior animation blueprint path (will be loaded later by the system)
-    CharacterClassData.AnimationBlueprintPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Gideon_AnimBlueprint.Gideon_AnimBlueprint_C");
-    UE_LOG(LogTemp, Warning, TEXT("Set Gideon animation blueprint path: %s"), *CharacterClassData.AnimationBlueprintPath);
-    
-    // Set warrior attack animation paths (using actual existing animation files)
-    CharacterClassData.BasicAttackAnimationPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Primary_Attack_A_Medium.Primary_Attack_A_Medium");
-    CharacterClassData.Ability1AnimationPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Burden_Start.Burden_Start");
-    CharacterClassData.Ability2AnimationPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Cosmic_Rift.Cosmic_Rift");
-    
-    // Set camera offset adjusted for Gideon character
-    CharacterClassData.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
-    
-    // Apply stats
-    CurrentStats = WarriorStats;
-    CurrentHealth = CurrentStats.MaxHealth;
-    CurrentMana = CurrentStats.Mana;
+    // Stats, abilities, mesh and animation paths are defined once in FCharacterClassRegistry
+    BindClassDefinition(ECharacterClass::Warrior);
 }
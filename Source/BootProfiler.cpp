@@ -0,0 +1,276 @@
+#include "BootProfiler.h"
+#include "BloodreadGame.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace BloodreadBoot
+{
+    namespace
+    {
+        const TCHAR* ConfigSection = TEXT("/Script/BloodreadGame.BootProfiler");
+
+        struct FModuleLoadTiming
+        {
+            FName Name;
+            double Seconds = 0.0;
+        };
+
+        // Settings
+        bool bEnabled = true;
+        bool bServerOnly = true;
+        bool bWriteCsv = true;
+        float BudgetSeconds = 3.0f;
+        int32 TopModules = 8;
+
+        // Phase marks, in seconds since process start (0 = not reached)
+        double ModuleStartupTime = 0.0;
+        double EngineInitTime = 0.0;
+        double MapLoadStartTime = 0.0;
+        double MapLoadEndTime = 0.0;
+        FString BootMapName;
+
+        bool bActive = false;
+        bool bFinished = false;
+
+        TArray<FModuleLoadTiming> ModuleLoads;
+        double LastModuleEventTime = 0.0;
+
+        int32 AssetLoadDepth = 0;
+        int32 AssetLoadCount = 0;
+        double AssetLoadSeconds = 0.0;
+
+        FDelegateHandle PostEngineInitHandle;
+        FDelegateHandle PreLoadMapHandle;
+        FDelegateHandle PostLoadMapHandle;
+
+        void Mark(const TCHAR* Phase, double& OutTime)
+        {
+            OutTime = GetSecondsSinceStart();
+            TRACE_BOOKMARK(TEXT("Boot: %s"), Phase);
+        }
+
+        bool IsOnlineModule(FName ModuleName)
+        {
+            const FString Name = ModuleName.ToString();
+            return Name.StartsWith(TEXT("OnlineSubsystem")) || Name.StartsWith(TEXT("AdvancedSessions"))
+                || Name.StartsWith(TEXT("AdvancedSteamSessions")) || Name.StartsWith(TEXT("Steam"));
+        }
+
+        void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+        {
+            if (Reason != EModuleChangeReason::ModuleLoaded || bFinished)
+            {
+                return;
+            }
+
+            // Loads are sequential on the game thread, so the gap since the previous one covers this module's
+            // load and StartupModule (the online subsystem creates its platform service there)
+            const double Now = FPlatformTime::Seconds();
+            const double Start = LastModuleEventTime > 0.0 ? LastModuleEventTime : Now;
+            ModuleLoads.Add({ ModuleName, Now - Start });
+            LastModuleEventTime = Now;
+        }
+
+        // Registered during static initialisation so monolithic builds (server, game) see modules loaded before ours
+        struct FModuleLoadHook
+        {
+            FModuleLoadHook()
+            {
+                LastModuleEventTime = FPlatformTime::Seconds();
+                FModuleManager::Get().OnModulesChanged().AddStatic(&OnModulesChanged);
+            }
+        };
+        FModuleLoadHook GModuleLoadHook;
+
+        void WriteCsvRow(FString Row)
+        {
+            const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("BootTimes.csv"));
+            UE::Tasks::Launch(UE_SOURCE_LOCATION, [Path, Row = MoveTemp(Row)]()
+            {
+                FString Text;
+                if (!IFileManager::Get().FileExists(*Path))
+                {
+                    Text = TEXT("UtcTime,Map,Server,TotalMs,PreInitMs,EngineInitMs,GameStartupMs,MapLoadMs,OnlineSubsystemMs,AssetLoadMs,AssetLoads\n");
+                }
+                Text += Row;
+                FFileHelper::SaveStringToFile(Text, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+                                              &IFileManager::Get(), FILEWRITE_Append);
+            }, ETaskPriority::BackgroundNormal);
+        }
+
+        void Finish()
+        {
+            bFinished = true;
+            Stop();
+
+            // A phase that was never reached takes no time
+            const double EngineInit = FMath::Max(EngineInitTime, ModuleStartupTime);
+            const double MapStart = FMath::Max(MapLoadStartTime, EngineInit);
+            const double PreInitMs = ModuleStartupTime * 1000.0;
+            const double EngineInitMs = (EngineInit - ModuleStartupTime) * 1000.0;
+            const double GameStartupMs = (MapStart - EngineInit) * 1000.0;
+            const double MapLoadMs = (MapLoadEndTime - MapStart) * 1000.0;
+            const double TotalMs = MapLoadEndTime * 1000.0;
+
+            double OnlineMs = 0.0;
+            int32 OnlineModules = 0;
+            for (const FModuleLoadTiming& Load : ModuleLoads)
+            {
+                if (IsOnlineModule(Load.Name))
+                {
+                    OnlineMs += Load.Seconds * 1000.0;
+                    ++OnlineModules;
+                }
+            }
+
+            const bool bOverBudget = MapLoadEndTime > BudgetSeconds;
+            FString Report = FString::Printf(TEXT("BootProfiler: Cold start %.0f ms to %s (budget %.0f ms)%s\n"),
+                TotalMs, *BootMapName, BudgetSeconds * 1000.0f, bOverBudget ? TEXT(" - OVER BUDGET") : TEXT(""));
+            Report += FString::Printf(TEXT("  Pre-init           %8.1f ms\n"), PreInitMs);
+            Report += FString::Printf(TEXT("  Engine init        %8.1f ms\n"), EngineInitMs);
+            Report += FString::Printf(TEXT("  Game startup       %8.1f ms\n"), GameStartupMs);
+            Report += FString::Printf(TEXT("  Map load           %8.1f ms\n"), MapLoadMs);
+            Report += FString::Printf(TEXT("  Online subsystem   %8.1f ms (%d modules)\n"), OnlineMs, OnlineModules);
+            Report += FString::Printf(TEXT("  Class asset loads  %8.1f ms (%d loads)\n"), AssetLoadSeconds * 1000.0, AssetLoadCount);
+
+            ModuleLoads.Sort([](const FModuleLoadTiming& A, const FModuleLoadTiming& B) { return A.Seconds > B.Seconds; });
+            Report += FString::Printf(TEXT("  Slowest of %d module loads:"), ModuleLoads.Num());
+            for (int32 Index = 0; Index < FMath::Min(TopModules, ModuleLoads.Num()); ++Index)
+            {
+                Report += FString::Printf(TEXT("\n    %-32s %8.1f ms"), *ModuleLoads[Index].Name.ToString(), ModuleLoads[Index].Seconds * 1000.0);
+            }
+
+            if (bOverBudget)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("%s"), *Report);
+            }
+            else
+            {
+                UE_LOG(LogTemp, Log, TEXT("%s"), *Report);
+            }
+
+            if (bWriteCsv)
+            {
+                WriteCsvRow(FString::Printf(TEXT("%s,%s,%d,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%d\n"),
+                    *FDateTime::UtcNow().ToIso8601(), *BootMapName, BloodreadCosmetics::IsServerProcess() ? 1 : 0,
+                    TotalMs, PreInitMs, EngineInitMs, GameStartupMs, MapLoadMs, OnlineMs, AssetLoadSeconds * 1000.0, AssetLoadCount));
+            }
+
+            ModuleLoads.Empty();
+        }
+    }
+
+    void Start()
+    {
+        if (GConfig)
+        {
+            GConfig->GetBool(ConfigSection, TEXT("bEnabled"), bEnabled, GGameIni);
+            GConfig->GetBool(ConfigSection, TEXT("bServerOnly"), bServerOnly, GGameIni);
+            GConfig->GetBool(ConfigSection, TEXT("bWriteCsv"), bWriteCsv, GGameIni);
+            GConfig->GetFloat(ConfigSection, TEXT("BudgetSeconds"), BudgetSeconds, GGameIni);
+            GConfig->GetInt(ConfigSection, TEXT("TopModules"), TopModules, GGameIni);
+        }
+
+        if (!bEnabled || (bServerOnly && !BloodreadCosmetics::IsServerProcess()) || GIsEditor)
+        {
+            bFinished = true;
+            ModuleLoads.Empty();
+            return;
+        }
+
+        bActive = true;
+        Mark(TEXT("Game module startup"), ModuleStartupTime);
+
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddLambda([]()
+        {
+            Mark(TEXT("Engine initialized"), EngineInitTime);
+        });
+
+        PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddLambda([](const FString& MapName)
+        {
+            if (MapLoadStartTime == 0.0)
+            {
+                BootMapName = FPaths::GetBaseFilename(MapName);
+                Mark(TEXT("Map load started"), MapLoadStartTime);
+            }
+        });
+
+        PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddLambda([](UWorld* World)
+        {
+            if (World && World->IsGameWorld() && !bFinished)
+            {
+                if (BootMapName.IsEmpty())
+                {
+                    BootMapName = World->GetMapName();
+                }
+                Mark(TEXT("Map loaded"), MapLoadEndTime);
+                Finish();
+            }
+        });
+    }
+
+    void Stop()
+    {
+        FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+        FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+        FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+        PostEngineInitHandle.Reset();
+        PreLoadMapHandle.Reset();
+        PostLoadMapHandle.Reset();
+        bActive = false;
+    }
+
+    bool IsBooting()
+    {
+        return bActive && !bFinished;
+    }
+
+    double GetSecondsSinceStart()
+    {
+        return FPlatformTime::Seconds() - GStartTime;
+    }
+
+    FAssetLoadScope::FAssetLoadScope()
+    {
+        if (IsBooting() && IsInGameThread())
+        {
+            bTracked = true;
+            bOutermost = AssetLoadDepth++ == 0;
+            StartTime = FPlatformTime::Seconds();
+        }
+    }
+
+    FAssetLoadScope::~FAssetLoadScope()
+    {
+        if (!bTracked)
+        {
+            return;
+        }
+
+        --AssetLoadDepth;
+        if (bOutermost)
+        {
+            AssetLoadSeconds += FPlatformTime::Seconds() - StartTime;
+            ++AssetLoadCount;
+        }
+    }
+}
+
+void FBloodreadGameModule::StartupModule()
+{
+    FDefaultGameModuleImpl::StartupModule();
+    BloodreadBoot::Start();
+}
+
+void FBloodreadGameModule::ShutdownModule()
+{
+    BloodreadBoot::Stop();
+    FDefaultGameModuleImpl::ShutdownModule();
+}
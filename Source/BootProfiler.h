@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+/**
+ * Cold-start breakdown, measured from process start (GStartTime) to the first game map finishing its load:
+ *   Pre-init       core, config, paks and the modules loaded before the game module
+ *   Engine init    game module startup to FCoreDelegates::OnPostEngineInit
+ *   Game startup   engine init to the first map load starting (game instance, net driver, online subsystem)
+ *   Map load       PreLoadMap to PostLoadMapWithWorld
+ * plus the time spent in every module load (the gap since the previous module finished, so startup work is included),
+ * with the online subsystem modules summed separately, and the synchronous class asset loads made while booting.
+ * The table goes to the log and a row is appended to Saved/Profiling/BootTimes.csv; each phase is also an Insights
+ * bookmark. Settings come from [/Script/BloodreadGame.BootProfiler] in DefaultGame.ini.
+ */
+namespace BloodreadBoot
+{
+    // Called from the game module's StartupModule; hooks the engine and map load delegates
+    void Start();
+
+    // Called from ShutdownModule
+    void Stop();
+
+    // True until the first game map has loaded
+    BLOODREADGAME_API bool IsBooting();
+
+    // Seconds since the process started
+    BLOODREADGAME_API double GetSecondsSinceStart();
+
+    // Times a class asset load made while booting; nested scopes only count once
+    struct BLOODREADGAME_API FAssetLoadScope
+    {
+        FAssetLoadScope();
+        ~FAssetLoadScope();
+
+    private:
+        double StartTime = 0.0;
+        bool bTracked = false;
+        bool bOutermost = false;
+    };
+}
+
+/** Game module; starts the boot profiler as soon as the module is loaded */
+class FBloodreadGameModule : public FDefaultGameModuleImpl
+{
+public:
+    virtual void StartupModule() override;
+    virtual void ShutdownModule() override;
+};
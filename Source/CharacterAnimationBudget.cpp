@@ -0,0 +1,133 @@
+#include "CharacterAnimationBudget.h"
+#include "BloodreadBaseCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+
+namespace
+{
+    const TCHAR* AnimationBudgetSection = TEXT("/Script/BloodreadGame.CharacterAnimationBudget");
+
+    struct FRankedCharacter
+    {
+        USkeletalMeshComponent* Mesh;
+        float Score;
+        bool bRendered;
+    };
+}
+
+void UCharacterAnimationBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetFloat(AnimationBudgetSection, TEXT("BudgetMs"), BudgetMs, GGameIni);
+        GConfig->GetFloat(AnimationBudgetSection, TEXT("EstimatedCharacterCostMs"), EstimatedCharacterCostMs, GGameIni);
+        GConfig->GetFloat(AnimationBudgetSection, TEXT("ReducedUpdateRate"), ReducedUpdateRate, GGameIni);
+        GConfig->GetFloat(AnimationBudgetSection, TEXT("OffscreenUpdateRate"), OffscreenUpdateRate, GGameIni);
+        GConfig->GetFloat(AnimationBudgetSection, TEXT("ReevaluateInterval"), ReevaluateInterval, GGameIni);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CharacterAnimationBudget: %.2fms budget, %.2fms per character, reduced %.0fHz, offscreen %.0fHz"),
+           BudgetMs, EstimatedCharacterCostMs, ReducedUpdateRate, OffscreenUpdateRate);
+}
+
+bool UCharacterAnimationBudgetSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Nothing is rendered on a dedicated server - characters handle their own server pose mode
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && World->GetNetMode() != NM_DedicatedServer;
+}
+
+TStatId UCharacterAnimationBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCharacterAnimationBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void UCharacterAnimationBudgetSubsystem::Tick(float DeltaTime)
+{
+    TimeSinceReevaluate += DeltaTime;
+    if (TimeSinceReevaluate < ReevaluateInterval)
+    {
+        return;
+    }
+    TimeSinceReevaluate = 0.0f;
+    ReevaluateBudget();
+}
+
+float UCharacterAnimationBudgetSubsystem::ScoreCharacter(const ABloodreadBaseCharacter* Character, const FVector& ViewLocation) const
+{
+    if (SignificanceOverride)
+    {
+        return SignificanceOverride(Character);
+    }
+
+    // Closer is more significant; the +1 keeps the score finite at zero distance
+    return 1.0f / (FVector::Dist(Character->GetActorLocation(), ViewLocation) + 1.0f);
+}
+
+void UCharacterAnimationBudgetSubsystem::ReevaluateBudget()
+{
+    UWorld* World = GetWorld();
+    APlayerController* LocalController = World ? World->GetFirstPlayerController() : nullptr;
+    if (!LocalController || !LocalController->IsLocalController())
+    {
+        return;
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    LocalController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+    TArray<FRankedCharacter, TInlineAllocator<16>> Ranked;
+    for (ABloodreadBaseCharacter* Character : TActorRange<ABloodreadBaseCharacter>(World))
+    {
+        USkeletalMeshComponent* Mesh = Character->GetMesh();
+        if (!Mesh || Character->IsLocallyControlled())
+        {
+            continue;
+        }
+        Ranked.Add({ Mesh, ScoreCharacter(Character, ViewLocation), Mesh->WasRecentlyRendered(0.2f) });
+    }
+
+    // On-screen characters first, then by score
+    Ranked.Sort([](const FRankedCharacter& A, const FRankedCharacter& B)
+    {
+        return A.bRendered != B.bRendered ? A.bRendered : A.Score > B.Score;
+    });
+
+    const int32 FullRateSlots = EstimatedCharacterCostMs > 0.0f ? FMath::FloorToInt(BudgetMs / EstimatedCharacterCostMs) : Ranked.Num();
+    const float ReducedInterval = ReducedUpdateRate > 0.0f ? 1.0f / ReducedUpdateRate : 0.0f;
+    const float OffscreenInterval = OffscreenUpdateRate > 0.0f ? 1.0f / OffscreenUpdateRate : 0.0f;
+
+    FullRateCount = 0;
+    for (int32 Index = 0; Index < Ranked.Num(); ++Index)
+    {
+        const FRankedCharacter& Entry = Ranked[Index];
+        float TickInterval = 0.0f;
+        if (!Entry.bRendered)
+        {
+            TickInterval = OffscreenInterval;
+        }
+        else if (Index >= FullRateSlots)
+        {
+            TickInterval = ReducedInterval;
+        }
+        else
+        {
+            ++FullRateCount;
+        }
+
+        if (!FMath::IsNearlyEqual(Entry.Mesh->GetComponentTickInterval(), TickInterval))
+        {
+            Entry.Mesh->SetComponentTickInterval(TickInterval);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CharacterAnimationBudget.generated.h"
+
+class ABloodreadBaseCharacter;
+
+/**
+ * Client-side animation budget for remote characters.
+ * Every ReevaluateInterval the remote characters are ranked by significance (on screen, then distance to the
+ * local view) and the most significant ones that fit in BudgetMs animate every frame; the rest drop to a
+ * reduced mesh tick rate, with URO interpolating the skipped frames. Settings come from
+ * [/Script/BloodreadGame.CharacterAnimationBudget] in DefaultGame.ini. Does nothing on dedicated servers,
+ * where characters skip bone evaluation outside of hit detection windows instead.
+ */
+UCLASS()
+class BLOODREADGAME_API UCharacterAnimationBudgetSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Optional significance override (higher = more important); used instead of the built-in distance score when bound
+    TFunction<float(const ABloodreadBaseCharacter*)> SignificanceOverride;
+
+    // Number of remote characters currently animating at full rate
+    int32 GetFullRateCount() const { return FullRateCount; }
+
+private:
+    void ReevaluateBudget();
+    float ScoreCharacter(const ABloodreadBaseCharacter* Character, const FVector& ViewLocation) const;
+
+    // Per-frame game thread budget for remote character animation
+    float BudgetMs = 2.0f;
+
+    // Estimated evaluation cost of one character mesh, used to turn BudgetMs into a character count
+    float EstimatedCharacterCostMs = 0.25f;
+
+    // Mesh tick rate (Hz) for on-screen characters that didn't fit in the budget
+    float ReducedUpdateRate = 15.0f;
+
+    // Mesh tick rate (Hz) for characters that haven't been rendered recently
+    float OffscreenUpdateRate = 4.0f;
+
+    // How often the ranking is rebuilt (seconds)
+    float ReevaluateInterval = 0.25f;
+
+    float TimeSinceReevaluate = 0.0f;
+    int32 FullRateCount = 0;
+};
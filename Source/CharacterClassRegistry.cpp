@@ -0,0 +1,216 @@
+#include "CharacterClassRegistry.h"
+#include "BloodreadStats.h"
+#include "BloodreadDragonCharacter.h"
+#include "BootProfiler.h"
+#include "Misc/ConfigCacheIni.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace
+{
+    FCharacterAbilityData MakeAbility(const TCHAR* Name, const TCHAR* Description, EAbilityType Type,
+                                      float Cooldown, int32 ManaCost, float Damage, float Duration)
+    {
+        FCharacterAbilityData Ability;
+        Ability.Name = Name;
+        Ability.Description = Description;
+        Ability.Type = Type;
+        Ability.Cooldown = Cooldown;
+        Ability.ManaCost = ManaCost;
+        Ability.Damage = Damage;
+        Ability.Duration = Duration;
+        return Ability;
+    }
+
+    FCharacterStats MakeStats(int32 MaxHealth, int32 Strength, int32 Defense, int32 Speed, int32 Mana, float CriticalChance)
+    {
+        FCharacterStats Stats;
+        Stats.MaxHealth = MaxHealth;
+        Stats.Strength = Strength;
+        Stats.Defense = Defense;
+        Stats.Speed = Speed;
+        Stats.Mana = Mana;
+        Stats.CriticalChance = CriticalChance;
+        return Stats;
+    }
+}
+
+const FCharacterClassRegistry& FCharacterClassRegistry::Get()
+{
+    return GetMutable();
+}
+
+FCharacterClassRegistry& FCharacterClassRegistry::GetMutable()
+{
+    static FCharacterClassRegistry Registry;
+    return Registry;
+}
+
+FCharacterClassRegistry::FCharacterClassRegistry()
+{
+    BuildDefaultDefinitions();
+    RebuildAvailableClasses();
+}
+
+const FCharacterClassData& FCharacterClassRegistry::GetDefinition(ECharacterClass CharacterClass) const
+{
+    const int32 Index = static_cast<int32>(CharacterClass);
+    return (Index >= 0 && Index < NumClasses) ? Definitions[Index] : Definitions[0];
+}
+
+bool FCharacterClassRegistry::IsRegistered(ECharacterClass CharacterClass) const
+{
+    return CharacterClass != ECharacterClass::None && GetDefinition(CharacterClass).CharacterClass == CharacterClass;
+}
+
+void FCharacterClassRegistry::LoadDefinitionAsset()
+{
+    BLOODREAD_SCOPE(STAT_BloodreadAssetLoad);
+    BloodreadBoot::FAssetLoadScope BootAssetLoad;
+    FCharacterClassRegistry& Registry = GetMutable();
+    if (Registry.bDefinitionAssetLoaded)
+    {
+        return;
+    }
+    Registry.bDefinitionAssetLoaded = true;
+
+    FString AssetPath;
+    if (!GConfig || !GConfig->GetString(TEXT("/Script/BloodreadGame.CharacterClassRegistry"), TEXT("DefinitionAsset"), AssetPath, GGameIni) || AssetPath.IsEmpty())
+    {
+        UE_LOG(LogTemp, Log, TEXT("CharacterClassRegistry: No definition asset configured, using built-in class data"));
+        return;
+    }
+
+    const UCharacterClassDefinitionAsset* Asset = Cast<UCharacterClassDefinitionAsset>(FSoftObjectPath(AssetPath).TryLoad());
+    if (!Asset)
+    {
+        UE_LOG(LogTemp, Error, TEXT("CharacterClassRegistry: Failed to load definition asset %s"), *AssetPath);
+        return;
+    }
+
+    // Overwrite in place so references handed out earlier stay valid
+    for (const FCharacterClassData& Definition : Asset->ClassDefinitions)
+    {
+        const int32 Index = static_cast<int32>(Definition.CharacterClass);
+        if (Definition.CharacterClass == ECharacterClass::None || Index >= NumClasses)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("CharacterClassRegistry: Skipping definition '%s' with invalid class %d"), *Definition.ClassName, Index);
+            continue;
+        }
+        Registry.Definitions[Index] = Definition;
+    }
+
+    Registry.RebuildAvailableClasses();
+    UE_LOG(LogTemp, Log, TEXT("CharacterClassRegistry: Applied %d class definitions from %s"), Asset->ClassDefinitions.Num(), *AssetPath);
+}
+
+void FCharacterClassRegistry::RebuildAvailableClasses()
+{
+    AvailableClasses.Reset();
+    for (int32 Index = 1; Index < NumClasses; ++Index)
+    {
+        if (Definitions[Index].CharacterClass != ECharacterClass::None)
+        {
+            AvailableClasses.Add(static_cast<ECharacterClass>(Index));
+        }
+    }
+}
+
+void FCharacterClassRegistry::BuildDefaultDefinitions()
+{
+    // Warrior (Gideon)
+    {
+        FCharacterClassData& Data = Definitions[static_cast<int32>(ECharacterClass::Warrior)];
+        Data.CharacterClass = ECharacterClass::Warrior;
+        Data.ClassName = TEXT("Warrior");
+        Data.Description = TEXT("A mighty melee fighter with high health and devastating close-combat abilities");
+        Data.BaseStats = MakeStats(120, 18, 12, 8, 100, 0.15f);
+        Data.Ability1 = MakeAbility(TEXT("Hex Punch"), TEXT("Pull enemies to your location in a smooth motion and deal damage"),
+                                    EAbilityType::Damage, 15.0f, 100, 10.0f, 0.5f);
+        Data.Ability2 = MakeAbility(TEXT("Power Shield"), TEXT("Gain a shield that adds temporary health and regeneration"),
+                                    EAbilityType::Defense, 15.0f, 30, 0.0f, 10.0f);
+        Data.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Meshes/Gideon.Gideon")));
+        Data.AnimationBlueprintPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Gideon_AnimBlueprint.Gideon_AnimBlueprint_C");
+        Data.BasicAttackAnimationPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Primary_Attack_A_Medium.Primary_Attack_A_Medium");
+        Data.Ability1AnimationPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Burden_Start.Burden_Start");
+        Data.Ability2AnimationPath = TEXT("/Game/ParagonGideon/Characters/Heroes/Gideon/Animations/Cosmic_Rift.Cosmic_Rift");
+        Data.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
+    }
+
+    // Mage (Aurora)
+    {
+        FCharacterClassData& Data = Definitions[static_cast<int32>(ECharacterClass::Mage)];
+        Data.CharacterClass = ECharacterClass::Mage;
+        Data.ClassName = TEXT("Mage");
+        Data.Description = TEXT("A powerful spellcaster with aura creation and explosive abilities");
+        Data.BaseStats = MakeStats(100, 6, 4, 12, 150, 0.2f);
+        Data.Ability1 = MakeAbility(TEXT("Fiery Aura"), TEXT("Spawn a spherical aura that deals damage and grants mana"),
+                                    EAbilityType::Damage, 2.0f, 100, 1.0f, 0.0f);
+        Data.Ability2 = MakeAbility(TEXT("Explosion"), TEXT("Deal knockback and damage in omnidirectional radius"),
+                                    EAbilityType::Damage, 30.0f, 50, 10.0f, 0.0f);
+        Data.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Meshes/Aurora.Aurora")));
+        Data.AnimationBlueprintPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Aurora_AnimBlueprint.Aurora_AnimBlueprint_C");
+        Data.BasicAttackAnimationPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Primary_Attack_Slow_A.Primary_Attack_Slow_A");
+        Data.Ability1AnimationPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Ability_Q.Ability_Q");
+        Data.Ability2AnimationPath = TEXT("/Game/ParagonAurora/Characters/Heroes/Aurora/Animations/Ability_E.Ability_E");
+        Data.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
+    }
+
+    // Rogue (Shinbi Dynasty)
+    {
+        FCharacterClassData& Data = Definitions[static_cast<int32>(ECharacterClass::Rogue)];
+        Data.CharacterClass = ECharacterClass::Rogue;
+        Data.ClassName = TEXT("Rogue");
+        Data.Description = TEXT("A swift assassin specializing in teleportation and tactical positioning");
+        Data.BaseStats = MakeStats(100, 12, 6, 16, 120, 0.3f);
+        Data.Ability1 = MakeAbility(TEXT("Teleport"), TEXT("Teleport behind target with same orientation and gain movement speed"),
+                                    EAbilityType::Movement, 8.0f, 100, 0.0f, 5.0f);
+        Data.Ability2 = MakeAbility(TEXT("Shadow Push"), TEXT("Push opponent back and gain a protective shield"),
+                                    EAbilityType::Damage, 8.0f, 25, 0.0f, 5.0f);
+        Data.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Skins/Tier_1/Shinbi_Dynasty/Meshes/ShinbiDynasty.ShinbiDynasty")));
+        Data.AnimationBlueprintPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Shinbi_AnimBlueprint.Shinbi_AnimBlueprint_C");
+        Data.BasicAttackAnimationPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Animations/PrimaryMelee_B_Slow.PrimaryMelee_B_Slow");
+        Data.Ability1AnimationPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Animations/Ability_Dash.Ability_Dash");
+        Data.Ability2AnimationPath = TEXT("/Game/ParagonShinbi/Characters/Heroes/Shinbi/Animations/Ability_CirclingWolves.Ability_CirclingWolves");
+        Data.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
+    }
+
+    // Healer (Fey)
+    {
+        FCharacterClassData& Data = Definitions[static_cast<int32>(ECharacterClass::Healer)];
+        Data.CharacterClass = ECharacterClass::Healer;
+        Data.ClassName = TEXT("Healer");
+        Data.Description = TEXT("A support character specializing in healing and team regeneration");
+        Data.BaseStats = MakeStats(120, 6, 8, 10, 150, 0.1f);
+        Data.Ability1 = MakeAbility(TEXT("Bond"), TEXT("Heal teammate for 50% of their missing health"),
+                                    EAbilityType::Heal, 30.0f, 100, 0.0f, 0.0f);
+        Data.Ability2 = MakeAbility(TEXT("Regeneration"), TEXT("Make all teammates regenerate health over time"),
+                                    EAbilityType::Heal, 15.0f, 50, 0.0f, 10.0f);
+        Data.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Meshes/Fey.Fey")));
+        Data.AnimationBlueprintPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Fey_AnimBlueprint.Fey_AnimBlueprint_C");
+        Data.BasicAttackAnimationPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Animations/Ability_LMB_A_Slow.Ability_LMB_A_Slow");
+        Data.Ability1AnimationPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Animations/Ability_Q.Ability_Q");
+        Data.Ability2AnimationPath = TEXT("/Game/ParagonFey/Characters/Heroes/Fey/Animations/Ability_E.Ability_E");
+        Data.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
+    }
+
+    // Dragon (Yin)
+    {
+        // Blitz damage and Greed duration come from the class tuning so the two can't drift apart
+        const ABloodreadDragonCharacter* DragonDefaults = GetDefault<ABloodreadDragonCharacter>();
+        FCharacterClassData& Data = Definitions[static_cast<int32>(ECharacterClass::Dragon)];
+        Data.CharacterClass = ECharacterClass::Dragon;
+        Data.ClassName = TEXT("Dragon");
+        Data.Description = TEXT("A powerful aerial combatant with leap attacks and greed-based power scaling");
+        Data.BaseStats = MakeStats(100, 12, 8, 12, 120, 0.15f);
+        Data.Ability1 = MakeAbility(TEXT("Ascent"), TEXT("Two-part leap and blitz ability for aerial combat"),
+                                    EAbilityType::Movement, 30.0f, 100, DragonDefaults->BlitzDamage, 0.0f);
+        Data.Ability2 = MakeAbility(TEXT("King's Greed"), TEXT("Gain movement speed, potential damage boost from consecutive hits"),
+                                    EAbilityType::Buff, 30.0f, 50, 0.0f, DragonDefaults->GreedDuration);
+        Data.CharacterMesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Meshes/Yin.Yin")));
+        Data.AnimationBlueprintPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Yin_AnimBlueprint.Yin_AnimBlueprint_C");
+        Data.BasicAttackAnimationPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Animations/Primary_Attack_A_Slow.Primary_Attack_A_Slow");
+        Data.Ability1AnimationPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Animations/Q_Pull_Kick.Q_Pull_Kick");
+        Data.Ability2AnimationPath = TEXT("/Game/ParagonYin/Characters/Heroes/Yin/Animations/E_Ability_Attack_A.E_Ability_Attack_A");
+        Data.CameraOffset = FVector(25.0f, 0.0f, 85.0f);
+    }
+}
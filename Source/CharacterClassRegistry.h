@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "BloodreadBaseCharacter.h"
+#include "CharacterClassRegistry.generated.h"
+
+// Data asset that overrides the built-in class definitions (assigned in DefaultGame.ini)
+UCLASS(BlueprintType)
+class BLOODREADGAME_API UCharacterClassDefinitionAsset : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    // One entry per playable class; CharacterClass selects the registry slot it replaces
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character Classes")
+    TArray<FCharacterClassData> ClassDefinitions;
+};
+
+/**
+ * Immutable, process-wide table of character class definitions.
+ * Indexed directly by ECharacterClass so characters only need to store (and replicate) the class ID.
+ * Built once from code defaults, then optionally overridden by UCharacterClassDefinitionAsset at game instance init.
+ */
+class BLOODREADGAME_API FCharacterClassRegistry
+{
+public:
+    static constexpr int32 NumClasses = static_cast<int32>(ECharacterClass::Paladin) + 1;
+
+    static const FCharacterClassRegistry& Get();
+
+    // Load the configured definition asset (if any) over the built-in defaults - call once at startup
+    static void LoadDefinitionAsset();
+
+    // Always returns a valid reference; unknown or unregistered classes resolve to the None entry
+    const FCharacterClassData& GetDefinition(ECharacterClass CharacterClass) const;
+
+    bool IsRegistered(ECharacterClass CharacterClass) const;
+
+    // Playable classes in enum order
+    const TArray<ECharacterClass>& GetAvailableClasses() const { return AvailableClasses; }
+
+private:
+    FCharacterClassRegistry();
+
+    static FCharacterClassRegistry& GetMutable();
+
+    void BuildDefaultDefinitions();
+    void RebuildAvailableClasses();
+
+    FCharacterClassData Definitions[NumClasses];
+    TArray<ECharacterClass> AvailableClasses;
+    bool bDefinitionAssetLoaded = false;
+};
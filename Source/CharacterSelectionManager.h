@@ -14,17 +14,15 @@ class BLOODREADGAME_API UCharacterSelectionManager : public UObject
     GENERATED_BODY()
 
 public:
-    UCharacterSelectionManager();
-
     // Get all available character classes
     UFUNCTION(BlueprintCallable, Category = "Character Selection")
     TArray<FCharacterClassData> GetAvailableCharacterClasses() const;
 
-    // Get character class data by type
+    // Get character class data by type (Blueprint copy of the shared registry entry)
     UFUNCTION(BlueprintCallable, Category = "Character Selection")
     FCharacterClassData GetCharacterClassData(ECharacterClass CharacterClass) const;
 
-    // Get character class blueprint
+    // Get character class blueprint (the C++ class when no Blueprint override is set)
     UFUNCTION(BlueprintCallable, Category = "Character Selection") 
     TSubclassOf<ABloodreadBaseCharacter> GetCharacterClassBlueprint(ECharacterClass CharacterClass) const;
 
@@ -33,15 +31,10 @@ public:
     ABloodreadBaseCharacter* SpawnCharacterOfClass(UWorld* World, ECharacterClass CharacterClass, FVector Location, FRotator Rotation) const;
 
 protected:
-    // Available character classes data
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Classes")
-    TMap<ECharacterClass, FCharacterClassData> CharacterClassesData;
-
-    // Character class blueprints
+    // Blueprint overrides per class; classes without an entry spawn their C++ class
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Classes")
     TMap<ECharacterClass, TSubclassOf<ABloodreadBaseCharacter>> CharacterClassBlueprints;
 
 private:
-    void InitializeCharacterClasses();
-    void SetupDefaultCharacterData();
+    static TSubclassOf<ABloodreadBaseCharacter> GetNativeCharacterClass(ECharacterClass CharacterClass);
 };
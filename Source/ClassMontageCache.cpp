@@ -0,0 +1,104 @@
+#include "ClassMontageCache.h"
+#include "BloodreadStats.h"
+#include "BootProfiler.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequenceBase.h"
+#include "CharacterClassRegistry.h"
+
+namespace
+{
+    const FString& GetActionAnimationPath(const FCharacterClassData& ClassData, ECharacterAnimAction Action)
+    {
+        static const FString EmptyPath;
+        switch (Action)
+        {
+            case ECharacterAnimAction::BasicAttack: return ClassData.BasicAttackAnimationPath;
+            case ECharacterAnimAction::Ability1:    return ClassData.Ability1AnimationPath;
+            case ECharacterAnimAction::Ability2:    return ClassData.Ability2AnimationPath;
+            // No dedicated hit reaction assets yet - basic attack stands in, as before
+            case ECharacterAnimAction::HitReact:    return ClassData.BasicAttackAnimationPath;
+            default:                                return EmptyPath;
+        }
+    }
+}
+
+void UClassMontageCache::Deinitialize()
+{
+    ClassMontages.Reset();
+    MontagesByPath.Reset();
+    Super::Deinitialize();
+}
+
+UAnimMontage* UClassMontageCache::GetMontage(ECharacterClass CharacterClass, ECharacterAnimAction Action)
+{
+    const FClassMontageSet& Set = ResolveClass(CharacterClass);
+    const int32 ActionIndex = static_cast<int32>(Action);
+    return Set.Montages.IsValidIndex(ActionIndex) ? Set.Montages[ActionIndex].Get() : nullptr;
+}
+
+void UClassMontageCache::WarmClass(ECharacterClass CharacterClass)
+{
+    ResolveClass(CharacterClass);
+}
+
+const FClassMontageSet& UClassMontageCache::ResolveClass(ECharacterClass CharacterClass)
+{
+    BLOODREAD_SCOPE(STAT_BloodreadAssetLoad);
+    BloodreadBoot::FAssetLoadScope BootAssetLoad;
+    const int32 ClassIndex = FMath::Clamp(static_cast<int32>(CharacterClass), 0, FCharacterClassRegistry::NumClasses - 1);
+    if (ClassMontages.Num() < FCharacterClassRegistry::NumClasses)
+    {
+        ClassMontages.SetNum(FCharacterClassRegistry::NumClasses);
+    }
+
+    FClassMontageSet& Set = ClassMontages[ClassIndex];
+    if (Set.bResolved)
+    {
+        return Set;
+    }
+    Set.bResolved = true;
+
+    const FCharacterClassData& ClassData = FCharacterClassRegistry::Get().GetDefinition(CharacterClass);
+    Set.Montages.SetNum(static_cast<int32>(ECharacterAnimAction::HitReact) + 1);
+    for (int32 ActionIndex = 1; ActionIndex < Set.Montages.Num(); ++ActionIndex)
+    {
+        const FString& Path = GetActionAnimationPath(ClassData, static_cast<ECharacterAnimAction>(ActionIndex));
+        Set.Montages[ActionIndex] = Path.IsEmpty() ? nullptr : GetMontageForPath(Path, ClassData.AnimationSlotName);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("ClassMontageCache: Resolved montages for %s"), *ClassData.ClassName);
+    return Set;
+}
+
+UAnimMontage* UClassMontageCache::GetMontageForPath(const FString& AnimationPath, FName SlotName)
+{
+    if (AnimationPath.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    const FName Key(*FString::Printf(TEXT("%s|%s"), *AnimationPath, *SlotName.ToString()));
+    if (TObjectPtr<UAnimMontage>* Cached = MontagesByPath.Find(Key))
+    {
+        return Cached->Get();
+    }
+
+    UAnimMontage* Montage = nullptr;
+    BloodreadTrace::AssetLoad(AnimationPath);
+    if (UAnimSequenceBase* Animation = LoadObject<UAnimSequenceBase>(nullptr, *AnimationPath))
+    {
+        Montage = Cast<UAnimMontage>(Animation);
+        if (!Montage)
+        {
+            Montage = UAnimMontage::CreateSlotAnimationAsDynamicMontage(Animation, SlotName, 0.1f, 0.2f);
+        }
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("ClassMontageCache: Failed to load animation from path: %s"), *AnimationPath);
+    }
+
+    // Cache misses too so a bad path only costs one load attempt
+    MontagesByPath.Add(Key, Montage);
+    return Montage;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BloodreadBaseCharacter.h"
+#include "ClassMontageCache.generated.h"
+
+class UAnimMontage;
+
+// Resolved montages for one class, indexed by ECharacterAnimAction
+USTRUCT()
+struct FClassMontageSet
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<UAnimMontage>> Montages;
+
+    bool bResolved = false;
+};
+
+/**
+ * Resolves each class's attack/ability animation paths into UAnimMontages once per game instance.
+ * Plain sequences are wrapped in a slot montage so they play through the class anim blueprint's slot
+ * instead of swapping the mesh into single-node mode.
+ */
+UCLASS()
+class BLOODREADGAME_API UClassMontageCache : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // Resolve (if needed) and return the montage for an action, nullptr when the class has no animation for it
+    UAnimMontage* GetMontage(ECharacterClass CharacterClass, ECharacterAnimAction Action);
+
+    // Resolve an arbitrary animation path into a montage for the given slot (cached by path)
+    UAnimMontage* GetMontageForPath(const FString& AnimationPath, FName SlotName);
+
+    // Load all montages for a class up front so the first attack doesn't hitch
+    void WarmClass(ECharacterClass CharacterClass);
+
+private:
+    const FClassMontageSet& ResolveClass(ECharacterClass CharacterClass);
+
+    UPROPERTY()
+    TArray<FClassMontageSet> ClassMontages;
+
+    UPROPERTY()
+    TMap<FName, TObjectPtr<UAnimMontage>> MontagesByPath;
+};
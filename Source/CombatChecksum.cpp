@@ -0,0 +1,433 @@
+#include "CombatChecksum.h"
+#include "BloodreadBaseCharacter.h"
+#include "BloodreadGamePlayerController.h"
+#include "CombatTickSubsystem.h"
+#include "PracticeDummy.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/PackageMapClient.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    const TCHAR* CombatChecksumSection = TEXT("/Script/BloodreadGame.CombatChecksum");
+
+    FIntVector QuantizeLocation(const FVector& Location, float QuantizeCm)
+    {
+        return FIntVector(FMath::RoundToInt(Location.X / QuantizeCm),
+                          FMath::RoundToInt(Location.Y / QuantizeCm),
+                          FMath::RoundToInt(Location.Z / QuantizeCm));
+    }
+
+    // Fields every client receives through replication
+    uint32 HashReplicatedState(const FCombatChecksumActorState& State, uint32 Hash)
+    {
+        Hash = FCrc::StrCrc32(*State.Key, Hash);
+        const int32 Values[2] = { State.Health, State.Mana };
+        return FCrc::MemCrc32(Values, sizeof(Values), Hash);
+    }
+
+    // Fields only the server and the owning client simulate
+    uint32 HashPredictedState(const FCombatChecksumActorState& State)
+    {
+        uint32 Hash = FCrc::StrCrc32(*State.Key);
+        Hash = FCrc::MemCrc32(&State.Location, sizeof(State.Location), Hash);
+        const int32 Values[2] = { State.SpeedBuffPermille, State.bKnockbackActive ? 1 : 0 };
+        return FCrc::MemCrc32(Values, sizeof(Values), Hash);
+    }
+}
+
+void UCombatChecksumSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetBool(CombatChecksumSection, TEXT("bEnabled"), bEnabled, GGameIni);
+        GConfig->GetInt(CombatChecksumSection, TEXT("SampleIntervalTicks"), SampleIntervalTicks, GGameIni);
+        GConfig->GetFloat(CombatChecksumSection, TEXT("LocationQuantizeCm"), LocationQuantizeCm, GGameIni);
+        GConfig->GetInt(CombatChecksumSection, TEXT("HistoryTicks"), HistoryTicks, GGameIni);
+        GConfig->GetInt(CombatChecksumSection, TEXT("TickTolerance"), TickTolerance, GGameIni);
+        GConfig->GetFloat(CombatChecksumSection, TEXT("DumpCooldownSeconds"), DumpCooldownSeconds, GGameIni);
+        GConfig->GetInt(CombatChecksumSection, TEXT("MaxPendingReportsPerClient"), MaxPendingReportsPerClient, GGameIni);
+    }
+
+    SampleIntervalTicks = FMath::Max(1, SampleIntervalTicks);
+    LocationQuantizeCm = FMath::Max(1.0f, LocationQuantizeCm);
+    History.SetNum(FMath::Max(1, HistoryTicks));
+
+    if (bEnabled)
+    {
+        UE_LOG(LogTemp, Log, TEXT("CombatChecksum: Enabled - report every %d ticks, %.0fcm location grid"), SampleIntervalTicks, LocationQuantizeCm);
+    }
+}
+
+bool UCombatChecksumSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Nothing to compare against in standalone
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && World->GetNetMode() != NM_Standalone;
+}
+
+void UCombatChecksumSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    if (UCombatTickSubsystem* CombatTick = InWorld.GetSubsystem<UCombatTickSubsystem>())
+    {
+        StepHz = 1.0f / CombatTick->GetStepSeconds();
+        CombatTick->OnFixedStep.AddUObject(this, &UCombatChecksumSubsystem::OnFixedStep);
+    }
+}
+
+UCombatChecksumSubsystem* UCombatChecksumSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UCombatChecksumSubsystem>() : nullptr;
+}
+
+uint32 UCombatChecksumSubsystem::GetCurrentTick() const
+{
+    // Server clock (replicated to clients) so both sides agree on tick numbers
+    const UWorld* World = GetWorld();
+    const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+    const double ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0);
+    return static_cast<uint32>(FMath::Max(0.0, ServerTime) * StepHz);
+}
+
+FString UCombatChecksumSubsystem::GetChecksumKey(const AActor* Actor) const
+{
+    const APawn* Pawn = Cast<APawn>(Actor);
+    const APlayerState* PlayerState = Pawn ? Pawn->GetPlayerState() : nullptr;
+    if (PlayerState)
+    {
+        return FString::Printf(TEXT("Player%d"), PlayerState->GetPlayerId());
+    }
+
+    // Object names differ between machines for anything spawned at runtime; the GUID is what replication uses.
+    // Empty until the actor has been replicated, in which case no client can have it yet either.
+    const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+    const FNetworkGUID NetGUID = NetDriver && NetDriver->GuidCache.IsValid() ? NetDriver->GuidCache->GetNetGUID(Actor) : FNetworkGUID();
+    return NetGUID.IsValid() ? FString::Printf(TEXT("Net%s"), *NetGUID.ToString()) : FString();
+}
+
+APawn* UCombatChecksumSubsystem::GetLocalPawn() const
+{
+    const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+    return PlayerController ? PlayerController->GetPawn() : nullptr;
+}
+
+void UCombatChecksumSubsystem::OnFixedStep(float StepSeconds, uint32 StepIndex)
+{
+    const uint32 Tick = GetCurrentTick();
+
+    // Several steps can run in one frame and share a server time; the last one wins
+    FCombatChecksumSnapshot* Slot = &History[HistoryHead];
+    if (Slot->Tick != Tick || Slot->Actors.Num() == 0)
+    {
+        HistoryHead = (HistoryHead + 1) % History.Num();
+        Slot = &History[HistoryHead];
+    }
+    CaptureSnapshot(Tick, *Slot);
+
+    const UWorld* World = GetWorld();
+    if (World->GetNetMode() != NM_Client)
+    {
+        // Reports wait until the server has recorded the ticks the reporter's own moves land in
+        for (int32 Index = 0; Index < PendingReports.Num(); ++Index)
+        {
+            if (PendingReports[Index].CheckAtTick <= Tick)
+            {
+                const FPendingReport Report = PendingReports[Index];
+                PendingReports.RemoveAtSwap(Index--);
+                CheckReport(Report);
+            }
+        }
+        return;
+    }
+
+    if (Tick / SampleIntervalTicks == LastReportedTick / SampleIntervalTicks)
+    {
+        return;
+    }
+    LastReportedTick = Tick;
+
+    if (ABloodreadGamePlayerController* PlayerController = Cast<ABloodreadGamePlayerController>(World->GetFirstPlayerController()))
+    {
+        PlayerController->ServerReportCombatChecksum(Tick, Slot->SharedHash, Slot->OwnHash);
+    }
+}
+
+void UCombatChecksumSubsystem::CaptureSnapshot(uint32 Tick, FCombatChecksumSnapshot& OutSnapshot) const
+{
+    OutSnapshot.Tick = Tick;
+    OutSnapshot.Actors.Reset();
+
+    UWorld* World = GetWorld();
+    for (TActorIterator<ABloodreadBaseCharacter> It(World); It; ++It)
+    {
+        ABloodreadBaseCharacter* Character = *It;
+        FString Key = GetChecksumKey(Character);
+        if (Key.IsEmpty())
+        {
+            continue;
+        }
+
+        FCombatChecksumActorState& State = OutSnapshot.Actors.AddDefaulted_GetRef();
+        const FCombatantStats Stats = Character->GetCombatantStats();
+        State.Key = MoveTemp(Key);
+        State.Actor = Character;
+        State.Location = QuantizeLocation(Character->GetActorLocation(), LocationQuantizeCm);
+        State.Health = Stats.Health;
+        State.MaxHealth = Stats.MaxHealth;
+        State.Mana = Stats.Mana;
+        if (const UBloodreadMovementComponent* Movement = Character->GetBloodreadMovement())
+        {
+            State.SpeedBuffPermille = FMath::RoundToInt(Movement->GetActiveSpeedBuffMultiplier() * 1000.0f);
+            State.bKnockbackActive = Movement->IsKnockbackActive();
+        }
+    }
+
+    for (TActorIterator<APracticeDummy> It(World); It; ++It)
+    {
+        APracticeDummy* Dummy = *It;
+        FCombatChecksumActorState& State = OutSnapshot.Actors.AddDefaulted_GetRef();
+        State.Key = GetChecksumKey(Dummy);
+        if (State.Key.IsEmpty())
+        {
+            State.Key = Dummy->GetName();
+        }
+        State.Actor = Dummy;
+        State.Location = QuantizeLocation(Dummy->GetActorLocation(), LocationQuantizeCm);
+        State.Health = Dummy->GetCurrentHealth();
+        State.MaxHealth = Dummy->GetMaxHealth();
+        State.bHashed = false;
+    }
+
+    // Iteration order differs between machines; hash in key order
+    OutSnapshot.Actors.Sort([](const FCombatChecksumActorState& A, const FCombatChecksumActorState& B) { return A.Key < B.Key; });
+
+    uint32 SharedHash = 0;
+    for (const FCombatChecksumActorState& State : OutSnapshot.Actors)
+    {
+        if (State.bHashed)
+        {
+            SharedHash = HashReplicatedState(State, SharedHash);
+        }
+    }
+    OutSnapshot.SharedHash = SharedHash;
+
+    OutSnapshot.OwnHash = 0;
+    if (World->GetNetMode() == NM_Client)
+    {
+        const APawn* OwnPawn = GetLocalPawn();
+        const FString OwnKey = OwnPawn ? GetChecksumKey(OwnPawn) : FString();
+        if (const FCombatChecksumActorState* OwnState = OwnKey.IsEmpty() ? nullptr : OutSnapshot.Actors.FindByPredicate([&OwnKey](const FCombatChecksumActorState& State) { return State.Key == OwnKey; }))
+        {
+            OutSnapshot.OwnHash = HashPredictedState(*OwnState);
+        }
+    }
+}
+
+const FCombatChecksumSnapshot* UCombatChecksumSubsystem::FindSnapshot(uint32 Tick) const
+{
+    const FCombatChecksumSnapshot* Best = nullptr;
+    int64 BestDistance = TickTolerance + 1;
+    for (const FCombatChecksumSnapshot& Snapshot : History)
+    {
+        const int64 Distance = FMath::Abs(static_cast<int64>(Snapshot.Tick) - static_cast<int64>(Tick));
+        if (Snapshot.Actors.Num() > 0 && Distance < BestDistance)
+        {
+            Best = &Snapshot;
+            BestDistance = Distance;
+        }
+    }
+    return Best;
+}
+
+void UCombatChecksumSubsystem::VerifyClientChecksum(APlayerController* Reporter, uint32 Tick, uint32 SharedHash, uint32 OwnHash)
+{
+    if (!bEnabled || !Reporter)
+    {
+        return;
+    }
+
+    const APlayerState* PlayerState = Reporter->GetPlayerState<APlayerState>();
+    const float PingSeconds = PlayerState ? PlayerState->GetPingInMilliseconds() / 1000.0f : 0.0f;
+
+    int32 QueuedFromReporter = 0;
+    for (const FPendingReport& Pending : PendingReports)
+    {
+        QueuedFromReporter += Pending.Reporter == Reporter ? 1 : 0;
+    }
+    if (QueuedFromReporter >= MaxPendingReportsPerClient)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("CombatChecksum: Dropped report from %s, %d already pending"), *Reporter->GetName(), QueuedFromReporter);
+        return;
+    }
+
+    FPendingReport Report;
+    Report.Reporter = Reporter;
+    Report.Tick = Tick;
+    Report.SharedHash = SharedHash;
+    Report.OwnHash = OwnHash;
+    // Past the history nothing could be matched anyway
+    Report.PingTicks = static_cast<uint32>(FMath::Clamp(FMath::CeilToInt(PingSeconds * StepHz), 0, History.Num()));
+    Report.CheckAtTick = Tick + Report.PingTicks + TickTolerance;
+
+    // Stale or far-future reports would never find their window in the history
+    const uint32 Now = GetCurrentTick();
+    if (Report.CheckAtTick + History.Num() < Now || Tick > Now + History.Num())
+    {
+        return;
+    }
+    PendingReports.Add(Report);
+}
+
+bool UCombatChecksumSubsystem::IsPlausibleReportTick(const UObject* WorldContextObject, uint32 Tick)
+{
+    const UCombatChecksumSubsystem* Checksums = Get(WorldContextObject);
+    if (!Checksums || !Checksums->bEnabled)
+    {
+        return true;
+    }
+    return static_cast<uint64>(Tick) <= static_cast<uint64>(Checksums->GetCurrentTick()) + Checksums->History.Num();
+}
+
+void UCombatChecksumSubsystem::CheckReport(const FPendingReport& Report)
+{
+    APlayerController* Reporter = Report.Reporter.Get();
+    if (!Reporter)
+    {
+        return;
+    }
+
+    UNetConnection* Connection = Reporter->GetNetConnection();
+    const APawn* OwnPawn = Reporter->GetPawn();
+    const FString OwnKey = OwnPawn ? GetChecksumKey(OwnPawn) : FString();
+
+    const int64 Tick = Report.Tick;
+    const int64 Tolerance = TickTolerance;
+    const int64 PingTicks = Report.PingTicks;
+
+    // Replicated values reach the client up to a ping late, so the client's tick T shows server state from
+    // [T - ping, T]; only actors that have a channel to this client count
+    bool bSharedChecked = false;
+    bool bSharedMatched = false;
+    for (const FCombatChecksumSnapshot& Snapshot : History)
+    {
+        const int64 Offset = static_cast<int64>(Snapshot.Tick) - Tick;
+        if (Snapshot.Actors.Num() == 0 || Offset < -PingTicks - Tolerance || Offset > Tolerance)
+        {
+            continue;
+        }
+
+        uint32 Hash = 0;
+        for (const FCombatChecksumActorState& State : Snapshot.Actors)
+        {
+            AActor* Actor = State.Actor.Get();
+            const bool bRelevant = Actor && (!Connection || State.Key == OwnKey || Connection->FindActorChannelRef(State.Actor));
+            if (State.bHashed && bRelevant)
+            {
+                Hash = HashReplicatedState(State, Hash);
+            }
+        }
+
+        bSharedChecked = true;
+        if (Hash == Report.SharedHash)
+        {
+            bSharedMatched = true;
+            break;
+        }
+    }
+
+    // The client's own moves run on the server up to a ping after it predicted them: [T, T + ping]
+    bool bOwnChecked = false;
+    bool bOwnMatched = Report.OwnHash == 0 || OwnKey.IsEmpty();
+    for (const FCombatChecksumSnapshot& Snapshot : History)
+    {
+        const int64 Offset = static_cast<int64>(Snapshot.Tick) - Tick;
+        if (bOwnMatched || Snapshot.Actors.Num() == 0 || Offset < -Tolerance || Offset > PingTicks + Tolerance)
+        {
+            continue;
+        }
+
+        if (const FCombatChecksumActorState* OwnState = Snapshot.Actors.FindByPredicate([&OwnKey](const FCombatChecksumActorState& State) { return State.Key == OwnKey; }))
+        {
+            bOwnChecked = true;
+            bOwnMatched = HashPredictedState(*OwnState) == Report.OwnHash;
+        }
+    }
+
+    if (!bSharedChecked)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("CombatChecksum: No server snapshot near tick %u"), Report.Tick);
+        return;
+    }
+
+    if (!bSharedMatched)
+    {
+        ReportDesync(Reporter, Report.Tick, TEXT("replicated state"));
+    }
+    else if (bOwnChecked && !bOwnMatched)
+    {
+        ReportDesync(Reporter, Report.Tick, TEXT("own pawn"));
+    }
+}
+
+void UCombatChecksumSubsystem::ReportDesync(APlayerController* Reporter, uint32 Tick, const TCHAR* What)
+{
+    const double Now = GetWorld()->GetRealTimeSeconds();
+    if (Now - LastDumpTime < DumpCooldownSeconds)
+    {
+        return;
+    }
+    LastDumpTime = Now;
+
+    UE_LOG(LogTemp, Warning, TEXT("CombatChecksum: Desync (%s) at tick %u with %s"), What, Tick, *Reporter->GetName());
+
+    DumpTick(Tick, TEXT("Server"));
+    if (ABloodreadGamePlayerController* PlayerController = Cast<ABloodreadGamePlayerController>(Reporter))
+    {
+        PlayerController->ClientDumpCombatState(Tick);
+    }
+}
+
+void UCombatChecksumSubsystem::DumpTick(uint32 Tick, const FString& Side) const
+{
+    const FCombatChecksumSnapshot* Snapshot = FindSnapshot(Tick);
+    if (!Snapshot)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CombatChecksum: Nothing recorded near tick %u to dump"), Tick);
+        return;
+    }
+
+    // One line per actor so the server and client files diff cleanly
+    // Remote positions and unhashed actors are included for context; they are expected to differ
+    FString Dump = FString::Printf(TEXT("tick %u shared %08x own %08x\n"), Snapshot->Tick, Snapshot->SharedHash, Snapshot->OwnHash);
+    for (const FCombatChecksumActorState& State : Snapshot->Actors)
+    {
+        Dump += FString::Printf(TEXT("%s%s loc=(%d,%d,%d) health=%d/%d mana=%d speed=%d knockback=%d\n"),
+                                *State.Key, State.bHashed ? TEXT("") : TEXT(" (not hashed)"), State.Location.X, State.Location.Y, State.Location.Z,
+                                State.Health, State.MaxHealth, State.Mana, State.SpeedBuffPermille, State.bKnockbackActive ? 1 : 0);
+    }
+
+    const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Desync"), FString::Printf(TEXT("Tick%u_%s.txt"), Tick, *Side));
+    FFileHelper::SaveStringToFile(Dump, *FilePath);
+    UE_LOG(LogTemp, Warning, TEXT("CombatChecksum: Wrote %s"), *FilePath);
+}
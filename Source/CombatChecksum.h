@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatChecksum.generated.h"
+
+class AActor;
+class APlayerController;
+
+// Quantized combat state of one actor at a checksum tick
+struct FCombatChecksumActorState
+{
+    // Stable cross-machine identity: player ID for player pawns, network GUID otherwise
+    FString Key;
+
+    // Server: used to check the actor is relevant to the reporting client
+    TWeakObjectPtr<AActor> Actor;
+
+    // Replicated to every client (hashed for all characters)
+    int32 Health = 0;
+    int32 Mana = 0;
+
+    // Only agrees on the server and the owning client (hashed for the reporter's own pawn)
+    FIntVector Location = FIntVector::ZeroValue;
+    int32 SpeedBuffPermille = 1000;
+    bool bKnockbackActive = false;
+
+    // Dump only: MaxHealth isn't replicated (shields) and dummy health isn't replicated at all
+    int32 MaxHealth = 0;
+    bool bHashed = true;
+};
+
+struct FCombatChecksumSnapshot
+{
+    uint32 Tick = 0;
+
+    // Replicated state of every hashed actor this machine knows about
+    uint32 SharedHash = 0;
+
+    // Client: predicted state of its own pawn (0 without a pawn)
+    uint32 OwnHash = 0;
+
+    TArray<FCombatChecksumActorState> Actors;
+};
+
+/**
+ * Optional desync detector.
+ * Every combat step the server and each client record the quantized combat state under a tick number derived
+ * from the replicated server clock. Clients report two hashes every SampleIntervalTicks ticks: one over the
+ * replicated fields of every character they know about (health, mana), and one over their own pawn's predicted
+ * state (position, knockback, speed buff). Remote positions, unreplicated stats and actors the client can't see
+ * are never compared. The server checks the shared hash against its snapshots up to the reporter's ping earlier
+ * (replicated values arrive late), restricted to actors relevant to that connection, and the own-pawn hash up to
+ * the ping later (the server runs the client's moves late). On a mismatch both sides write their state for the
+ * tick to Saved/Desync/ so the two files can be diffed.
+ * Disabled unless bEnabled is set in [/Script/BloodreadGame.CombatChecksum] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UCombatChecksumSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    static UCombatChecksumSubsystem* Get(const UObject* WorldContextObject);
+
+    bool IsEnabled() const { return bEnabled; }
+
+    // Server: queue a client's reported hashes; they are checked once the server has run far enough past the tick
+    void VerifyClientChecksum(APlayerController* Reporter, uint32 Tick, uint32 SharedHash, uint32 OwnHash);
+
+    // Server: false for ticks no honest clock could report (beyond the history ahead of the server); used by _Validate
+    static bool IsPlausibleReportTick(const UObject* WorldContextObject, uint32 Tick);
+
+    // Write the recorded state for a tick (nearest within tolerance) to Saved/Desync/
+    void DumpTick(uint32 Tick, const FString& Side) const;
+
+private:
+    struct FPendingReport
+    {
+        TWeakObjectPtr<APlayerController> Reporter;
+        uint32 Tick = 0;
+        uint32 SharedHash = 0;
+        uint32 OwnHash = 0;
+        uint32 PingTicks = 0;
+        uint32 CheckAtTick = 0;
+    };
+
+    void OnFixedStep(float StepSeconds, uint32 StepIndex);
+    void CaptureSnapshot(uint32 Tick, FCombatChecksumSnapshot& OutSnapshot) const;
+    const FCombatChecksumSnapshot* FindSnapshot(uint32 Tick) const;
+    uint32 GetCurrentTick() const;
+    FString GetChecksumKey(const AActor* Actor) const;
+    APawn* GetLocalPawn() const;
+
+    void CheckReport(const FPendingReport& Report);
+    void ReportDesync(APlayerController* Reporter, uint32 Tick, const TCHAR* What);
+
+    // Master switch (off by default - this costs a state walk every step)
+    bool bEnabled = false;
+
+    // Clients report one hash every this many ticks
+    int32 SampleIntervalTicks = 6;
+
+    // Location quantization for hashing (cm)
+    float LocationQuantizeCm = 25.0f;
+
+    // Snapshots kept for lookup and dumping
+    int32 HistoryTicks = 180;
+
+    // A reported tick matches a stored one within this many ticks (clock estimates jitter)
+    int32 TickTolerance = 1;
+
+    // Minimum seconds between desync dumps
+    float DumpCooldownSeconds = 1.0f;
+
+    // Cap on one client's queued reports, so a flood can't grow server memory
+    int32 MaxPendingReportsPerClient = 16;
+
+    float StepHz = 60.0f;
+    uint32 LastReportedTick = 0;
+    double LastDumpTime = -1.0e9;
+
+    // Ring of recent snapshots
+    TArray<FCombatChecksumSnapshot> History;
+    int32 HistoryHead = 0;
+
+    // Server: client reports waiting for the own-pawn window to be recorded
+    TArray<FPendingReport> PendingReports;
+};
@@ -0,0 +1,127 @@
+#include "CombatRules.h"
+
+FVector FCombatRules::BasicAttackKnockbackDirection(const FVector& AttackerLocation, const FVector& TargetLocation)
+{
+    FVector Direction = (TargetLocation - AttackerLocation).GetSafeNormal();
+    Direction.Z = 0.2f; // Slight upward force
+    return Direction;
+}
+
+FKnockbackShape FCombatRules::ShapeKnockback(const FVector& Direction, float Force, const FKnockbackTuning& Tuning)
+{
+    FKnockbackShape Shape;
+
+    const FVector Horizontal = FVector(Direction.X, Direction.Y, 0.0f).GetSafeNormal();
+    const float DurationAlpha = Tuning.ForceForMaxDuration > 0.0f ? FMath::Clamp(Force / Tuning.ForceForMaxDuration, 0.0f, 1.0f) : 1.0f;
+
+    Shape.Duration = FMath::Lerp(Tuning.MinDuration, Tuning.MaxDuration, DurationAlpha);
+    // Linear decay covers half the distance of constant speed, so start at twice the old impulse speed
+    Shape.HorizontalVelocity = Horizontal * Force * Tuning.HorizontalMultiplier * 2.0f;
+    Shape.VerticalVelocity = Force * Tuning.VerticalRatio;
+    Shape.EquivalentImpulse = Horizontal * Force * Tuning.HorizontalMultiplier + FVector(0.0f, 0.0f, Shape.VerticalVelocity);
+    return Shape;
+}
+
+int32 FCombatRules::ApplyDamage(FCombatantStats& Target, int32 Damage)
+{
+    if (Damage <= 0 || Target.Health <= 0)
+    {
+        return 0;
+    }
+
+    const int32 PreviousHealth = Target.Health;
+    Target.Health = FMath::Max(0, Target.Health - Damage);
+    return PreviousHealth - Target.Health;
+}
+
+int32 FCombatRules::ApplyNonLethalDamage(FCombatantStats& Target, int32 Damage)
+{
+    if (Damage <= 0 || Target.Health <= 1)
+    {
+        return 0;
+    }
+
+    const int32 PreviousHealth = Target.Health;
+    Target.Health = FMath::Max(1, Target.Health - Damage);
+    return PreviousHealth - Target.Health;
+}
+
+int32 FCombatRules::ApplyHeal(FCombatantStats& Target, int32 Amount)
+{
+    if (Amount <= 0 || Target.Health >= Target.MaxHealth)
+    {
+        return 0;
+    }
+
+    const int32 PreviousHealth = Target.Health;
+    Target.Health = FMath::Min(Target.Health + Amount, Target.MaxHealth);
+    return Target.Health - PreviousHealth;
+}
+
+int32 FCombatRules::RestoreMana(FCombatantStats& Target, int32 Amount, int32 ManaCap)
+{
+    if (Amount <= 0 || Target.Mana >= ManaCap)
+    {
+        return 0;
+    }
+
+    const int32 PreviousMana = Target.Mana;
+    Target.Mana = FMath::Min(Target.Mana + Amount, ManaCap);
+    return Target.Mana - PreviousMana;
+}
+
+int32 FCombatRules::BondHealAmount(int32 Health, int32 MaxHealth, float MissingHealthFraction)
+{
+    const int32 MissingHealth = FMath::Max(0, MaxHealth - Health);
+    return FMath::RoundToInt(MissingHealth * MissingHealthFraction);
+}
+
+void FCombatRules::AddShield(FCombatantStats& Target, int32 ShieldHealth)
+{
+    Target.MaxHealth += ShieldHealth;
+    Target.Health += ShieldHealth;
+}
+
+void FCombatRules::RemoveShield(FCombatantStats& Target, int32 ShieldHealth)
+{
+    Target.MaxHealth -= ShieldHealth;
+    Target.Health = FMath::Min(Target.Health, Target.MaxHealth);
+}
+
+FVector FCombatRules::ShadowPushVelocity(const FVector& AimDirection, float Knockback, float VerticalLift)
+{
+    // Push along the crosshair, kept horizontal (not omnidirectional)
+    FVector PushVelocity = FVector(AimDirection.X, AimDirection.Y, 0.0f).GetSafeNormal() * Knockback;
+    PushVelocity.Z += VerticalLift;
+    return PushVelocity;
+}
+
+int32 FCombatRules::ResolveHits(TArrayView<FCombatantStats> Combatants, TConstArrayView<FCombatHit> Hits, int32 ManaCap)
+{
+    int32 Kills = 0;
+    for (const FCombatHit& Hit : Hits)
+    {
+        if (!Combatants.IsValidIndex(Hit.TargetIndex))
+        {
+            continue;
+        }
+
+        FCombatantStats& Target = Combatants[Hit.TargetIndex];
+        if (Target.Health <= 0)
+        {
+            continue;
+        }
+
+        ApplyDamage(Target, Hit.Damage);
+        if (Target.Health == 0)
+        {
+            ++Kills;
+        }
+
+        if (Combatants.IsValidIndex(Hit.AttackerIndex))
+        {
+            RestoreMana(Combatants[Hit.AttackerIndex], Hit.AttackerManaGain, ManaCap);
+        }
+    }
+    return Kills;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Plain combat state for one fighter; actors copy in and out of this around rule calls
+struct FCombatantStats
+{
+    int32 Health = 0;
+    int32 MaxHealth = 0;
+    int32 Mana = 0;
+    int32 MaxMana = 0;
+    int32 Strength = 0;
+};
+
+// One hit between two entries of a combatant array
+struct FCombatHit
+{
+    int32 AttackerIndex = INDEX_NONE;
+    int32 TargetIndex = INDEX_NONE;
+    int32 Damage = 0;
+    int32 AttackerManaGain = 0;
+};
+
+// Tuning for knockback shaping (mirrors the movement component's knockback properties)
+struct FKnockbackTuning
+{
+    float HorizontalMultiplier = 1.0f;
+    float VerticalRatio = 0.6f;
+    float ForceForMaxDuration = 1000.0f;
+    float MinDuration = 0.25f;
+    float MaxDuration = 0.6f;
+};
+
+// Result of shaping a knockback: the curve start values plus the impulse the old launch would have applied
+struct FKnockbackShape
+{
+    FVector HorizontalVelocity = FVector::ZeroVector;
+    float VerticalVelocity = 0.0f;
+    float Duration = 0.0f;
+    FVector EquivalentImpulse = FVector::ZeroVector;
+};
+
+/**
+ * Combat rules with no engine object dependencies.
+ * Damage, healing, shields and knockback shaping live here so the character classes only gather inputs
+ * (targets, traces, stats) and apply the results, and the rules themselves can be run in bulk outside a world
+ * (balancing sims, profiling) over plain FCombatantStats arrays.
+ */
+class BLOODREADGAME_API FCombatRules
+{
+public:
+    // Basic attack damage: weapon base plus the attacker's strength
+    static int32 BasicAttackDamage(int32 BaseDamage, int32 Strength) { return FMath::Max(0, BaseDamage + Strength); }
+
+    // Direction from attacker to target with the basic attack's slight upward lift
+    static FVector BasicAttackKnockbackDirection(const FVector& AttackerLocation, const FVector& TargetLocation);
+
+    // Shape a knockback hit into a decaying horizontal velocity, vertical launch and duration
+    static FKnockbackShape ShapeKnockback(const FVector& Direction, float Force, const FKnockbackTuning& Tuning);
+
+    // Subtract damage (clamped at zero health); returns the health actually removed
+    static int32 ApplyDamage(FCombatantStats& Target, int32 Damage);
+
+    // Self-inflicted damage that can't kill (Blitz recoil); returns the health actually removed
+    static int32 ApplyNonLethalDamage(FCombatantStats& Target, int32 Damage);
+
+    // Heal up to max health; returns the health actually restored
+    static int32 ApplyHeal(FCombatantStats& Target, int32 Amount);
+
+    // Restore mana up to the given cap; returns the mana actually restored
+    static int32 RestoreMana(FCombatantStats& Target, int32 Amount, int32 ManaCap);
+
+    // Heal amount for Bond: a fraction of the target's missing health
+    static int32 BondHealAmount(int32 Health, int32 MaxHealth, float MissingHealthFraction = 0.5f);
+
+    // Temporary shield: raise max and current health by the shield amount
+    static void AddShield(FCombatantStats& Target, int32 ShieldHealth);
+
+    // Shield expiry: drop max health back and clamp current health to it
+    static void RemoveShield(FCombatantStats& Target, int32 ShieldHealth);
+
+    // Shadow Push launch: horizontal push along the aim direction plus a small lift
+    static FVector ShadowPushVelocity(const FVector& AimDirection, float Knockback, float VerticalLift = 100.0f);
+
+    // Cooldown remaining after DeltaTime seconds (never below zero)
+    static float TickCooldown(float CooldownRemaining, float DeltaTime) { return FMath::Max(0.0f, CooldownRemaining - DeltaTime); }
+
+    // An ability can fire once its cooldown has run out and the caster can pay for it
+    static bool CanActivateAbility(float CooldownRemaining, int32 Mana, int32 ManaCost) { return CooldownRemaining <= 0.0f && Mana >= ManaCost; }
+
+    // Resolve a batch of hits in order; hits on already-dead targets are skipped. Returns the number of kills.
+    static int32 ResolveHits(TArrayView<FCombatantStats> Combatants, TConstArrayView<FCombatHit> Hits, int32 ManaCap);
+};
@@ -0,0 +1,187 @@
+#include "CombatRules.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr EAutomationTestFlags CombatRulesTestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+    FCombatantStats MakeCombatant(int32 Health, int32 MaxHealth, int32 Mana = 0, int32 MaxMana = 100)
+    {
+        FCombatantStats Stats;
+        Stats.Health = Health;
+        Stats.MaxHealth = MaxHealth;
+        Stats.Mana = Mana;
+        Stats.MaxMana = MaxMana;
+        return Stats;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatRulesDamageTest, "Bloodread.CombatRules.Damage", CombatRulesTestFlags)
+
+bool FCombatRulesDamageTest::RunTest(const FString& Parameters)
+{
+    TestEqual(TEXT("Basic attack adds strength"), FCombatRules::BasicAttackDamage(25, 10), 35);
+    TestEqual(TEXT("Basic attack never goes negative"), FCombatRules::BasicAttackDamage(5, -20), 0);
+
+    FCombatantStats Target = MakeCombatant(50, 100);
+    TestEqual(TEXT("Damage removed"), FCombatRules::ApplyDamage(Target, 20), 20);
+    TestEqual(TEXT("Health after damage"), Target.Health, 30);
+    TestEqual(TEXT("Overkill only removes remaining health"), FCombatRules::ApplyDamage(Target, 100), 30);
+    TestEqual(TEXT("Health clamps at zero"), Target.Health, 0);
+    TestEqual(TEXT("Dead targets take no damage"), FCombatRules::ApplyDamage(Target, 10), 0);
+
+    FCombatantStats Self = MakeCombatant(10, 100);
+    TestEqual(TEXT("Recoil stops at one health"), FCombatRules::ApplyNonLethalDamage(Self, 50), 9);
+    TestEqual(TEXT("Recoil leaves one health"), Self.Health, 1);
+    TestEqual(TEXT("Recoil at one health does nothing"), FCombatRules::ApplyNonLethalDamage(Self, 50), 0);
+
+    FCombatantStats Unharmed = MakeCombatant(40, 100);
+    TestEqual(TEXT("Negative damage is ignored"), FCombatRules::ApplyDamage(Unharmed, -5), 0);
+    TestEqual(TEXT("Health unchanged by negative damage"), Unharmed.Health, 40);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatRulesHealTest, "Bloodread.CombatRules.Heal", CombatRulesTestFlags)
+
+bool FCombatRulesHealTest::RunTest(const FString& Parameters)
+{
+    FCombatantStats Target = MakeCombatant(60, 100);
+    TestEqual(TEXT("Heal restored"), FCombatRules::ApplyHeal(Target, 25), 25);
+    TestEqual(TEXT("Heal clamps at max"), FCombatRules::ApplyHeal(Target, 50), 15);
+    TestEqual(TEXT("Health at max"), Target.Health, 100);
+    TestEqual(TEXT("Full health heals nothing"), FCombatRules::ApplyHeal(Target, 10), 0);
+
+    TestEqual(TEXT("Bond heals half the missing health"), FCombatRules::BondHealAmount(40, 100), 30);
+    TestEqual(TEXT("Bond on a full target heals nothing"), FCombatRules::BondHealAmount(100, 100), 0);
+    TestEqual(TEXT("Bond ignores overhealth"), FCombatRules::BondHealAmount(120, 100), 0);
+
+    FCombatantStats Shielded = MakeCombatant(80, 100);
+    FCombatRules::AddShield(Shielded, 50);
+    TestEqual(TEXT("Shield raises max health"), Shielded.MaxHealth, 150);
+    TestEqual(TEXT("Shield raises health"), Shielded.Health, 130);
+    FCombatRules::ApplyDamage(Shielded, 20);
+    FCombatRules::RemoveShield(Shielded, 50);
+    TestEqual(TEXT("Shield expiry restores max health"), Shielded.MaxHealth, 100);
+    TestEqual(TEXT("Shield expiry clamps health"), Shielded.Health, 100);
+
+    FCombatantStats Caster = MakeCombatant(100, 100, 90);
+    TestEqual(TEXT("Mana restore clamps at cap"), FCombatRules::RestoreMana(Caster, 20, 100), 10);
+    TestEqual(TEXT("Mana at cap"), Caster.Mana, 100);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatRulesKnockbackTest, "Bloodread.CombatRules.KnockbackShape", CombatRulesTestFlags)
+
+bool FCombatRulesKnockbackTest::RunTest(const FString& Parameters)
+{
+    FKnockbackTuning Tuning;
+    Tuning.HorizontalMultiplier = 1.5f;
+    Tuning.VerticalRatio = 0.6f;
+    Tuning.ForceForMaxDuration = 1000.0f;
+    Tuning.MinDuration = 0.25f;
+    Tuning.MaxDuration = 0.6f;
+
+    const FKnockbackShape Shape = FCombatRules::ShapeKnockback(FVector(3.0f, 4.0f, 10.0f), 500.0f, Tuning);
+    TestTrue(TEXT("Horizontal velocity ignores the input's Z"), FMath::IsNearlyZero(Shape.HorizontalVelocity.Z));
+    TestTrue(TEXT("Horizontal velocity follows the direction"), Shape.HorizontalVelocity.GetSafeNormal().Equals(FVector(0.6f, 0.8f, 0.0f), KINDA_SMALL_NUMBER));
+    TestTrue(TEXT("Linear decay starts at twice the impulse speed"), FMath::IsNearlyEqual(Shape.HorizontalVelocity.Size(), 500.0f * 1.5f * 2.0f, 0.01f));
+    TestTrue(TEXT("Vertical velocity is force times ratio"), FMath::IsNearlyEqual(Shape.VerticalVelocity, 300.0f));
+    TestTrue(TEXT("Duration scales with force"), FMath::IsNearlyEqual(Shape.Duration, 0.425f));
+    TestTrue(TEXT("Impulse matches the old launch"), Shape.EquivalentImpulse.Equals(FVector(450.0f, 600.0f, 300.0f), 0.01f));
+
+    const FKnockbackShape Heavy = FCombatRules::ShapeKnockback(FVector::ForwardVector, 5000.0f, Tuning);
+    TestTrue(TEXT("Duration caps at max"), FMath::IsNearlyEqual(Heavy.Duration, Tuning.MaxDuration));
+
+    const FKnockbackShape Straight = FCombatRules::ShapeKnockback(FVector::UpVector, 500.0f, Tuning);
+    TestTrue(TEXT("Vertical-only direction has no horizontal push"), Straight.HorizontalVelocity.IsNearlyZero());
+
+    const FVector Push = FCombatRules::ShadowPushVelocity(FVector(0.0f, 1.0f, 1.0f), 800.0f);
+    TestTrue(TEXT("Shadow Push stays horizontal plus lift"), Push.Equals(FVector(0.0f, 800.0f, 100.0f), 0.01f));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatRulesCooldownTest, "Bloodread.CombatRules.Cooldown", CombatRulesTestFlags)
+
+bool FCombatRulesCooldownTest::RunTest(const FString& Parameters)
+{
+    TestTrue(TEXT("Cooldown counts down"), FMath::IsNearlyEqual(FCombatRules::TickCooldown(2.0f, 0.5f), 1.5f));
+    TestEqual(TEXT("Cooldown stops at zero"), FCombatRules::TickCooldown(0.1f, 0.5f), 0.0f);
+    TestEqual(TEXT("Finished cooldown stays at zero"), FCombatRules::TickCooldown(0.0f, 0.5f), 0.0f);
+
+    TestTrue(TEXT("Ready with enough mana"), FCombatRules::CanActivateAbility(0.0f, 50, 30));
+    TestFalse(TEXT("Blocked while cooling down"), FCombatRules::CanActivateAbility(0.2f, 50, 30));
+    TestFalse(TEXT("Blocked without mana"), FCombatRules::CanActivateAbility(0.0f, 20, 30));
+    TestTrue(TEXT("Exact mana is enough"), FCombatRules::CanActivateAbility(0.0f, 30, 30));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatRulesResolveHitsTest, "Bloodread.CombatRules.ResolveHits", CombatRulesTestFlags)
+
+bool FCombatRulesResolveHitsTest::RunTest(const FString& Parameters)
+{
+    FCombatantStats Combatants[] = { MakeCombatant(100, 100, 0), MakeCombatant(30, 100, 0), MakeCombatant(50, 100, 95) };
+    const FCombatHit Hits[] = {
+        { 0, 1, 20, 10 },
+        { 0, 1, 20, 10 },           // kills target 1
+        { 2, 1, 50, 10 },           // target already dead: skipped, no mana
+        { 2, 0, 10, 10 },           // mana capped at 100
+        { 0, INDEX_NONE, 99, 10 }   // invalid target ignored
+    };
+
+    const int32 Kills = FCombatRules::ResolveHits(Combatants, Hits, 100);
+    TestEqual(TEXT("One kill"), Kills, 1);
+    TestEqual(TEXT("Target 1 dead"), Combatants[1].Health, 0);
+    TestEqual(TEXT("Attacker 0 gained mana from two hits"), Combatants[0].Mana, 20);
+    TestEqual(TEXT("Attacker 0 took damage"), Combatants[0].Health, 90);
+    TestEqual(TEXT("Attacker 2 mana capped"), Combatants[2].Mana, 100);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatRulesResolveHitsBenchmark, "Bloodread.CombatRules.ResolveHitsBenchmark",
+                                 EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCombatRulesResolveHitsBenchmark::RunTest(const FString& Parameters)
+{
+    // Many short simulated fights between small squads, the shape of a balancing run
+    constexpr int32 NumFights = 2000;
+    constexpr int32 CombatantsPerFight = 10;
+    constexpr int32 HitsPerFight = 200;
+
+    FRandomStream Random(0xB100D);
+    TArray<FCombatHit> Hits;
+    Hits.SetNumUninitialized(HitsPerFight);
+    TArray<FCombatantStats> Combatants;
+    Combatants.SetNumUninitialized(CombatantsPerFight);
+
+    int64 TotalKills = 0;
+    double ResolveSeconds = 0.0;
+    for (int32 Fight = 0; Fight < NumFights; ++Fight)
+    {
+        for (FCombatantStats& Combatant : Combatants)
+        {
+            Combatant = MakeCombatant(Random.RandRange(80, 200), 200, 0);
+        }
+        for (FCombatHit& Hit : Hits)
+        {
+            Hit.AttackerIndex = Random.RandRange(0, CombatantsPerFight - 1);
+            Hit.TargetIndex = Random.RandRange(0, CombatantsPerFight - 1);
+            Hit.Damage = Random.RandRange(5, 40);
+            Hit.AttackerManaGain = 10;
+        }
+
+        const double Start = FPlatformTime::Seconds();
+        TotalKills += FCombatRules::ResolveHits(Combatants, Hits, 100);
+        ResolveSeconds += FPlatformTime::Seconds() - Start;
+    }
+
+    const int64 TotalHits = static_cast<int64>(NumFights) * HitsPerFight;
+    AddInfo(FString::Printf(TEXT("ResolveHits: %lld hits in %.3f ms (%.1f ns/hit, %.0f fights/s), %lld kills"),
+        TotalHits, ResolveSeconds * 1000.0, ResolveSeconds * 1.0e9 / TotalHits,
+        ResolveSeconds > 0.0 ? NumFights / ResolveSeconds : 0.0, TotalKills));
+    TestTrue(TEXT("Fights produced kills"), TotalKills > 0);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,72 @@
+#include "CombatTickSubsystem.h"
+#include "Engine/World.h"
+
+namespace
+{
+    const TCHAR* CombatTickSection = TEXT("/Script/BloodreadGame.CombatTick");
+}
+
+void UCombatTickSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetFloat(CombatTickSection, TEXT("StepHz"), StepHz, GGameIni);
+        GConfig->GetInt(CombatTickSection, TEXT("MaxStepsPerFrame"), MaxStepsPerFrame, GGameIni);
+    }
+
+    StepHz = FMath::Clamp(StepHz, 10.0f, 240.0f);
+    MaxStepsPerFrame = FMath::Max(1, MaxStepsPerFrame);
+    StepSeconds = 1.0f / StepHz;
+
+    UE_LOG(LogTemp, Log, TEXT("CombatTick: %.0fHz fixed step, up to %d steps per frame"), StepHz, MaxStepsPerFrame);
+}
+
+bool UCombatTickSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Cooldowns and regen are predicted locally, so clients step combat state too
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld();
+}
+
+TStatId UCombatTickSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatTickSubsystem, STATGROUP_Tickables);
+}
+
+UCombatTickSubsystem* UCombatTickSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UCombatTickSubsystem>() : nullptr;
+}
+
+int32 UCombatTickSubsystem::SecondsToSteps(float Seconds) const
+{
+    return Seconds > 0.0f ? FMath::Max(1, FMath::RoundToInt(Seconds * StepHz)) : 0;
+}
+
+void UCombatTickSubsystem::Tick(float DeltaTime)
+{
+    Accumulator += DeltaTime;
+
+    int32 StepsThisFrame = 0;
+    while (Accumulator >= StepSeconds && StepsThisFrame < MaxStepsPerFrame)
+    {
+        Accumulator -= StepSeconds;
+        ++StepIndex;
+        ++StepsThisFrame;
+        OnFixedStep.Broadcast(StepSeconds, StepIndex);
+    }
+
+    if (Accumulator >= StepSeconds)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("CombatTick: Dropped %.3fs after a %.3fs frame"), Accumulator, DeltaTime);
+        Accumulator = FMath::Fmod(Accumulator, StepSeconds);
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatTickSubsystem.generated.h"
+
+// Fired once per fixed combat step with the step length and the step number since the world started
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnFixedCombatStep, float /*StepSeconds*/, uint32 /*StepIndex*/);
+
+/**
+ * Fixed-rate combat clock.
+ * Frame time is accumulated and consumed in constant StepHz steps, so cooldowns, regen, aura pulses and dummy
+ * knockback advance identically whether the server runs at its 30Hz net tick rate or a client renders at 144.
+ * Long frames run several steps (up to MaxStepsPerFrame, the rest is dropped rather than spiralling);
+ * short frames may run none, and GetInterpolationAlpha() tells visuals how far they are into the next step.
+ * Settings come from [/Script/BloodreadGame.CombatTick] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UCombatTickSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UCombatTickSubsystem* Get(const UObject* WorldContextObject);
+
+    // Bind combat state updates here; listeners run in registration order every step
+    FOnFixedCombatStep OnFixedStep;
+
+    float GetStepSeconds() const { return StepSeconds; }
+
+    // Steps run since the world started
+    uint32 GetStepIndex() const { return StepIndex; }
+
+    // Fraction of the next step already elapsed (0..1), for interpolating visuals between step results
+    float GetInterpolationAlpha() const { return StepSeconds > 0.0f ? Accumulator / StepSeconds : 0.0f; }
+
+    // Convert a duration in seconds to a whole number of steps (at least one for any positive duration)
+    int32 SecondsToSteps(float Seconds) const;
+
+private:
+    // Combat simulation rate (Hz)
+    float StepHz = 60.0f;
+
+    // Cap on catch-up steps per frame; time beyond this is discarded after a hitch
+    int32 MaxStepsPerFrame = 8;
+
+    float StepSeconds = 1.0f / 60.0f;
+    float Accumulator = 0.0f;
+    uint32 StepIndex = 0;
+};
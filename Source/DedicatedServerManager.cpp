@@ -1,4 +1,5 @@
 #include "DedicatedServerManager.h"
+#include "BloodreadMemory.h"
 #include "Engine/Engine.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/PlatformFilemanager.h"
@@ -18,6 +19,7 @@ UDedicatedServerManager::UDedicatedServerManager()
 
 bool UDedicatedServerManager::StartDedicatedServer(const FString& SessionName, const FString& MapName, int32 MaxPlayers, int32& OutPort, FString& OutServerID)
 {
+    LLM_SCOPE_BYTAG(Bloodread_ServerManager);
     if (RunningServers.Num() >= MaxConcurrentServers)
     {
         UE_LOG(LogTemp, Error, TEXT("Cannot start server: Maximum concurrent servers (%d) reached"), MaxConcurrentServers);
@@ -96,6 +98,7 @@ TArray<FRunningServer> UDedicatedServerManager::GetRunningServers()
 
 void UDedicatedServerManager::UpdateServerStatus()
 {
+    LLM_SCOPE_BYTAG(Bloodread_ServerManager);
     UE_LOG(LogTemp, Log, TEXT("Updating status for %d running servers"), RunningServers.Num());
 
     for (int32 i = RunningServers.Num() - 1; i >= 0; i--)
@@ -122,6 +125,7 @@ void UDedicatedServerManager::UpdateServerStatus()
 
 void UDedicatedServerManager::RegisterServerWithDatabase(const FString& ServerID, const FString& SessionName, int32 Port, const FString& MapName, int32 MaxPlayers)
 {
+    LLM_SCOPE_BYTAG(Bloodread_ServerManager);
     UE_LOG(LogTemp, Warning, TEXT("📝 Registering server with database: %s"), *ServerID);
 
     // Create HTTP request
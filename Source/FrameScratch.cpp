@@ -0,0 +1,79 @@
+#include "FrameScratch.h"
+#include "Engine/World.h"
+
+namespace
+{
+    const TCHAR* FrameScratchSection = TEXT("/Script/BloodreadGame.FrameScratch");
+}
+
+void UFrameScratchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetInt(FrameScratchSection, TEXT("MaxRetainedCapacity"), MaxRetainedCapacity, GGameIni);
+        GConfig->GetFloat(FrameScratchSection, TEXT("StatsLogInterval"), StatsLogInterval, GGameIni);
+    }
+
+    MaxRetainedCapacity = FMath::Max(0, MaxRetainedCapacity);
+    PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UFrameScratchSubsystem::OnWorldPostActorTick);
+}
+
+void UFrameScratchSubsystem::Deinitialize()
+{
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+    Super::Deinitialize();
+}
+
+bool UFrameScratchSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld();
+}
+
+UFrameScratchSubsystem* UFrameScratchSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UFrameScratchSubsystem>() : nullptr;
+}
+
+void UFrameScratchSubsystem::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+    if (InWorld != GetWorld())
+    {
+        return;
+    }
+
+    if (Outstanding > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FrameScratch: %d scratch arrays still borrowed at end of frame"), Outstanding);
+    }
+
+    const int32 Trimmed = HitResults.Trim(MaxRetainedCapacity) + Actors.Trim(MaxRetainedCapacity) + Characters.Trim(MaxRetainedCapacity);
+
+    // Roll the frame over; totals carry on
+    LastFrameStats = FrameStats;
+    LastFrameStats.TotalAllocations += Trimmed;
+    FrameStats = FFrameScratchStats();
+    FrameStats.TotalBorrows = LastFrameStats.TotalBorrows;
+    FrameStats.TotalAllocations = LastFrameStats.TotalAllocations;
+
+    if (StatsLogInterval > 0.0f)
+    {
+        TimeSinceStatsLog += DeltaSeconds;
+        if (TimeSinceStatsLog >= StatsLogInterval)
+        {
+            TimeSinceStatsLog = 0.0f;
+            UE_LOG(LogTemp, Log, TEXT("FrameScratch: %d borrows, %d misses, %d grows, peak %d out last frame; %d borrows / %d allocations total"),
+                   LastFrameStats.Borrows, LastFrameStats.PoolMisses, LastFrameStats.Grows, LastFrameStats.PeakOutstanding,
+                   LastFrameStats.TotalBorrows, LastFrameStats.TotalAllocations);
+        }
+    }
+}
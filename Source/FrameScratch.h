@@ -0,0 +1,202 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/HitResult.h"
+#include "FrameScratch.generated.h"
+
+class ABloodreadBaseCharacter;
+
+// Scratch array traffic for one frame (or, in the Total* fields, since the world started)
+USTRUCT(BlueprintType)
+struct FFrameScratchStats
+{
+    GENERATED_BODY()
+
+    // Scratch arrays handed out last frame
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int32 Borrows = 0;
+
+    // Borrows the pool couldn't serve and had to create a new array for
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int32 PoolMisses = 0;
+
+    // Borrowed arrays that outgrew their pooled capacity (a heap reallocation)
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int32 Grows = 0;
+
+    // Most arrays out at once
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int32 PeakOutstanding = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int32 TotalBorrows = 0;
+
+    // Heap allocations made by scratch arrays overall (misses + grows + trims)
+    UPROPERTY(BlueprintReadOnly, Category = "Memory")
+    int32 TotalAllocations = 0;
+};
+
+// Free list of reusable arrays of one element type. Game thread only.
+template <typename ElementType>
+class TFrameScratchPool
+{
+public:
+    TArray<ElementType>* Acquire(FFrameScratchStats& Stats)
+    {
+        if (Free.Num() > 0)
+        {
+            return Free.Pop(EAllowShrinking::No);
+        }
+
+        ++Stats.PoolMisses;
+        ++Stats.TotalAllocations;
+        return Storage.Add_GetRef(MakeUnique<TArray<ElementType>>()).Get();
+    }
+
+    void Release(TArray<ElementType>* Array)
+    {
+        Array->Reset();
+        Free.Push(Array);
+    }
+
+    // Give back memory from arrays a rare big query blew up, so one spike doesn't stay resident forever
+    int32 Trim(int32 MaxRetainedCapacity)
+    {
+        int32 Trimmed = 0;
+        for (TArray<ElementType>* Array : Free)
+        {
+            if (Array->Max() > MaxRetainedCapacity)
+            {
+                Array->Empty(MaxRetainedCapacity);
+                ++Trimmed;
+            }
+        }
+        return Trimmed;
+    }
+
+private:
+    TArray<TUniquePtr<TArray<ElementType>>> Storage;
+    TArray<TArray<ElementType>*> Free;
+};
+
+/**
+ * Per-world pools of scratch arrays for combat queries (sweeps, actor and team lookups).
+ * Call sites borrow through TFrameScratch for the length of a scope; returned arrays keep their capacity, so the
+ * steady state does no heap allocation at all. At the end of every frame the pools are trimmed back to
+ * MaxRetainedCapacity, stats roll over, and anything still borrowed is reported (a scratch array must not outlive
+ * the frame).
+ * Tuning in [/Script/BloodreadGame.FrameScratch] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UFrameScratchSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    static UFrameScratchSubsystem* Get(const UObject* WorldContextObject);
+
+    template <typename ElementType>
+    TArray<ElementType>* Acquire()
+    {
+        check(IsInGameThread());
+        ++FrameStats.Borrows;
+        ++FrameStats.TotalBorrows;
+        FrameStats.PeakOutstanding = FMath::Max(FrameStats.PeakOutstanding, ++Outstanding);
+        return GetPool<ElementType>().Acquire(FrameStats);
+    }
+
+    template <typename ElementType>
+    void Release(TArray<ElementType>* Array, int32 CapacityAtAcquire)
+    {
+        check(IsInGameThread());
+        if (Array->Max() > CapacityAtAcquire)
+        {
+            ++FrameStats.Grows;
+            ++FrameStats.TotalAllocations;
+        }
+        --Outstanding;
+        GetPool<ElementType>().Release(Array);
+    }
+
+    // Stats for the last completed frame
+    UFUNCTION(BlueprintPure, Category = "Memory")
+    FFrameScratchStats GetStats() const { return LastFrameStats; }
+
+private:
+    template <typename ElementType>
+    TFrameScratchPool<ElementType>& GetPool()
+    {
+        if constexpr (std::is_same_v<ElementType, FHitResult>)
+        {
+            return HitResults;
+        }
+        else if constexpr (std::is_same_v<ElementType, AActor*>)
+        {
+            return Actors;
+        }
+        else
+        {
+            static_assert(std::is_same_v<ElementType, ABloodreadBaseCharacter*>, "No frame scratch pool for this element type");
+            return Characters;
+        }
+    }
+
+    void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+    // Free pooled arrays above this many elements are shrunk back at end of frame
+    int32 MaxRetainedCapacity = 256;
+
+    // Seconds between stats lines in the log (0 = off)
+    float StatsLogInterval = 0.0f;
+
+    TFrameScratchPool<FHitResult> HitResults;
+    TFrameScratchPool<AActor*> Actors;
+    TFrameScratchPool<ABloodreadBaseCharacter*> Characters;
+
+    FFrameScratchStats FrameStats;
+    FFrameScratchStats LastFrameStats;
+    int32 Outstanding = 0;
+    float TimeSinceStatsLog = 0.0f;
+    FDelegateHandle PostActorTickHandle;
+};
+
+/**
+ * Scoped borrow of a scratch array: TFrameScratch<FHitResult> Hits(this); GetWorld()->SweepMultiByChannel(*Hits, ...);
+ * Without a frame scratch subsystem (editor preview worlds, no world yet) it falls back to an array of its own.
+ */
+template <typename ElementType>
+class TFrameScratch
+{
+public:
+    explicit TFrameScratch(const UObject* WorldContextObject)
+        : Arena(UFrameScratchSubsystem::Get(WorldContextObject))
+    {
+        Array = Arena ? Arena->Acquire<ElementType>() : &Fallback;
+        CapacityAtAcquire = Array->Max();
+    }
+
+    ~TFrameScratch()
+    {
+        if (Arena)
+        {
+            Arena->Release(Array, CapacityAtAcquire);
+        }
+    }
+
+    TFrameScratch(const TFrameScratch&) = delete;
+    TFrameScratch& operator=(const TFrameScratch&) = delete;
+
+    TArray<ElementType>& operator*() const { return *Array; }
+    TArray<ElementType>* operator->() const { return Array; }
+
+private:
+    UFrameScratchSubsystem* Arena = nullptr;
+    TArray<ElementType>* Array = nullptr;
+    int32 CapacityAtAcquire = 0;
+    TArray<ElementType> Fallback;
+};
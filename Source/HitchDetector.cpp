@@ -0,0 +1,324 @@
+#include "HitchDetector.h"
+#include "BloodreadBaseCharacter.h"
+#include "BloodreadBotSubsystem.h"
+#include "BloodreadStats.h"
+#include "ProjectileSubsystem.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    const TCHAR* HitchDetectorSection = TEXT("/Script/BloodreadGame.HitchDetector");
+
+    const FName LogTempName(TEXT("LogTemp"));
+
+    // Keeps the most recent game log lines (LogTemp, plus warnings and errors from anywhere) with their frame
+    class FRecentLogLines : public FOutputDevice
+    {
+    public:
+        static constexpr int32 Capacity = 64;
+
+        virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category) override
+        {
+            const ELogVerbosity::Type Level = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+            if (Category != LogTempName && Level > ELogVerbosity::Warning)
+            {
+                return;
+            }
+
+            FScopeLock Lock(&Mutex);
+            FLine& Line = Lines[Next];
+            Line.Frame = GFrameCounter;
+            Line.Category = Category;
+            Line.Text = Message;
+            Next = (Next + 1) % Capacity;
+            Count = FMath::Min(Count + 1, Capacity);
+        }
+
+        virtual bool CanBeUsedOnAnyThread() const override { return true; }
+
+        void GetLinesForFrame(uint64 Frame, TArray<FString>& OutLines) const
+        {
+            FScopeLock Lock(&Mutex);
+            const int32 First = (Next - Count + Capacity) % Capacity;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                const FLine& Line = Lines[(First + Index) % Capacity];
+                if (Line.Frame == Frame)
+                {
+                    OutLines.Add(FString::Printf(TEXT("%s: %s"), *Line.Category.ToString(), *Line.Text));
+                }
+            }
+        }
+
+    private:
+        struct FLine
+        {
+            uint64 Frame = 0;
+            FName Category;
+            FString Text;
+        };
+
+        mutable FCriticalSection Mutex;
+        FLine Lines[Capacity];
+        int32 Next = 0;
+        int32 Count = 0;
+    };
+
+    FRecentLogLines RecentLogLines;
+    int32 ActiveDetectors = 0;
+
+    const TCHAR* GetCombatEventLabel(BloodreadHitch::ECombatEventKind Kind)
+    {
+        switch (Kind)
+        {
+        case BloodreadHitch::ECombatEventKind::Damage:      return TEXT("damage");
+        case BloodreadHitch::ECombatEventKind::Knockback:   return TEXT("knockback");
+        case BloodreadHitch::ECombatEventKind::AbilityCast: return TEXT("ability");
+        default:                                            return TEXT("?");
+        }
+    }
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice HitchReportCommand(
+        TEXT("bloodread.HitchReport"),
+        TEXT("Write a hitch report for the previous frame now, whatever its length"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (UHitchDetectorSubsystem* Detector = UHitchDetectorSubsystem::Get(World))
+            {
+                Detector->CaptureReport(static_cast<float>(FApp::GetDeltaTime() * 1000.0), TEXT("requested"));
+            }
+            else
+            {
+                Ar.Logf(TEXT("Hitch detector is not running in this world (see [HitchDetector] bEnableOnClients)"));
+            }
+        }));
+}
+
+void UHitchDetectorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetFloat(HitchDetectorSection, TEXT("FrameBudgetMs"), FrameBudgetMs, GGameIni);
+        GConfig->GetFloat(HitchDetectorSection, TEXT("MinSecondsBetweenReports"), MinSecondsBetweenReports, GGameIni);
+        GConfig->GetInt(HitchDetectorSection, TEXT("MaxReports"), MaxReports, GGameIni);
+        GConfig->GetInt(HitchDetectorSection, TEXT("TopScopes"), TopScopes, GGameIni);
+        GConfig->GetFloat(HitchDetectorSection, TEXT("CombatEventWindowSeconds"), CombatEventWindowSeconds, GGameIni);
+    }
+
+    if (ActiveDetectors++ == 0)
+    {
+        BloodreadHitch::GCaptureEnabled = true;
+        GLog->AddOutputDevice(&RecentLogLines);
+    }
+}
+
+void UHitchDetectorSubsystem::Deinitialize()
+{
+    LastWrite.Wait();
+
+    if (--ActiveDetectors == 0)
+    {
+        BloodreadHitch::GCaptureEnabled = false;
+        GLog->RemoveOutputDevice(&RecentLogLines);
+    }
+
+    if (HitchesSuppressed > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("HitchDetector: %d reports written, %d more hitches rate limited"), ReportsWritten, HitchesSuppressed);
+    }
+
+    Super::Deinitialize();
+}
+
+bool UHitchDetectorSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    bool bEnabled = true;
+    bool bEnableOnClients = false;
+    if (GConfig)
+    {
+        GConfig->GetBool(HitchDetectorSection, TEXT("bEnabled"), bEnabled, GGameIni);
+        GConfig->GetBool(HitchDetectorSection, TEXT("bEnableOnClients"), bEnableOnClients, GGameIni);
+    }
+
+    const UWorld* World = Cast<UWorld>(Outer);
+    if (!bEnabled || !World || !World->IsGameWorld())
+    {
+        return false;
+    }
+    return bEnableOnClients || World->GetNetMode() != NM_Client;
+}
+
+TStatId UHitchDetectorSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHitchDetectorSubsystem, STATGROUP_Tickables);
+}
+
+UHitchDetectorSubsystem* UHitchDetectorSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UHitchDetectorSubsystem>() : nullptr;
+}
+
+void UHitchDetectorSubsystem::Tick(float DeltaTime)
+{
+    // Real time between the previous frame's start and this one's, which is what the previous frame's capture covers
+    const float FrameMs = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+    if (FrameMs < FrameBudgetMs)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (ReportsWritten >= MaxReports || Now - LastReportTime < MinSecondsBetweenReports)
+    {
+        ++HitchesSuppressed;
+        return;
+    }
+
+    CaptureReport(FrameMs, TEXT("over budget"));
+}
+
+void UHitchDetectorSubsystem::CaptureReport(float FrameMs, const TCHAR* Reason)
+{
+    const uint64 Frame = GFrameCounter - 1;
+    LastReportTime = FPlatformTime::Seconds();
+    ++ReportsWritten;
+
+    const BloodreadHitch::FFrameCapture* Capture = BloodreadHitch::GetFrameCapture(Frame);
+    const BloodreadHitch::FScopeTiming* Slowest = nullptr;
+    if (Capture)
+    {
+        for (const BloodreadHitch::FScopeTiming& Timing : Capture->Scopes)
+        {
+            Slowest = (!Slowest || Timing.Cycles > Slowest->Cycles) ? &Timing : Slowest;
+        }
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("HitchDetector: frame %llu took %.1f ms (budget %.0f ms), slowest scope %s %.2f ms, %d sync loads"),
+           Frame, FrameMs, FrameBudgetMs, Slowest ? Slowest->Name : TEXT("none"),
+           Slowest ? FPlatformTime::ToMilliseconds64(Slowest->Cycles) : 0.0, Capture ? Capture->AssetLoads.Num() : 0);
+
+    WriteReportAsync(BuildReport(FrameMs, Reason, Frame), Frame);
+}
+
+FString UHitchDetectorSubsystem::BuildReport(float FrameMs, const TCHAR* Reason, uint64 Frame) const
+{
+    UWorld* World = GetWorld();
+    FString Report;
+    Report.Reserve(4096);
+
+    Report += FString::Printf(TEXT("Hitch %s: frame %llu, %.1f ms (budget %.0f ms)\n"), Reason, Frame, FrameMs, FrameBudgetMs);
+    Report += FString::Printf(TEXT("Map %s, %s, world time %.2fs, %s UTC\n"), *World->GetMapName(),
+                              World->GetNetMode() == NM_Client ? TEXT("client") : TEXT("server"),
+                              World->GetTimeSeconds(), *FDateTime::UtcNow().ToString());
+
+    // Slowest scopes, inclusive: a damage scope inside an ability scope is counted in both
+    Report += TEXT("\n[Scopes]\n");
+    const BloodreadHitch::FFrameCapture* Capture = BloodreadHitch::GetFrameCapture(Frame);
+    if (Capture && Capture->Scopes.Num() > 0)
+    {
+        TArray<BloodreadHitch::FScopeTiming, TInlineAllocator<16>> Scopes(Capture->Scopes);
+        Scopes.Sort([](const BloodreadHitch::FScopeTiming& A, const BloodreadHitch::FScopeTiming& B) { return A.Cycles > B.Cycles; });
+        for (int32 Index = 0; Index < FMath::Min(TopScopes, Scopes.Num()); ++Index)
+        {
+            Report += FString::Printf(TEXT("  %-28s %8.2f ms  %4d calls\n"), Scopes[Index].Name, FPlatformTime::ToMilliseconds64(Scopes[Index].Cycles), Scopes[Index].Calls);
+        }
+    }
+    else
+    {
+        Report += TEXT("  (no Bloodread scopes ran; time was spent in engine code)\n");
+    }
+
+    Report += TEXT("\n[Asset loads]\n");
+    Report += FString::Printf(TEXT("  async packages pending: %d\n"), GetNumAsyncPackages());
+    if (Capture)
+    {
+        for (const FString& Path : Capture->AssetLoads)
+        {
+            Report += FString::Printf(TEXT("  sync load: %s\n"), *Path);
+        }
+    }
+
+    int32 Characters = 0;
+    FString CharacterLines;
+    const UEnum* ClassEnum = StaticEnum<ECharacterClass>();
+    for (TActorIterator<ABloodreadBaseCharacter> It(World); It; ++It)
+    {
+        const ABloodreadBaseCharacter* Character = *It;
+        const UAnimInstance* AnimInstance = Character->GetMesh() ? Character->GetMesh()->GetAnimInstance() : nullptr;
+        const UAnimMontage* Montage = AnimInstance ? AnimInstance->GetCurrentActiveMontage() : nullptr;
+
+        ++Characters;
+        CharacterLines += FString::Printf(TEXT("  %-32s %-9s hp %4d  montage %-24s cooldowns %.1fs / %.1fs\n"),
+                                          *Character->GetName(), *ClassEnum->GetNameStringByValue(static_cast<int64>(Character->GetCharacterClass())),
+                                          Character->GetCurrentHealth(), Montage ? *Montage->GetName() : TEXT("-"),
+                                          Character->GetAbility1RemainingCooldown(), Character->GetAbility2RemainingCooldown());
+    }
+
+    const UBloodreadBotSubsystem* Bots = UBloodreadBotSubsystem::Get(World);
+    const UProjectileSubsystem* Projectiles = World->GetSubsystem<UProjectileSubsystem>();
+    Report += TEXT("\n[Actors]\n");
+    Report += FString::Printf(TEXT("  actors %d, characters %d, bots %d, projectiles %d\n"), World->GetActorCount(), Characters,
+                              Bots ? Bots->GetBotCount() : 0, Projectiles ? Projectiles->GetNumActiveProjectiles() : 0);
+
+    Report += TEXT("\n[Characters]\n");
+    Report += CharacterLines;
+
+    Report += TEXT("\n[Combat events]\n");
+    TArray<BloodreadHitch::FCombatEventRecord> Events;
+    BloodreadHitch::GetRecentCombatEvents(Events);
+    const double Now = FPlatformTime::Seconds();
+    for (const BloodreadHitch::FCombatEventRecord& Event : Events)
+    {
+        if (Now - Event.Time <= CombatEventWindowSeconds)
+        {
+            Report += FString::Printf(TEXT("  %+7.3fs frame %llu %-9s %s%s%s %.1f\n"), Event.Time - Now, Event.Frame, GetCombatEventLabel(Event.Kind),
+                                      *Event.Subject.ToString(), Event.Other.IsNone() ? TEXT("") : TEXT(" by "),
+                                      Event.Other.IsNone() ? TEXT("") : *Event.Other.ToString(), Event.Value);
+        }
+    }
+
+    Report += TEXT("\n[Log]\n");
+    TArray<FString> LogLines;
+    RecentLogLines.GetLinesForFrame(Frame, LogLines);
+    for (const FString& Line : LogLines)
+    {
+        Report += TEXT("  ") + Line + TEXT("\n");
+    }
+
+    return Report;
+}
+
+void UHitchDetectorSubsystem::WriteReportAsync(FString Report, uint64 Frame)
+{
+    const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Hitches"),
+                                         FString::Printf(TEXT("Hitch_%s_%llu.txt"), *FDateTime::Now().ToString(), Frame));
+
+    LastWrite = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [Path, Report = MoveTemp(Report)]()
+        {
+            if (!FFileHelper::SaveStringToFile(Report, *Path))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("HitchDetector: Could not write %s"), *Path);
+            }
+        },
+        UE::Tasks::Prerequisites(LastWrite), UE::Tasks::ETaskPriority::BackgroundNormal);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "HitchDetector.generated.h"
+
+/**
+ * Writes a short report for every frame over FrameBudgetMs, built from what the game captured during that frame:
+ * the slowest Bloodread stat scopes (inclusive time, see BloodreadHitch in BloodreadStats.h), synchronous asset loads
+ * by path plus pending async loads, live actor counts, each character's class, health, playing montage and cooldowns,
+ * the combat events leading up to the spike and the game log lines written in it.
+ * Reports go to the log (summary) and to Saved/Hitches/*.txt, written off the game thread.
+ * Runs on servers by default; bEnableOnClients turns it on for clients as well.
+ * Settings come from [/Script/BloodreadGame.HitchDetector] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UHitchDetectorSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UHitchDetectorSubsystem* Get(const UObject* WorldContextObject);
+
+    // Build a report for the previous frame regardless of its length (also "bloodread.HitchReport")
+    void CaptureReport(float FrameMs, const TCHAR* Reason);
+
+private:
+    FString BuildReport(float FrameMs, const TCHAR* Reason, uint64 Frame) const;
+    void WriteReportAsync(FString Report, uint64 Frame);
+
+    // Frames at least this long (ms) produce a report
+    float FrameBudgetMs = 50.0f;
+
+    // Reports closer together than this (seconds) are counted but not written
+    float MinSecondsBetweenReports = 5.0f;
+
+    // Stop writing reports after this many per world
+    int32 MaxReports = 50;
+
+    // Number of slowest scopes listed
+    int32 TopScopes = 8;
+
+    // Combat events from this far (seconds) before the hitch are listed
+    float CombatEventWindowSeconds = 2.0f;
+
+    double LastReportTime = -1.0e9;
+    int32 ReportsWritten = 0;
+    int32 HitchesSuppressed = 0;
+    UE::Tasks::FTask LastWrite;
+};
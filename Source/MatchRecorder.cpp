@@ -0,0 +1,605 @@
+#include "MatchRecorder.h"
+#include "BloodreadBaseCharacter.h"
+#include "PracticeDummy.h"
+#include "Engine/World.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    const TCHAR* MatchRecorderSection = TEXT("/Script/BloodreadGame.MatchRecorder");
+
+    constexpr int32 EventHeaderSize = sizeof(uint8) + sizeof(uint16) + sizeof(uint32);
+    constexpr uint16 NoSlot = 0xFFFF;
+
+    // Slot, kind, class, location, yaw, health; the u16 count leads each keyframe payload
+    constexpr int32 KeyframeEntrySize = sizeof(uint16) + sizeof(uint8) * 2 + sizeof(int32) * 3 + sizeof(uint16) + sizeof(int16);
+    constexpr int32 MaxKeyframeEntries = (MAX_uint16 - sizeof(uint16)) / KeyframeEntrySize;
+
+    constexpr uint32 ReplayFileMagic = 0x50525242; // "BRRP"
+    constexpr uint32 ReplayIndexMagic = 0x58495242; // "BRIX"
+    constexpr uint32 ReplayFileVersion = 1;
+    constexpr int64 ReplayFileHeaderSize = sizeof(uint32) * 2;
+    // Keyframe count, duration, stream size, index magic
+    constexpr int64 ReplayFooterSize = sizeof(uint32) + sizeof(uint32) + sizeof(uint64) + sizeof(uint32);
+
+    enum EActorKind : uint8
+    {
+        ActorKind_Character = 1,
+        ActorKind_Dummy = 2
+    };
+
+    int16 GetActorHealth(const AActor* Actor)
+    {
+        if (const ABloodreadBaseCharacter* Character = Cast<ABloodreadBaseCharacter>(Actor))
+        {
+            return static_cast<int16>(FMath::Clamp(Character->GetCurrentHealth(), 0, MAX_int16));
+        }
+        if (const APracticeDummy* Dummy = Cast<APracticeDummy>(Actor))
+        {
+            return static_cast<int16>(FMath::Clamp(Dummy->GetCurrentHealth(), 0, MAX_int16));
+        }
+        return 0;
+    }
+
+    template<typename T>
+    T ReadValue(const uint8* Data)
+    {
+        T Value;
+        FMemory::Memcpy(&Value, Data, sizeof(T));
+        return Value;
+    }
+
+    bool DecodeEvent(const uint8* Data, int64 DataSize, int64& Offset, FMatchEventView& OutEvent)
+    {
+        if (!Data || Offset < 0 || Offset + EventHeaderSize > DataSize)
+        {
+            return false;
+        }
+
+        const uint8* Header = Data + Offset;
+        const uint16 PayloadSize = ReadValue<uint16>(Header + 1);
+        if (Offset + EventHeaderSize + PayloadSize > DataSize)
+        {
+            return false;
+        }
+
+        OutEvent.Type = static_cast<EMatchEventType>(Header[0]);
+        OutEvent.PayloadSize = PayloadSize;
+        OutEvent.TimeMs = ReadValue<uint32>(Header + 3);
+        OutEvent.Payload = Header + EventHeaderSize;
+        Offset += EventHeaderSize + PayloadSize;
+        return true;
+    }
+}
+
+void UMatchRecorderSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetInt(MatchRecorderSection, TEXT("BufferSizeKB"), BufferSizeKB, GGameIni);
+        GConfig->GetFloat(MatchRecorderSection, TEXT("TransformRate"), TransformRate, GGameIni);
+        GConfig->GetFloat(MatchRecorderSection, TEXT("KeyframeInterval"), KeyframeInterval, GGameIni);
+        GConfig->GetBool(MatchRecorderSection, TEXT("bRecordToFile"), bRecordToFile, GGameIni);
+        GConfig->GetInt(MatchRecorderSection, TEXT("FlushChunkKB"), FlushChunkKB, GGameIni);
+    }
+
+    // Allocated once; recording never grows memory after this
+    Ring.SetNumUninitialized(FMath::Max(64, BufferSizeKB) * 1024);
+    Scratch.Reserve(1024);
+
+    UE_LOG(LogTemp, Log, TEXT("MatchRecorder: %dKB ring, transforms at %.0fHz, keyframe every %.1fs"),
+           Ring.Num() / 1024, TransformRate, KeyframeInterval);
+}
+
+void UMatchRecorderSubsystem::Deinitialize()
+{
+    StopFileRecording();
+    Super::Deinitialize();
+}
+
+bool UMatchRecorderSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Only the server sees authoritative combat
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && World->GetNetMode() != NM_Client;
+}
+
+void UMatchRecorderSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (bRecordToFile)
+    {
+        const FString FileName = FString::Printf(TEXT("Match_%s.brreplay"), *FDateTime::Now().ToString());
+        StartFileRecording(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Replays"), FileName));
+    }
+}
+
+TStatId UMatchRecorderSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMatchRecorderSubsystem, STATGROUP_Tickables);
+}
+
+UMatchRecorderSubsystem* UMatchRecorderSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMatchRecorderSubsystem>() : nullptr;
+}
+
+void UMatchRecorderSubsystem::Tick(float DeltaTime)
+{
+    TimeSinceKeyframe += DeltaTime;
+    if (TimeSinceKeyframe >= KeyframeInterval)
+    {
+        TimeSinceKeyframe = 0.0f;
+        TimeSinceTransforms = 0.0f;
+        PruneDestroyedActors();
+        WriteKeyframe(); // Keyframes carry transforms too
+    }
+
+    TimeSinceTransforms += DeltaTime;
+    if (TransformRate > 0.0f && TimeSinceTransforms >= 1.0f / TransformRate)
+    {
+        TimeSinceTransforms = 0.0f;
+        WriteTransforms();
+    }
+
+    FlushFile(false);
+}
+
+void UMatchRecorderSubsystem::RegisterActor(AActor* Actor)
+{
+    if (!Actor || SlotByActor.Contains(Actor) || (FreeSlots.Num() == 0 && Actors.Num() >= NoSlot))
+    {
+        return;
+    }
+
+    // Reuse slots of actors that have left so long matches with respawns stay bounded
+    const uint16 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : static_cast<uint16>(Actors.AddDefaulted());
+    FRecordedActor& Recorded = Actors[Slot];
+    Recorded = FRecordedActor();
+    Recorded.Actor = Actor;
+    Recorded.Key = Actor;
+    if (const ABloodreadBaseCharacter* Character = Cast<ABloodreadBaseCharacter>(Actor))
+    {
+        Recorded.Kind = ActorKind_Character;
+        Recorded.ClassId = static_cast<uint8>(Character->GetCharacterClass());
+    }
+    else if (Cast<APracticeDummy>(Actor))
+    {
+        Recorded.Kind = ActorKind_Dummy;
+    }
+
+    SlotByActor.Add(Actor, Slot);
+
+    BeginEvent(EMatchEventType::ActorAdded);
+    Put<uint16>(Slot);
+    Put<uint8>(Recorded.Kind);
+    Put<uint8>(Recorded.ClassId);
+    EndEvent();
+}
+
+void UMatchRecorderSubsystem::RecordDamage(AActor* Victim, AActor* Attacker, int32 Damage, int32 HealthAfter)
+{
+    UMatchRecorderSubsystem* Recorder = Get(Victim);
+    if (!Recorder)
+    {
+        return;
+    }
+
+    const uint16 VictimSlot = Recorder->FindSlot(Victim);
+    if (VictimSlot == NoSlot)
+    {
+        return;
+    }
+
+    Recorder->BeginEvent(EMatchEventType::Damage);
+    Recorder->Put<uint16>(VictimSlot);
+    Recorder->Put<uint16>(Recorder->FindSlot(Attacker));
+    Recorder->Put<int16>(static_cast<int16>(FMath::Clamp(Damage, 0, MAX_int16)));
+    Recorder->Put<int16>(static_cast<int16>(FMath::Clamp(HealthAfter, 0, MAX_int16)));
+    Recorder->EndEvent();
+}
+
+void UMatchRecorderSubsystem::RecordAction(AActor* Actor, uint8 Action)
+{
+    UMatchRecorderSubsystem* Recorder = Get(Actor);
+    const uint16 Slot = Recorder ? Recorder->FindSlot(Actor) : NoSlot;
+    if (Slot == NoSlot)
+    {
+        return;
+    }
+
+    Recorder->BeginEvent(EMatchEventType::Action);
+    Recorder->Put<uint16>(Slot);
+    Recorder->Put<uint8>(Action);
+    Recorder->EndEvent();
+}
+
+void UMatchRecorderSubsystem::UnregisterActor(AActor* Actor)
+{
+    const uint16 Slot = FindSlot(Actor);
+    if (Slot != NoSlot)
+    {
+        FreeSlot(Slot);
+    }
+}
+
+uint16 UMatchRecorderSubsystem::FindSlot(const AActor* Actor) const
+{
+    const uint16* Slot = Actor ? SlotByActor.Find(Actor) : nullptr;
+    return Slot ? *Slot : NoSlot;
+}
+
+void UMatchRecorderSubsystem::FreeSlot(uint16 Slot)
+{
+    FRecordedActor& Recorded = Actors[Slot];
+    SlotByActor.Remove(Recorded.Key);
+    Recorded = FRecordedActor();
+    FreeSlots.Add(Slot);
+
+    BeginEvent(EMatchEventType::ActorRemoved);
+    Put<uint16>(Slot);
+    EndEvent();
+}
+
+void UMatchRecorderSubsystem::PruneDestroyedActors()
+{
+    // Actors that went away without EndPlay reaching us (e.g. the subsystem was created after they registered)
+    for (int32 Slot = 0; Slot < Actors.Num(); ++Slot)
+    {
+        if (Actors[Slot].Key != TObjectKey<AActor>() && !Actors[Slot].Actor.IsValid())
+        {
+            FreeSlot(static_cast<uint16>(Slot));
+        }
+    }
+}
+
+uint32 UMatchRecorderSubsystem::GetTimeMs() const
+{
+    const UWorld* World = GetWorld();
+    return World ? static_cast<uint32>(World->GetTimeSeconds() * 1000.0) : 0;
+}
+
+void UMatchRecorderSubsystem::BeginEvent(EMatchEventType Type)
+{
+    PendingType = Type;
+    Scratch.Reset();
+    Put<uint8>(static_cast<uint8>(Type));
+    Put<uint16>(0); // Payload size, patched in EndEvent
+    Put<uint32>(GetTimeMs());
+}
+
+void UMatchRecorderSubsystem::EndEvent()
+{
+    // A clamped size would desync every reader from the rest of the stream; drop the event instead
+    if (Scratch.Num() - EventHeaderSize > MAX_uint16)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MatchRecorder: Dropped event type %d with a %d byte payload (limit %d)"),
+               static_cast<int32>(PendingType), Scratch.Num() - EventHeaderSize, static_cast<int32>(MAX_uint16));
+        Scratch.Reset();
+        return;
+    }
+
+    const uint16 PayloadSize = static_cast<uint16>(Scratch.Num() - EventHeaderSize);
+    FMemory::Memcpy(Scratch.GetData() + 1, &PayloadSize, sizeof(uint16));
+
+    if (PendingType == EMatchEventType::Keyframe)
+    {
+        FMatchKeyframe Keyframe;
+        Keyframe.TimeMs = ReadValue<uint32>(Scratch.GetData() + 3);
+        Keyframe.Offset = TotalWritten;
+        RingKeyframes.Add(Keyframe);
+
+        if (ReplayFile)
+        {
+            Keyframe.Offset = TotalWritten - FileStreamStart;
+            FileKeyframes.Add(Keyframe);
+        }
+    }
+
+    AppendToRing(Scratch.GetData(), Scratch.Num());
+    if (ReplayFile)
+    {
+        FileBuffer.Append(Scratch);
+    }
+}
+
+void UMatchRecorderSubsystem::WriteActorState(uint16 Slot, const FRecordedActor& Recorded, bool bIncludeHealth)
+{
+    const AActor* Actor = Recorded.Actor.Get();
+    const FVector Location = Actor->GetActorLocation();
+
+    Put<uint16>(Slot);
+    if (bIncludeHealth)
+    {
+        Put<uint8>(Recorded.Kind);
+        Put<uint8>(Recorded.ClassId);
+    }
+    Put<int32>(FMath::RoundToInt(Location.X));
+    Put<int32>(FMath::RoundToInt(Location.Y));
+    Put<int32>(FMath::RoundToInt(Location.Z));
+    Put<uint16>(FRotator::CompressAxisToShort(Actor->GetActorRotation().Yaw));
+    if (bIncludeHealth)
+    {
+        Put<int16>(GetActorHealth(Actor));
+    }
+}
+
+void UMatchRecorderSubsystem::WriteKeyframe()
+{
+    // Only the first event is a seek point; the rest continue it as KeyframeParts when one payload can't hold everyone
+    BeginEvent(EMatchEventType::Keyframe);
+    int32 CountOffset = Scratch.Num();
+    Put<uint16>(0);
+
+    uint16 Count = 0;
+    for (int32 Slot = 0; Slot < Actors.Num(); ++Slot)
+    {
+        if (!Actors[Slot].Actor.IsValid())
+        {
+            continue;
+        }
+
+        if (Count == MaxKeyframeEntries)
+        {
+            FMemory::Memcpy(Scratch.GetData() + CountOffset, &Count, sizeof(uint16));
+            EndEvent();
+
+            BeginEvent(EMatchEventType::KeyframePart);
+            CountOffset = Scratch.Num();
+            Put<uint16>(0);
+            Count = 0;
+        }
+
+        WriteActorState(static_cast<uint16>(Slot), Actors[Slot], true);
+        ++Count;
+    }
+    FMemory::Memcpy(Scratch.GetData() + CountOffset, &Count, sizeof(uint16));
+
+    EndEvent();
+}
+
+void UMatchRecorderSubsystem::WriteTransforms()
+{
+    for (int32 Slot = 0; Slot < Actors.Num(); ++Slot)
+    {
+        if (Actors[Slot].Actor.IsValid())
+        {
+            BeginEvent(EMatchEventType::Transform);
+            WriteActorState(static_cast<uint16>(Slot), Actors[Slot], false);
+            EndEvent();
+        }
+    }
+}
+
+void UMatchRecorderSubsystem::AppendToRing(const uint8* Data, int32 Size)
+{
+    const uint64 Capacity = Ring.Num();
+    if (Capacity == 0 || Size <= 0)
+    {
+        return;
+    }
+
+    const int32 WritePos = static_cast<int32>(TotalWritten % Capacity);
+    const int32 FirstPart = FMath::Min(Size, static_cast<int32>(Capacity) - WritePos);
+    FMemory::Memcpy(Ring.GetData() + WritePos, Data, FirstPart);
+    if (FirstPart < Size)
+    {
+        FMemory::Memcpy(Ring.GetData(), Data + FirstPart, Size - FirstPart);
+    }
+    TotalWritten += Size;
+
+    // Drop keyframes whose bytes have been overwritten
+    const uint64 OldestValid = TotalWritten > Capacity ? TotalWritten - Capacity : 0;
+    int32 FirstValid = 0;
+    while (FirstValid < RingKeyframes.Num() && RingKeyframes[FirstValid].Offset < OldestValid)
+    {
+        ++FirstValid;
+    }
+    if (FirstValid > 0)
+    {
+        RingKeyframes.RemoveAt(0, FirstValid, EAllowShrinking::No);
+    }
+}
+
+void UMatchRecorderSubsystem::CopyFromRing(uint64 Offset, uint64 Size, uint8* Dest) const
+{
+    const uint64 Capacity = Ring.Num();
+    const int32 ReadPos = static_cast<int32>(Offset % Capacity);
+    const int32 FirstPart = static_cast<int32>(FMath::Min<uint64>(Size, Capacity - ReadPos));
+    FMemory::Memcpy(Dest, Ring.GetData() + ReadPos, FirstPart);
+    if (FirstPart < static_cast<int32>(Size))
+    {
+        FMemory::Memcpy(Dest + FirstPart, Ring.GetData(), Size - FirstPart);
+    }
+}
+
+uint32 UMatchRecorderSubsystem::ExtractRecent(float Seconds, TArray<uint8>& OutStream) const
+{
+    OutStream.Reset();
+    if (RingKeyframes.Num() == 0)
+    {
+        return 0;
+    }
+
+    // Latest keyframe old enough to cover the requested window, or the oldest one still in the ring
+    const int64 WantedMs = static_cast<int64>(GetTimeMs()) - static_cast<int64>(Seconds * 1000.0f);
+    const FMatchKeyframe* Start = &RingKeyframes[0];
+    for (const FMatchKeyframe& Keyframe : RingKeyframes)
+    {
+        if (static_cast<int64>(Keyframe.TimeMs) > WantedMs)
+        {
+            break;
+        }
+        Start = &Keyframe;
+    }
+
+    const uint64 Size = TotalWritten - Start->Offset;
+    OutStream.SetNumUninitialized(static_cast<int32>(Size));
+    CopyFromRing(Start->Offset, Size, OutStream.GetData());
+    return Start->TimeMs;
+}
+
+bool UMatchRecorderSubsystem::ReadEvent(const uint8* Data, int64 DataSize, int64& Offset, FMatchEventView& OutEvent)
+{
+    return DecodeEvent(Data, DataSize, Offset, OutEvent);
+}
+
+bool UMatchRecorderSubsystem::StartFileRecording(const FString& FilePath)
+{
+    StopFileRecording();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+    ReplayFile = PlatformFile.OpenWrite(*FilePath);
+    if (!ReplayFile)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MatchRecorder: Could not open replay file %s"), *FilePath);
+        return false;
+    }
+
+    FileBuffer.Reset();
+    FileBuffer.Reserve(FlushChunkKB * 1024 * 2);
+    FileKeyframes.Reset();
+    const uint32 Header[2] = { ReplayFileMagic, ReplayFileVersion };
+    FileBuffer.Append(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+    FileStreamStart = TotalWritten;
+
+    // Start the file on a keyframe so it can be played from the first byte
+    WriteKeyframe();
+    TimeSinceKeyframe = 0.0f;
+
+    UE_LOG(LogTemp, Log, TEXT("MatchRecorder: Recording replay to %s"), *FilePath);
+    return true;
+}
+
+void UMatchRecorderSubsystem::StopFileRecording()
+{
+    if (!ReplayFile)
+    {
+        return;
+    }
+
+    // Footer: keyframe index, then fixed-size trailer so readers can find it from the end
+    const uint64 StreamSize = TotalWritten - FileStreamStart;
+    for (const FMatchKeyframe& Keyframe : FileKeyframes)
+    {
+        FileBuffer.Append(reinterpret_cast<const uint8*>(&Keyframe.TimeMs), sizeof(uint32));
+        FileBuffer.Append(reinterpret_cast<const uint8*>(&Keyframe.Offset), sizeof(uint64));
+    }
+    const uint32 KeyframeCount = FileKeyframes.Num();
+    const uint32 DurationMs = GetTimeMs();
+    FileBuffer.Append(reinterpret_cast<const uint8*>(&KeyframeCount), sizeof(uint32));
+    FileBuffer.Append(reinterpret_cast<const uint8*>(&DurationMs), sizeof(uint32));
+    FileBuffer.Append(reinterpret_cast<const uint8*>(&StreamSize), sizeof(uint64));
+    FileBuffer.Append(reinterpret_cast<const uint8*>(&ReplayIndexMagic), sizeof(uint32));
+
+    FlushFile(true);
+    delete ReplayFile;
+    ReplayFile = nullptr;
+    FileKeyframes.Reset();
+
+    UE_LOG(LogTemp, Log, TEXT("MatchRecorder: Replay closed (%llu bytes, %u keyframes)"), StreamSize, KeyframeCount);
+}
+
+void UMatchRecorderSubsystem::FlushFile(bool bForce)
+{
+    if (!ReplayFile || FileBuffer.Num() == 0)
+    {
+        return;
+    }
+
+    if (bForce || FileBuffer.Num() >= FlushChunkKB * 1024)
+    {
+        ReplayFile->Write(FileBuffer.GetData(), FileBuffer.Num());
+        FileBuffer.Reset();
+    }
+}
+
+FMatchReplayReader::~FMatchReplayReader()
+{
+    Close();
+}
+
+bool FMatchReplayReader::Open(const FString& FilePath)
+{
+    Close();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    MappedFile.Reset(PlatformFile.OpenMapped(*FilePath));
+    if (!MappedFile || MappedFile->GetFileSize() < ReplayFileHeaderSize + ReplayFooterSize)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MatchReplayReader: Could not map %s"), *FilePath);
+        Close();
+        return false;
+    }
+
+    const int64 FileSize = MappedFile->GetFileSize();
+    MappedRegion.Reset(MappedFile->MapRegion(0, FileSize));
+    const uint8* FileData = MappedRegion ? MappedRegion->GetMappedPtr() : nullptr;
+    if (!FileData || ReadValue<uint32>(FileData) != ReplayFileMagic || ReadValue<uint32>(FileData + sizeof(uint32)) != ReplayFileVersion)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MatchReplayReader: %s is not a replay file"), *FilePath);
+        Close();
+        return false;
+    }
+
+    const uint8* Trailer = FileData + FileSize - ReplayFooterSize;
+    const uint32 KeyframeCount = ReadValue<uint32>(Trailer);
+    DurationMs = ReadValue<uint32>(Trailer + 4);
+    StreamSize = static_cast<int64>(ReadValue<uint64>(Trailer + 8));
+    const int64 IndexSize = static_cast<int64>(KeyframeCount) * (sizeof(uint32) + sizeof(uint64));
+    if (ReadValue<uint32>(Trailer + 16) != ReplayIndexMagic || ReplayFileHeaderSize + StreamSize + IndexSize + ReplayFooterSize != FileSize)
+    {
+        // Unterminated file (server crashed mid-match): stream only, no seek index
+        UE_LOG(LogTemp, Warning, TEXT("MatchReplayReader: %s has no keyframe index"), *FilePath);
+        StreamSize = FileSize - ReplayFileHeaderSize;
+        StreamData = FileData + ReplayFileHeaderSize;
+        return true;
+    }
+
+    StreamData = FileData + ReplayFileHeaderSize;
+    const uint8* Index = StreamData + StreamSize;
+    Keyframes.SetNumUninitialized(KeyframeCount);
+    for (uint32 KeyframeIndex = 0; KeyframeIndex < KeyframeCount; ++KeyframeIndex)
+    {
+        Keyframes[KeyframeIndex].TimeMs = ReadValue<uint32>(Index);
+        Keyframes[KeyframeIndex].Offset = ReadValue<uint64>(Index + sizeof(uint32));
+        Index += sizeof(uint32) + sizeof(uint64);
+    }
+    return true;
+}
+
+void FMatchReplayReader::Close()
+{
+    MappedRegion.Reset();
+    MappedFile.Reset();
+    StreamData = nullptr;
+    StreamSize = 0;
+    Keyframes.Reset();
+    DurationMs = 0;
+}
+
+int64 FMatchReplayReader::SeekToTime(uint32 TimeMs) const
+{
+    // Keyframes are written in time order
+    const int32 Upper = Algo::UpperBoundBy(Keyframes, TimeMs, &FMatchKeyframe::TimeMs);
+    return Upper > 0 ? static_cast<int64>(Keyframes[Upper - 1].Offset) : 0;
+}
+
+bool FMatchReplayReader::ReadEvent(int64& Offset, FMatchEventView& OutEvent) const
+{
+    return DecodeEvent(StreamData, StreamSize, Offset, OutEvent);
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MatchRecorder.generated.h"
+
+class IFileHandle;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Combat event stream format. Every event is a 7 byte header (type, payload size, match time in ms) followed by
+ * a little-endian payload; readers skip types they don't know by payload size.
+ *   ActorAdded  slot u16, kind u8, class u8
+ *   Transform   slot u16, location 3x i32 (cm), yaw u16
+ *   Damage      victim slot u16, attacker slot u16 (0xFFFF = none), damage i16, health after i16
+ *   Action      slot u16, action u8 (ECharacterAnimAction)
+ *   Keyframe    count u16, then per actor: slot u16, kind u8, class u8, location 3x i32, yaw u16, health i16
+ *   ActorRemoved slot u16 (the slot may be reused by a later ActorAdded)
+ *   KeyframePart same layout as Keyframe; continues the keyframe before it when its actors don't fit one payload
+ * Keyframes (with their parts) are self-contained, so playback can start at any of them.
+ */
+enum class EMatchEventType : uint8
+{
+    ActorAdded   = 1,
+    Transform    = 2,
+    Damage       = 3,
+    Action       = 4,
+    Keyframe     = 5,
+    ActorRemoved = 6,
+    KeyframePart = 7
+};
+
+// Seek point: match time and byte offset of a keyframe event in the stream
+struct FMatchKeyframe
+{
+    uint32 TimeMs = 0;
+    uint64 Offset = 0;
+};
+
+// One decoded event header plus a view of its payload
+struct FMatchEventView
+{
+    EMatchEventType Type = EMatchEventType::Keyframe;
+    uint32 TimeMs = 0;
+    const uint8* Payload = nullptr;
+    uint16 PayloadSize = 0;
+};
+
+/**
+ * Always-on server match recorder.
+ * Damage, ability/attack activations (the server's view of player input) and transforms at a low fixed rate are
+ * packed into a fixed-size ring buffer; the last few seconds can be pulled out for a kill-cam at any time.
+ * With bRecordToFile the same stream is also appended to Saved/Replays in chunks, with a keyframe index footer
+ * that FMatchReplayReader uses to seek a memory-mapped replay. Settings come from
+ * [/Script/BloodreadGame.MatchRecorder] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UMatchRecorderSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UMatchRecorderSubsystem* Get(const UObject* WorldContextObject);
+
+    // Start tracking an actor (characters and dummies register themselves on the server)
+    void RegisterActor(AActor* Actor);
+
+    // Stop tracking an actor and free its slot (called from EndPlay)
+    void UnregisterActor(AActor* Actor);
+
+    // Static helpers so call sites don't need to check whether recording is running
+    static void RecordDamage(AActor* Victim, AActor* Attacker, int32 Damage, int32 HealthAfter);
+    static void RecordAction(AActor* Actor, uint8 Action);
+
+    // Copy the stream from the last keyframe at least Seconds old to now; returns the start time in ms
+    uint32 ExtractRecent(float Seconds, TArray<uint8>& OutStream) const;
+
+    // Append the stream to a replay file (closes any file already open)
+    bool StartFileRecording(const FString& FilePath);
+    void StopFileRecording();
+
+    // Decode the event at Offset in a stream buffer and advance Offset past it
+    static bool ReadEvent(const uint8* Data, int64 DataSize, int64& Offset, FMatchEventView& OutEvent);
+
+private:
+    struct FRecordedActor
+    {
+        TWeakObjectPtr<AActor> Actor;
+        TObjectKey<AActor> Key; // Still valid for removing the map entry once the actor is gone
+        uint8 Kind = 0;
+        uint8 ClassId = 0;
+    };
+
+    uint16 FindSlot(const AActor* Actor) const;
+    void FreeSlot(uint16 Slot);
+    void PruneDestroyedActors();
+    uint32 GetTimeMs() const;
+
+    void BeginEvent(EMatchEventType Type);
+    void EndEvent();
+    void WriteActorState(uint16 Slot, const FRecordedActor& Recorded, bool bIncludeHealth);
+    void WriteKeyframe();
+    void WriteTransforms();
+
+    void AppendToRing(const uint8* Data, int32 Size);
+    void CopyFromRing(uint64 Offset, uint64 Size, uint8* Dest) const;
+    void FlushFile(bool bForce);
+
+    template<typename T>
+    void Put(T Value)
+    {
+        Scratch.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+    }
+
+    // Ring buffer size (KB)
+    int32 BufferSizeKB = 1024;
+
+    // Transform samples per second
+    float TransformRate = 10.0f;
+
+    // Seconds between keyframes
+    float KeyframeInterval = 2.0f;
+
+    // Also write every match to Saved/Replays
+    bool bRecordToFile = false;
+
+    // File writes are batched into chunks of this size (KB)
+    int32 FlushChunkKB = 64;
+
+    TArray<uint8> Ring;
+    uint64 TotalWritten = 0;
+    TArray<FMatchKeyframe> RingKeyframes;
+
+    TArray<uint8> Scratch;
+    EMatchEventType PendingType = EMatchEventType::Keyframe;
+
+    TArray<FRecordedActor> Actors;
+    TMap<TObjectKey<AActor>, uint16> SlotByActor;
+    TArray<uint16> FreeSlots;
+
+    float TimeSinceTransforms = 0.0f;
+    float TimeSinceKeyframe = 0.0f;
+
+    // File recording
+    IFileHandle* ReplayFile = nullptr;
+    TArray<uint8> FileBuffer;
+    TArray<FMatchKeyframe> FileKeyframes;
+    uint64 FileStreamStart = 0;
+};
+
+/**
+ * Reads a replay written by UMatchRecorderSubsystem through a memory-mapped view, so seeking is just a
+ * keyframe index lookup followed by reading events in place.
+ */
+class BLOODREADGAME_API FMatchReplayReader
+{
+public:
+    ~FMatchReplayReader();
+
+    bool Open(const FString& FilePath);
+    void Close();
+
+    // Byte offset of the last keyframe at or before TimeMs (start of the stream if there is none)
+    int64 SeekToTime(uint32 TimeMs) const;
+
+    // Decode the event at Offset and advance past it; false at the end of the stream
+    bool ReadEvent(int64& Offset, FMatchEventView& OutEvent) const;
+
+    const TArray<FMatchKeyframe>& GetKeyframes() const { return Keyframes; }
+    uint32 GetDurationMs() const { return DurationMs; }
+
+private:
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    const uint8* StreamData = nullptr;
+    int64 StreamSize = 0;
+    TArray<FMatchKeyframe> Keyframes;
+    uint32 DurationMs = 0;
+};
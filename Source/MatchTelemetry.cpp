@@ -0,0 +1,579 @@
+#include "MatchTelemetry.h"
+#include "BloodreadBaseCharacter.h"
+#include "BloodreadBotSubsystem.h"
+#include "FrameScratch.h"
+#include "MatchRecorder.h"
+#include "ProjectileSubsystem.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    const TCHAR* MatchTelemetrySection = TEXT("/Script/BloodreadGame.MatchTelemetry");
+
+    constexpr uint32 TelemetryFileMagic = 0x4D545242; // "BRTM"
+    constexpr uint32 TelemetryFileVersion = 1;
+    constexpr int32 EventHeaderSize = sizeof(uint8) + sizeof(uint16) + sizeof(uint32);
+
+    uint16 ClampU16(int64 Value)
+    {
+        return static_cast<uint16>(FMath::Clamp<int64>(Value, 0, MAX_uint16));
+    }
+
+    FString GetTelemetryDir()
+    {
+        return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Telemetry"));
+    }
+}
+
+const float UMatchTelemetrySubsystem::FrameBucketUpperMs[NumFrameBuckets] = { 8.4f, 16.7f, 33.4f, 50.0f, 100.0f, 250.0f, 500.0f, TNumericLimits<float>::Max() };
+
+void UMatchTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetFloat(MatchTelemetrySection, TEXT("SampleInterval"), SampleInterval, GGameIni);
+        GConfig->GetFloat(MatchTelemetrySection, TEXT("HitchThresholdMs"), HitchThresholdMs, GGameIni);
+        GConfig->GetInt(MatchTelemetrySection, TEXT("FlushChunkKB"), FlushChunkKB, GGameIni);
+    }
+
+    SampleInterval = FMath::Max(0.1f, SampleInterval);
+    FlushChunkKB = FMath::Max(4, FlushChunkKB);
+    Pending.Reserve(FlushChunkKB * 1024 + 1024);
+}
+
+void UMatchTelemetrySubsystem::Deinitialize()
+{
+    CloseFile();
+    Super::Deinitialize();
+}
+
+bool UMatchTelemetrySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    bool bEnabled = true;
+    bool bDedicatedServerOnly = true;
+    if (GConfig)
+    {
+        GConfig->GetBool(MatchTelemetrySection, TEXT("bEnabled"), bEnabled, GGameIni);
+        GConfig->GetBool(MatchTelemetrySection, TEXT("bDedicatedServerOnly"), bDedicatedServerOnly, GGameIni);
+    }
+
+    const UWorld* World = Cast<UWorld>(Outer);
+    if (!bEnabled || !World || !World->IsGameWorld())
+    {
+        return false;
+    }
+    return bDedicatedServerOnly ? World->GetNetMode() == NM_DedicatedServer : World->GetNetMode() != NM_Client;
+}
+
+void UMatchTelemetrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    const FString MapName = InWorld.GetMapName();
+    FilePath = FPaths::Combine(GetTelemetryDir(), FString::Printf(TEXT("Match_%s_%s.brtm"), *FDateTime::Now().ToString(), *MapName));
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*GetTelemetryDir());
+    File = MakeShareable(PlatformFile.OpenWrite(*FilePath));
+    if (!File.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("MatchTelemetry: Could not open %s"), *FilePath);
+        return;
+    }
+
+    Put<uint32>(TelemetryFileMagic);
+    Put<uint32>(TelemetryFileVersion);
+
+    BeginEvent(ETelemetryEventType::MatchInfo);
+    Put<int64>(FDateTime::UtcNow().GetTicks());
+    Put<float>(HitchThresholdMs);
+    Put<uint8>(NumFrameBuckets);
+    for (float UpperMs : FrameBucketUpperMs)
+    {
+        Put<float>(UpperMs);
+    }
+    const FTCHARToUTF8 MapNameUtf8(*MapName);
+    const uint16 MapNameLength = ClampU16(MapNameUtf8.Length());
+    Put<uint16>(MapNameLength);
+    Pending.Append(reinterpret_cast<const uint8*>(MapNameUtf8.Get()), MapNameLength);
+    EndEvent();
+
+    UE_LOG(LogTemp, Log, TEXT("MatchTelemetry: Recording to %s (sample every %.1fs, hitch at %.0fms)"), *FilePath, SampleInterval, HitchThresholdMs);
+}
+
+TStatId UMatchTelemetrySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMatchTelemetrySubsystem, STATGROUP_Tickables);
+}
+
+UMatchTelemetrySubsystem* UMatchTelemetrySubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UMatchTelemetrySubsystem>() : nullptr;
+}
+
+int32 UMatchTelemetrySubsystem::GetFrameBucket(float FrameMs)
+{
+    for (int32 Bucket = 0; Bucket < NumFrameBuckets - 1; ++Bucket)
+    {
+        if (FrameMs <= FrameBucketUpperMs[Bucket])
+        {
+            return Bucket;
+        }
+    }
+    return NumFrameBuckets - 1;
+}
+
+void UMatchTelemetrySubsystem::Tick(float DeltaTime)
+{
+    if (!File.IsValid())
+    {
+        return;
+    }
+
+    // Real frame time, not dilated game time; it covers the counters gathered since the last tick
+    const float FrameSeconds = static_cast<float>(FApp::GetDeltaTime());
+    const float FrameMs = FrameSeconds * 1000.0f;
+
+    ++TotalFrames;
+    MatchSeconds += FrameSeconds;
+    if (FrameMs >= HitchThresholdMs)
+    {
+        WriteHitch(FrameMs);
+    }
+
+    WindowSeconds += FrameSeconds;
+    WindowFrames = WindowFrames < MAX_uint16 ? WindowFrames + 1 : WindowFrames;
+    WindowFrameMsSum += FrameMs;
+    WindowMaxMs = FMath::Max(WindowMaxMs, FrameMs);
+    uint16& Bucket = WindowBuckets[GetFrameBucket(FrameMs)];
+    Bucket = Bucket < MAX_uint16 ? Bucket + 1 : Bucket;
+
+    WindowCounters.AbilitiesCast += FrameCounters.AbilitiesCast;
+    WindowCounters.DamageEvents += FrameCounters.DamageEvents;
+    WindowCounters.Knockbacks += FrameCounters.Knockbacks;
+    WindowCounters.Spawns += FrameCounters.Spawns;
+    FrameCounters = FFrameCounters();
+
+    if (WindowSeconds >= SampleInterval)
+    {
+        WriteSample();
+        WriteConnections();
+
+        WindowSeconds = 0.0f;
+        WindowFrames = 0;
+        WindowFrameMsSum = 0.0;
+        WindowMaxMs = 0.0f;
+        FMemory::Memzero(WindowBuckets);
+        WindowCounters = FFrameCounters();
+    }
+
+    FlushAsync(false);
+}
+
+void UMatchTelemetrySubsystem::NoteAbilityCast(const ABloodreadBaseCharacter* Caster)
+{
+    if (UMatchTelemetrySubsystem* Telemetry = Get(Caster))
+    {
+        ++Telemetry->FrameCounters.AbilitiesCast;
+        Telemetry->FrameCounters.CasterClassMask |= 1 << FMath::Min<uint8>(static_cast<uint8>(Caster->GetCharacterClass()), 15);
+    }
+}
+
+void UMatchTelemetrySubsystem::NoteDamage(const AActor* Victim)
+{
+    if (UMatchTelemetrySubsystem* Telemetry = Get(Victim))
+    {
+        ++Telemetry->FrameCounters.DamageEvents;
+    }
+}
+
+void UMatchTelemetrySubsystem::NoteKnockback(const AActor* Target)
+{
+    if (UMatchTelemetrySubsystem* Telemetry = Get(Target))
+    {
+        ++Telemetry->FrameCounters.Knockbacks;
+    }
+}
+
+void UMatchTelemetrySubsystem::NoteSpawn(const AActor* Spawned)
+{
+    if (UMatchTelemetrySubsystem* Telemetry = Get(Spawned))
+    {
+        ++Telemetry->FrameCounters.Spawns;
+    }
+}
+
+void UMatchTelemetrySubsystem::WriteSample()
+{
+    UWorld* World = GetWorld();
+    const AGameStateBase* GameState = World->GetGameState();
+    const UBloodreadBotSubsystem* Bots = UBloodreadBotSubsystem::Get(World);
+    const UProjectileSubsystem* Projectiles = World->GetSubsystem<UProjectileSubsystem>();
+    const UFrameScratchSubsystem* Scratch = UFrameScratchSubsystem::Get(World);
+
+    int32 Characters = 0;
+    for (TActorIterator<ABloodreadBaseCharacter> It(World); It; ++It)
+    {
+        ++Characters;
+    }
+
+    BeginEvent(ETelemetryEventType::Sample);
+    Put<float>(WindowSeconds);
+    Put<uint16>(WindowFrames);
+    Put<float>(WindowFrames > 0 ? static_cast<float>(WindowFrameMsSum / WindowFrames) : 0.0f);
+    Put<float>(WindowMaxMs);
+    for (uint16 Count : WindowBuckets)
+    {
+        Put<uint16>(Count);
+    }
+    Put<uint16>(ClampU16(GameState ? GameState->PlayerArray.Num() : 0));
+    Put<uint16>(ClampU16(Bots ? Bots->GetBotCount() : 0));
+    Put<uint16>(ClampU16(Characters));
+    Put<uint16>(ClampU16(Projectiles ? Projectiles->GetNumActiveProjectiles() : 0));
+    Put<uint16>(WindowCounters.DamageEvents);
+    Put<uint16>(WindowCounters.Knockbacks);
+    Put<uint16>(WindowCounters.AbilitiesCast);
+    Put<uint16>(WindowCounters.Spawns);
+    Put<uint32>(Scratch ? static_cast<uint32>(Scratch->GetStats().TotalBorrows) : 0);
+    EndEvent();
+}
+
+void UMatchTelemetrySubsystem::WriteConnections()
+{
+    const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+    if (!NetDriver)
+    {
+        return;
+    }
+
+    for (UNetConnection* Connection : NetDriver->ClientConnections)
+    {
+        if (!Connection)
+        {
+            continue;
+        }
+
+        uint16* ConnectionId = ConnectionIds.Find(Connection);
+        if (!ConnectionId)
+        {
+            ConnectionId = &ConnectionIds.Add(Connection, ClampU16(ConnectionIds.Num()));
+        }
+
+        BeginEvent(ETelemetryEventType::Connection);
+        Put<uint16>(*ConnectionId);
+        Put<uint32>(static_cast<uint32>(FMath::Max(0, Connection->InBytesPerSecond)));
+        Put<uint32>(static_cast<uint32>(FMath::Max(0, Connection->OutBytesPerSecond)));
+        Put<uint16>(ClampU16(FMath::RoundToInt64(Connection->AvgLag * 1000.0)));
+        EndEvent();
+    }
+}
+
+void UMatchTelemetrySubsystem::WriteHitch(float FrameMs)
+{
+    ++TotalHitches;
+
+    const AGameStateBase* GameState = GetWorld()->GetGameState();
+
+    BeginEvent(ETelemetryEventType::Hitch);
+    Put<float>(FrameMs);
+    Put<uint16>(ClampU16(GameState ? GameState->PlayerArray.Num() : 0));
+    Put<uint8>(static_cast<uint8>(FMath::Min<uint16>(FrameCounters.AbilitiesCast, MAX_uint8)));
+    Put<uint16>(FrameCounters.CasterClassMask);
+    Put<uint16>(FrameCounters.DamageEvents);
+    Put<uint8>(static_cast<uint8>(FMath::Min<uint16>(FrameCounters.Spawns, MAX_uint8)));
+    EndEvent();
+}
+
+void UMatchTelemetrySubsystem::BeginEvent(ETelemetryEventType Type)
+{
+    EventStart = Pending.Num();
+    Put<uint8>(static_cast<uint8>(Type));
+    Put<uint16>(0); // Payload size, patched in EndEvent
+    const UWorld* World = GetWorld();
+    Put<uint32>(World ? static_cast<uint32>(World->GetTimeSeconds() * 1000.0) : 0);
+}
+
+void UMatchTelemetrySubsystem::EndEvent()
+{
+    const uint16 PayloadSize = ClampU16(Pending.Num() - EventStart - EventHeaderSize);
+    FMemory::Memcpy(Pending.GetData() + EventStart + 1, &PayloadSize, sizeof(PayloadSize));
+}
+
+void UMatchTelemetrySubsystem::FlushAsync(bool bForce)
+{
+    if (!File.IsValid() || Pending.Num() == 0 || (!bForce && Pending.Num() < FlushChunkKB * 1024))
+    {
+        return;
+    }
+
+    // Each chunk is written after the previous one finishes, so the file stays in order
+    LastWrite = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [File = File, Chunk = MoveTemp(Pending)]()
+        {
+            File->Write(Chunk.GetData(), Chunk.Num());
+        },
+        UE::Tasks::Prerequisites(LastWrite), UE::Tasks::ETaskPriority::BackgroundNormal);
+
+    Pending.Reset();
+    Pending.Reserve(FlushChunkKB * 1024 + 1024);
+}
+
+void UMatchTelemetrySubsystem::CloseFile()
+{
+    if (!File.IsValid())
+    {
+        return;
+    }
+
+    BeginEvent(ETelemetryEventType::MatchEnd);
+    Put<float>(static_cast<float>(MatchSeconds));
+    Put<uint32>(TotalFrames);
+    Put<uint32>(TotalHitches);
+    EndEvent();
+
+    FlushAsync(true);
+    LastWrite.Wait();
+    File->Flush();
+    File.Reset();
+
+    UE_LOG(LogTemp, Log, TEXT("MatchTelemetry: Closed %s (%.0fs, %u frames, %u hitches)"), *FilePath, MatchSeconds, TotalFrames, TotalHitches);
+}
+
+// --- Offline analyzer ---
+
+namespace
+{
+    struct FPayloadReader
+    {
+        const uint8* Data = nullptr;
+        int32 Size = 0;
+        int32 Pos = 0;
+
+        template<typename T>
+        T Read()
+        {
+            T Value{};
+            if (Pos + static_cast<int32>(sizeof(T)) <= Size)
+            {
+                FMemory::Memcpy(&Value, Data + Pos, sizeof(T));
+            }
+            Pos += sizeof(T);
+            return Value;
+        }
+    };
+
+    struct FMatchSummary
+    {
+        FString File;
+        FString MapName;
+        double Seconds = 0.0;
+        uint64 Frames = 0;
+        double FrameMsSum = 0.0;
+        float MaxMs = 0.0f;
+        uint32 Hitches = 0;
+        uint16 PeakPlayers = 0;
+        double InBytesSum = 0.0;
+        double OutBytesSum = 0.0;
+        uint32 ConnectionSamples = 0;
+    };
+
+    struct FPlayerBand
+    {
+        double Seconds = 0.0;
+        uint32 Hitches = 0;
+    };
+
+    constexpr int32 MaxClassBits = 16;
+}
+
+UMatchTelemetryCommandlet::UMatchTelemetryCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UMatchTelemetryCommandlet::Main(const FString& Params)
+{
+    FString Dir = GetTelemetryDir();
+    FParse::Value(*Params, TEXT("Dir="), Dir);
+    FString CsvPath;
+    FParse::Value(*Params, TEXT("Csv="), CsvPath);
+
+    TArray<FString> FileNames;
+    IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Dir, TEXT("*.brtm")), true, false);
+    if (FileNames.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MatchTelemetry: No .brtm files in %s"), *Dir);
+        return 1;
+    }
+
+    constexpr int32 NumBuckets = UMatchTelemetrySubsystem::NumFrameBuckets;
+    uint64 Buckets[NumBuckets] = {};
+    uint32 HitchClassCounts[MaxClassBits] = {};
+    TMap<uint16, FPlayerBand> PlayerBands;
+    TArray<FMatchSummary> Matches;
+
+    for (const FString& FileName : FileNames)
+    {
+        TArray<uint8> Bytes;
+        const FString Path = FPaths::Combine(Dir, FileName);
+        if (!FFileHelper::LoadFileToArray(Bytes, *Path) || Bytes.Num() < 8
+            || FMemory::Memcmp(Bytes.GetData(), &TelemetryFileMagic, sizeof(uint32)) != 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MatchTelemetry: Skipping %s (not a telemetry file)"), *FileName);
+            continue;
+        }
+
+        FMatchSummary& Match = Matches.AddDefaulted_GetRef();
+        Match.File = FileName;
+
+        uint16 LastPlayers = 0;
+        int64 Offset = 8;
+        FMatchEventView Event;
+        while (UMatchRecorderSubsystem::ReadEvent(Bytes.GetData(), Bytes.Num(), Offset, Event))
+        {
+            FPayloadReader Reader{ Event.Payload, Event.PayloadSize };
+            switch (static_cast<ETelemetryEventType>(static_cast<uint8>(Event.Type)))
+            {
+            case ETelemetryEventType::MatchInfo:
+            {
+                Reader.Read<int64>();
+                Reader.Read<float>();
+                Reader.Pos += Reader.Read<uint8>() * sizeof(float);
+                const uint16 NameLength = Reader.Read<uint16>();
+                if (Reader.Pos + NameLength <= Reader.Size)
+                {
+                    Match.MapName = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Reader.Data + Reader.Pos), NameLength));
+                }
+                break;
+            }
+            case ETelemetryEventType::Sample:
+            {
+                const float Seconds = Reader.Read<float>();
+                const uint16 Frames = Reader.Read<uint16>();
+                const float AverageMs = Reader.Read<float>();
+                const float MaxMs = Reader.Read<float>();
+                for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+                {
+                    Buckets[Bucket] += Reader.Read<uint16>();
+                }
+                LastPlayers = Reader.Read<uint16>();
+
+                Match.Seconds += Seconds;
+                Match.Frames += Frames;
+                Match.FrameMsSum += static_cast<double>(AverageMs) * Frames;
+                Match.MaxMs = FMath::Max(Match.MaxMs, MaxMs);
+                Match.PeakPlayers = FMath::Max(Match.PeakPlayers, LastPlayers);
+                PlayerBands.FindOrAdd(LastPlayers).Seconds += Seconds;
+                break;
+            }
+            case ETelemetryEventType::Connection:
+            {
+                Reader.Read<uint16>();
+                Match.InBytesSum += Reader.Read<uint32>();
+                Match.OutBytesSum += Reader.Read<uint32>();
+                ++Match.ConnectionSamples;
+                break;
+            }
+            case ETelemetryEventType::Hitch:
+            {
+                Reader.Read<float>();
+                const uint16 Players = Reader.Read<uint16>();
+                Reader.Read<uint8>();
+                const uint16 ClassMask = Reader.Read<uint16>();
+
+                ++Match.Hitches;
+                ++PlayerBands.FindOrAdd(Players).Hitches;
+                for (int32 ClassBit = 0; ClassBit < MaxClassBits; ++ClassBit)
+                {
+                    HitchClassCounts[ClassBit] += (ClassMask >> ClassBit) & 1;
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    // Frame time distribution across all matches
+    uint64 TotalFrames = 0;
+    for (uint64 Count : Buckets)
+    {
+        TotalFrames += Count;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("=== Match telemetry: %d matches, %llu frames ==="), Matches.Num(), TotalFrames);
+    uint64 Cumulative = 0;
+    float P50 = 0.0f, P95 = 0.0f, P99 = 0.0f;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        const uint64 Previous = Cumulative;
+        Cumulative += Buckets[Bucket];
+        const float UpperMs = UMatchTelemetrySubsystem::FrameBucketUpperMs[Bucket];
+        P50 = (Previous < TotalFrames * 0.50 && Cumulative >= TotalFrames * 0.50) ? UpperMs : P50;
+        P95 = (Previous < TotalFrames * 0.95 && Cumulative >= TotalFrames * 0.95) ? UpperMs : P95;
+        P99 = (Previous < TotalFrames * 0.99 && Cumulative >= TotalFrames * 0.99) ? UpperMs : P99;
+        UE_LOG(LogTemp, Display, TEXT("  <= %8.1f ms  %10llu  (%5.1f%%)"), UpperMs, Buckets[Bucket], TotalFrames > 0 ? 100.0 * Buckets[Bucket] / TotalFrames : 0.0);
+    }
+    UE_LOG(LogTemp, Display, TEXT("  p50 <= %.1f ms, p95 <= %.1f ms, p99 <= %.1f ms (bucket upper bounds)"), P50, P95, P99);
+
+    // Hitch rate by how many players were connected
+    PlayerBands.KeySort(TLess<uint16>());
+    UE_LOG(LogTemp, Display, TEXT("Hitches by player count:"));
+    for (const TPair<uint16, FPlayerBand>& Band : PlayerBands)
+    {
+        UE_LOG(LogTemp, Display, TEXT("  %3u players: %6u hitches over %7.0fs (%.2f/min)"), Band.Key, Band.Value.Hitches, Band.Value.Seconds,
+               Band.Value.Seconds > 0.0 ? Band.Value.Hitches * 60.0 / Band.Value.Seconds : 0.0);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("Classes casting in hitch frames:"));
+    const UEnum* ClassEnum = StaticEnum<ECharacterClass>();
+    for (int32 ClassBit = 0; ClassBit < MaxClassBits; ++ClassBit)
+    {
+        if (HitchClassCounts[ClassBit] > 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("  %-10s %u"), *ClassEnum->GetNameStringByValue(ClassBit), HitchClassCounts[ClassBit]);
+        }
+    }
+
+    FString Csv = TEXT("File,Map,Seconds,Frames,AvgFrameMs,MaxFrameMs,Hitches,PeakPlayers,AvgInBytesPerConn,AvgOutBytesPerConn\n");
+    UE_LOG(LogTemp, Display, TEXT("Per match:"));
+    for (const FMatchSummary& Match : Matches)
+    {
+        const double AverageMs = Match.Frames > 0 ? Match.FrameMsSum / Match.Frames : 0.0;
+        const double AverageIn = Match.ConnectionSamples > 0 ? Match.InBytesSum / Match.ConnectionSamples : 0.0;
+        const double AverageOut = Match.ConnectionSamples > 0 ? Match.OutBytesSum / Match.ConnectionSamples : 0.0;
+        UE_LOG(LogTemp, Display, TEXT("  %s: %.0fs, avg %.2f ms, max %.1f ms, %u hitches, %u players peak, %.0f/%.0f B/s in/out per connection"),
+               *Match.File, Match.Seconds, AverageMs, Match.MaxMs, Match.Hitches, Match.PeakPlayers, AverageIn, AverageOut);
+        Csv += FString::Printf(TEXT("%s,%s,%.1f,%llu,%.3f,%.1f,%u,%u,%.0f,%.0f\n"), *Match.File, *Match.MapName, Match.Seconds, Match.Frames,
+                               AverageMs, Match.MaxMs, Match.Hitches, Match.PeakPlayers, AverageIn, AverageOut);
+    }
+
+    if (!CsvPath.IsEmpty() && !FFileHelper::SaveStringToFile(Csv, *CsvPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("MatchTelemetry: Could not write %s"), *CsvPath);
+        return 1;
+    }
+    return 0;
+}
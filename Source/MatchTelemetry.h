@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Commandlets/Commandlet.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
+#include "MatchTelemetry.generated.h"
+
+class ABloodreadBaseCharacter;
+class IFileHandle;
+class UNetConnection;
+
+/**
+ * Telemetry file format (Saved/Telemetry/*.brtm). Same framing as the replay stream: a 7 byte event header (type,
+ * payload size, match time in ms) and a little-endian payload; readers skip types they don't know by payload size.
+ *   MatchInfo   start UTC ticks i64, hitch threshold ms f32, bucket count u8, bucket upper bounds (ms) f32 each,
+ *               map name (u16 length + UTF-8)
+ *   Sample      seconds f32, frames u16, average ms f32, max ms f32, bucket counts u16 each,
+ *               players u16, bots u16, characters u16, projectiles u16,
+ *               damage events u16, knockbacks u16, abilities cast u16, spawns u16, scratch borrows since start u32
+ *   Connection  connection id u16, in B/s u32, out B/s u32, ping ms u16
+ *   Hitch       frame ms f32, players u16, abilities cast this frame u8, caster class mask u16 (1 << ECharacterClass),
+ *               damage events this frame u16, spawns this frame u8
+ *   MatchEnd    duration s f32, frames u32, hitches u32
+ */
+enum class ETelemetryEventType : uint8
+{
+    MatchInfo  = 1,
+    Sample     = 2,
+    Connection = 3,
+    Hitch      = 4,
+    MatchEnd   = 5
+};
+
+/**
+ * Per-match server performance telemetry. Frame times go into a fixed histogram, and every SampleInterval the
+ * window is written out with player counts, game subsystem counters and per-connection bandwidth. Frames over
+ * HitchThresholdMs are written individually, with what the game was doing that frame (abilities by class,
+ * damage, spawns), so hitches can be lined up against content.
+ * Records are packed on the game thread and the file writes run as a chain of background tasks.
+ * UMatchTelemetryCommandlet aggregates any number of match files offline.
+ * Settings come from [/Script/BloodreadGame.MatchTelemetry] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UMatchTelemetrySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static constexpr int32 NumFrameBuckets = 8;
+    static const float FrameBucketUpperMs[NumFrameBuckets];
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UMatchTelemetrySubsystem* Get(const UObject* WorldContextObject);
+
+    // Static helpers so call sites don't need to check whether telemetry is running
+    static void NoteAbilityCast(const ABloodreadBaseCharacter* Caster);
+    static void NoteDamage(const AActor* Victim);
+    static void NoteKnockback(const AActor* Target);
+    static void NoteSpawn(const AActor* Spawned);
+
+    static int32 GetFrameBucket(float FrameMs);
+
+private:
+    struct FFrameCounters
+    {
+        uint16 AbilitiesCast = 0;
+        uint16 CasterClassMask = 0;
+        uint16 DamageEvents = 0;
+        uint16 Knockbacks = 0;
+        uint16 Spawns = 0;
+    };
+
+    void WriteSample();
+    void WriteConnections();
+    void WriteHitch(float FrameMs);
+
+    void BeginEvent(ETelemetryEventType Type);
+    void EndEvent();
+    void FlushAsync(bool bForce);
+    void CloseFile();
+
+    template<typename T>
+    void Put(T Value)
+    {
+        Pending.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+    }
+
+    // Seconds per sample record
+    float SampleInterval = 1.0f;
+
+    // Frames at least this long (ms) are written as hitch events
+    float HitchThresholdMs = 50.0f;
+
+    // Bytes are handed to the writer task in chunks of this size (KB)
+    int32 FlushChunkKB = 32;
+
+    // Game-thread buffer; swapped out whole for each background write
+    TArray<uint8> Pending;
+    int32 EventStart = 0;
+
+    TSharedPtr<IFileHandle, ESPMode::ThreadSafe> File;
+    UE::Tasks::FTask LastWrite;
+    FString FilePath;
+
+    // Current sample window
+    float WindowSeconds = 0.0f;
+    uint16 WindowFrames = 0;
+    double WindowFrameMsSum = 0.0;
+    float WindowMaxMs = 0.0f;
+    uint16 WindowBuckets[NumFrameBuckets] = {};
+    FFrameCounters WindowCounters;
+
+    // Counters for the frame in progress (hitch context)
+    FFrameCounters FrameCounters;
+
+    TMap<TObjectKey<UNetConnection>, uint16> ConnectionIds;
+    uint32 TotalFrames = 0;
+    uint32 TotalHitches = 0;
+    double MatchSeconds = 0.0;
+};
+
+/**
+ * Offline aggregation of telemetry files across matches:
+ *   UnrealEditor-Cmd BloodreadGame -run=MatchTelemetry [-Dir=<folder>] [-Csv=<summary.csv>]
+ * Prints the merged frame-time histogram and percentiles, hitch rates by player count and the classes casting in
+ * hitch frames, and average bandwidth per connection; -Csv also writes one summary row per match.
+ */
+UCLASS()
+class BLOODREADGAME_API UMatchTelemetryCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMatchTelemetryCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -1,4 +1,5 @@
 #include "MultiplayerLobbyWidget.h"
+#include "BloodreadMemory.h"
 #include "Components/Button.h"
 #include "BloodreadGameInstance.h"
 #include "ServerEntryWidget.h"
@@ -157,6 +158,7 @@ void UMultiplayerLobbyWidget::CreateSteamSession()
 
 void UMultiplayerLobbyWidget::FindSteamSessions()
 {
+    LLM_SCOPE_BYTAG(Bloodread_SessionBrowser);
     if (!BloodreadGameInstance)
     {
         UpdateStatusText(TEXT("Error: Game Instance not found"));
@@ -300,6 +302,7 @@ void UMultiplayerLobbyWidget::HandleSessionJoined(bool bWasSuccessful)
 
 void UMultiplayerLobbyWidget::HandleSessionsFound(bool bWasSuccessful, const TArray<FSessionInfo>& Sessions)
 {
+    LLM_SCOPE_BYTAG(Bloodread_SessionBrowser);
     bSearchingForSessions = false;
     
     // Cache the sessions for fallback connection
@@ -357,6 +360,7 @@ void UMultiplayerLobbyWidget::ClearServerList()
 
 void UMultiplayerLobbyWidget::AddServerEntry(const FSessionInfo& SessionInfo, int32 Index)
 {
+    LLM_SCOPE_BYTAG(Bloodread_SessionBrowser);
     if (!ServerListScrollBox)
     {
         UE_LOG(LogTemp, Error, TEXT("❌ ServerListScrollBox is NULL - check Blueprint bindings"));
@@ -0,0 +1,244 @@
+#include "NetInterpolation.h"
+#include "Engine/World.h"
+
+namespace
+{
+    const TCHAR* NetInterpolationSection = TEXT("/Script/BloodreadGame.NetInterpolation");
+
+    // Transit baseline creep (seconds per second) so a clock offset that grows is eventually followed
+    constexpr double TransitBaselineRelax = 0.01;
+}
+
+// --- FNetSnapshotBuffer ---
+
+void FNetSnapshotBuffer::Add(const FNetProxySnapshot& Snapshot)
+{
+    if (Snapshots.Num() > 0 && Snapshot.ServerTime <= Snapshots.Last().ServerTime)
+    {
+        // No newer server time (rotation-only update, or the stamp didn't advance) - latest data wins, keep the slot's time
+        FNetProxySnapshot& Newest = Snapshots.Last();
+        const double NewestTime = Newest.ServerTime;
+        const bool bWasTeleport = Newest.bTeleport;
+        Newest = Snapshot;
+        Newest.ServerTime = NewestTime;
+        Newest.bTeleport |= bWasTeleport;
+        return;
+    }
+
+    if (Snapshots.Num() >= MaxSnapshots)
+    {
+        Snapshots.RemoveAt(0);
+    }
+    Snapshots.Add(Snapshot);
+}
+
+bool FNetSnapshotBuffer::Sample(double RenderTime, float MaxExtrapolation, FVector& OutLocation, FQuat& OutRotation) const
+{
+    if (Snapshots.Num() == 0)
+    {
+        return false;
+    }
+
+    if (RenderTime <= Snapshots[0].ServerTime)
+    {
+        OutLocation = Snapshots[0].Location;
+        OutRotation = Snapshots[0].Rotation;
+        return false;
+    }
+
+    for (int32 Index = 0; Index + 1 < Snapshots.Num(); ++Index)
+    {
+        const FNetProxySnapshot& From = Snapshots[Index];
+        const FNetProxySnapshot& To = Snapshots[Index + 1];
+        if (RenderTime >= To.ServerTime)
+        {
+            continue;
+        }
+
+        // Hold until the teleport time, then snap
+        if (To.bTeleport)
+        {
+            OutLocation = From.Location;
+            OutRotation = From.Rotation;
+            return false;
+        }
+
+        // Hermite with the replicated velocities keeps knockback arcs curved between updates
+        const double Span = To.ServerTime - From.ServerTime;
+        const float Alpha = static_cast<float>((RenderTime - From.ServerTime) / Span);
+        OutLocation = FMath::CubicInterp(From.Location, From.Velocity * Span, To.Location, To.Velocity * Span, Alpha);
+        OutRotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha);
+        return false;
+    }
+
+    // Past the newest snapshot: carry on along its velocity for a short while, then hold
+    const FNetProxySnapshot& Newest = Snapshots.Last();
+    const float Ahead = static_cast<float>(FMath::Min(RenderTime - Newest.ServerTime, static_cast<double>(MaxExtrapolation)));
+    OutLocation = Newest.Location + Newest.Velocity * Ahead;
+    OutRotation = Newest.Rotation;
+    return !Newest.Velocity.IsNearlyZero(1.0f);
+}
+
+void FNetSnapshotBuffer::Prune(double RenderTime)
+{
+    int32 FirstNeeded = 0;
+    while (FirstNeeded + 1 < Snapshots.Num() && Snapshots[FirstNeeded + 1].ServerTime <= RenderTime)
+    {
+        ++FirstNeeded;
+    }
+    if (FirstNeeded > 0)
+    {
+        Snapshots.RemoveAt(0, FirstNeeded);
+    }
+}
+
+// --- UNetInterpolationSubsystem ---
+
+void UNetInterpolationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetBool(NetInterpolationSection, TEXT("bEnabled"), bEnabled, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("MinDelay"), MinDelay, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("MaxDelay"), MaxDelay, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("JitterMultiplier"), JitterMultiplier, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("LossPadding"), LossPadding, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("DelayRiseRate"), DelayRiseRate, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("DelayFallRate"), DelayFallRate, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("MaxExtrapolation"), MaxExtrapolation, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("TeleportSnapDistance"), TeleportSnapDistance, GGameIni);
+        GConfig->GetFloat(NetInterpolationSection, TEXT("StatsLogInterval"), StatsLogInterval, GGameIni);
+    }
+
+    MinDelay = FMath::Max(0.0f, MinDelay);
+    MaxDelay = FMath::Max(MinDelay, MaxDelay);
+    MaxExtrapolation = FMath::Max(0.0f, MaxExtrapolation);
+    CurrentDelay = FMath::Clamp(UpdateInterval, MinDelay, MaxDelay);
+
+    if (bEnabled)
+    {
+        UE_LOG(LogTemp, Log, TEXT("NetInterpolation: Adaptive delay %.0f-%.0fms, %.0fms max extrapolation"),
+               MinDelay * 1000.0f, MaxDelay * 1000.0f, MaxExtrapolation * 1000.0f);
+    }
+}
+
+bool UNetInterpolationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Only network clients have simulated proxies to draw
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && World->GetNetMode() == NM_Client;
+}
+
+TStatId UNetInterpolationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNetInterpolationSubsystem, STATGROUP_Tickables);
+}
+
+UNetInterpolationSubsystem* UNetInterpolationSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    UNetInterpolationSubsystem* Subsystem = World ? World->GetSubsystem<UNetInterpolationSubsystem>() : nullptr;
+    return Subsystem && Subsystem->bEnabled ? Subsystem : nullptr;
+}
+
+double UNetInterpolationSubsystem::GetLocalTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UNetInterpolationSubsystem::ReportSnapshot(double ServerTime, double PreviousServerTime, bool bProxyWasMoving)
+{
+    const double Arrival = GetLocalTime();
+    const double Transit = Arrival - ServerTime;
+
+    if (!bHaveTransit)
+    {
+        TransitBaseline = Transit;
+        bHaveTransit = true;
+    }
+    else
+    {
+        // Interarrival jitter: J += (|D| - J) / 16
+        const float TransitDelta = static_cast<float>(FMath::Abs(Transit - LastTransit));
+        Jitter += (TransitDelta - Jitter) / 16.0f;
+        TransitBaseline = FMath::Min(Transit, TransitBaseline + TransitBaselineRelax * (Arrival - LastArrival));
+    }
+    LastTransit = Transit;
+    LastArrival = Arrival;
+    ++Stats.SnapshotsReceived;
+
+    // Loss from gaps in one proxy's server timestamps; a standing proxy legitimately stops sending
+    const double Gap = ServerTime - PreviousServerTime;
+    if (PreviousServerTime < 0.0 || Gap <= 0.0 || Gap > 1.0 || !bProxyWasMoving)
+    {
+        return;
+    }
+
+    int32 Missed = 0;
+    if (Gap < UpdateInterval * 1.5f)
+    {
+        UpdateInterval += (static_cast<float>(Gap) - UpdateInterval) / 8.0f;
+    }
+    else
+    {
+        Missed = FMath::Max(0, FMath::RoundToInt(static_cast<float>(Gap) / UpdateInterval) - 1);
+        // Learn a genuinely slower update rate instead of calling it loss forever
+        UpdateInterval += (static_cast<float>(Gap) - UpdateInterval) / 64.0f;
+    }
+
+    const float LossSample = static_cast<float>(Missed) / static_cast<float>(Missed + 1);
+    LossRate += (LossSample - LossRate) / 16.0f;
+}
+
+float UNetInterpolationSubsystem::GetTargetDelay() const
+{
+    // One interval so the next snapshot is normally already here, plus headroom for jitter and lost updates
+    const float Target = UpdateInterval + JitterMultiplier * Jitter + LossRate * LossPadding;
+    return FMath::Clamp(Target, MinDelay, MaxDelay);
+}
+
+double UNetInterpolationSubsystem::GetRenderServerTime() const
+{
+    return GetLocalTime() - TransitBaseline - CurrentDelay;
+}
+
+void UNetInterpolationSubsystem::Tick(float DeltaTime)
+{
+    // Rate-limited so playback speed only bends slightly while the delay adapts
+    const float TargetDelay = GetTargetDelay();
+    if (TargetDelay > CurrentDelay)
+    {
+        CurrentDelay = FMath::Min(TargetDelay, CurrentDelay + DelayRiseRate * DeltaTime);
+    }
+    else
+    {
+        CurrentDelay = FMath::Max(TargetDelay, CurrentDelay - DelayFallRate * DeltaTime);
+    }
+
+    Stats.JitterMs = Jitter * 1000.0f;
+    Stats.LossRate = LossRate;
+    Stats.UpdateIntervalMs = UpdateInterval * 1000.0f;
+    Stats.DelayMs = CurrentDelay * 1000.0f;
+    Stats.TargetDelayMs = TargetDelay * 1000.0f;
+    Stats.ExtrapolatingProxies = ExtrapolatingThisFrame;
+    ExtrapolatingThisFrame = 0;
+
+    if (StatsLogInterval > 0.0f)
+    {
+        TimeSinceStatsLog += DeltaTime;
+        if (TimeSinceStatsLog >= StatsLogInterval)
+        {
+            TimeSinceStatsLog = 0.0f;
+            UE_LOG(LogTemp, Log, TEXT("NetInterpolation: jitter %.1fms, loss %.1f%%, interval %.0fms, delay %.0fms (target %.0fms), %d extrapolating"),
+                   Stats.JitterMs, Stats.LossRate * 100.0f, Stats.UpdateIntervalMs, Stats.DelayMs, Stats.TargetDelayMs, Stats.ExtrapolatingProxies);
+        }
+    }
+}
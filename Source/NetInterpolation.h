@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NetInterpolation.generated.h"
+
+// One replicated movement update for a simulated proxy, stamped with server world time
+struct FNetProxySnapshot
+{
+    double ServerTime = 0.0;
+    FVector Location = FVector::ZeroVector;
+    FQuat Rotation = FQuat::Identity;
+    FVector Velocity = FVector::ZeroVector;
+
+    // Discontinuity (teleport): snap to this snapshot instead of sliding into it
+    bool bTeleport = false;
+};
+
+// Short time-ordered buffer of proxy snapshots, sampled at a delayed render time
+class BLOODREADGAME_API FNetSnapshotBuffer
+{
+public:
+    static constexpr int32 MaxSnapshots = 16;
+
+    // Add a snapshot; one with the same or an older server time replaces the newest
+    void Add(const FNetProxySnapshot& Snapshot);
+
+    // Position at RenderTime: hermite between the surrounding snapshots, or extrapolated from the newest one for
+    // at most MaxExtrapolation seconds. Returns true while extrapolating a moving proxy past the newest snapshot.
+    bool Sample(double RenderTime, float MaxExtrapolation, FVector& OutLocation, FQuat& OutRotation) const;
+
+    // Drop snapshots no longer needed for RenderTime (keeps the one just before it)
+    void Prune(double RenderTime);
+
+    const FNetProxySnapshot* GetNewest() const { return Snapshots.Num() > 0 ? &Snapshots.Last() : nullptr; }
+    bool IsEmpty() const { return Snapshots.Num() == 0; }
+    void Reset() { Snapshots.Reset(); }
+
+private:
+    TArray<FNetProxySnapshot, TInlineAllocator<MaxSnapshots>> Snapshots;
+};
+
+// Connection quality and buffering as seen by this client
+USTRUCT(BlueprintType)
+struct FNetInterpolationStats
+{
+    GENERATED_BODY()
+
+    // Smoothed variation in snapshot transit time (ms)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    float JitterMs = 0.0f;
+
+    // Estimated fraction of movement updates lost (0..1)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    float LossRate = 0.0f;
+
+    // Typical gap between updates for one proxy (ms)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    float UpdateIntervalMs = 0.0f;
+
+    // Interpolation delay currently applied to remote characters (ms)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    float DelayMs = 0.0f;
+
+    // Delay the current jitter and loss call for (ms); DelayMs moves towards this
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    float TargetDelayMs = 0.0f;
+
+    // Proxies extrapolating past their newest snapshot last frame
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 ExtrapolatingProxies = 0;
+
+    // Snapshots received since the world started
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 SnapshotsReceived = 0;
+};
+
+/**
+ * Client-side adaptive interpolation delay for remote characters.
+ * Every simulated proxy's movement update feeds the connection's transit-time jitter (RFC 3550 style running
+ * estimate) and a loss estimate from gaps in the server timestamps. Remote characters are then drawn at
+ * server time minus a delay of one update interval plus enough headroom to ride out that jitter and loss, so
+ * knockback arcs and teleports play back from real snapshots instead of default smoothing snapping to each
+ * late update. The delay grows quickly when the connection gets worse and shrinks slowly when it recovers,
+ * so playback never visibly jumps. Gaps longer than the buffer are covered by brief extrapolation.
+ * Settings come from [/Script/BloodreadGame.NetInterpolation] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UNetInterpolationSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Returns nullptr off network clients and when adaptive interpolation is disabled
+    static UNetInterpolationSubsystem* Get(const UObject* WorldContextObject);
+
+    // Feed one received movement update; bProxyWasMoving says whether a gap since the previous one means loss
+    void ReportSnapshot(double ServerTime, double PreviousServerTime, bool bProxyWasMoving);
+
+    // Server time remote characters should be drawn at this frame
+    double GetRenderServerTime() const;
+
+    // Called by proxies that ran out of snapshots this frame
+    void NoteExtrapolation() { ++ExtrapolatingThisFrame; }
+
+    float GetMaxExtrapolation() const { return MaxExtrapolation; }
+    float GetTeleportSnapDistance() const { return TeleportSnapDistance; }
+
+    UFUNCTION(BlueprintPure, Category = "Network")
+    FNetInterpolationStats GetStats() const { return Stats; }
+
+private:
+    double GetLocalTime() const;
+    float GetTargetDelay() const;
+
+    bool bEnabled = true;
+
+    // Delay limits (seconds)
+    float MinDelay = 0.03f;
+    float MaxDelay = 0.25f;
+
+    // Headroom per second of measured jitter
+    float JitterMultiplier = 3.0f;
+
+    // Extra delay at 100% loss (scaled by the loss rate)
+    float LossPadding = 0.2f;
+
+    // How fast the delay may grow / shrink (seconds of delay per second)
+    float DelayRiseRate = 0.25f;
+    float DelayFallRate = 0.05f;
+
+    // Longest a proxy is extrapolated past its newest snapshot (seconds)
+    float MaxExtrapolation = 0.15f;
+
+    // Moves longer than this between two updates (cm) are treated as teleports
+    float TeleportSnapDistance = 400.0f;
+
+    // Seconds between stats lines in the log (0 = off)
+    float StatsLogInterval = 0.0f;
+
+    // Transit time (local arrival - server stamp) baseline; tracks the lowest recent transit
+    double TransitBaseline = 0.0;
+    double LastTransit = 0.0;
+    double LastArrival = 0.0;
+    bool bHaveTransit = false;
+
+    float Jitter = 0.0f;
+    float LossRate = 0.0f;
+    float UpdateInterval = 0.1f;
+    float CurrentDelay = 0.1f;
+
+    int32 ExtrapolatingThisFrame = 0;
+    float TimeSinceStatsLog = 0.0f;
+    FNetInterpolationStats Stats;
+};
@@ -1,4 +1,7 @@
 #include "PracticeDummy.h"
+#include "BloodreadGame.h"
+#include "BloodreadMemory.h"
+#include "BloodreadStats.h"
 #include "BloodreadPlayerCharacter.h"
 #include "BloodreadGameMode.h"
 #include "Components/StaticMeshComponent.h"
@@ -11,9 +14,14 @@
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
 #include "TimerManager.h"
+#include "BloodreadSignificance.h"
+#include "CombatTickSubsystem.h"
+#include "MatchRecorder.h"
+#include "MatchTelemetry.h"
 
 APracticeDummy::APracticeDummy()
 {
+    LLM_SCOPE_BYTAG(Bloodread_Characters);
     PrimaryActorTick.bCanEverTick = true;
 
     // Create collision capsule as root
@@ -34,12 +42,15 @@ APracticeDummy::APracticeDummy()
     DummyMesh->SetSimulatePhysics(false);
     DummyMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision); // Let capsule handle collision
     
-    // Create health bar widget component
-    HealthBarWidgetComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthBarWidgetComponent"));
-    HealthBarWidgetComponent->SetupAttachment(RootComponent);
-    HealthBarWidgetComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 120.0f)); // Above dummy head
-    HealthBarWidgetComponent->SetDrawSize(FVector2D(200.0f, 50.0f));
-    HealthBarWidgetComponent->SetWidgetSpace(EWidgetSpace::Screen); // Always face camera
+    // Create health bar widget component (never on dedicated servers)
+    if (!BloodreadCosmetics::IsServerProcess())
+    {
+        HealthBarWidgetComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthBarWidgetComponent"));
+        HealthBarWidgetComponent->SetupAttachment(RootComponent);
+        HealthBarWidgetComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 120.0f)); // Above dummy head
+        HealthBarWidgetComponent->SetDrawSize(FVector2D(200.0f, 50.0f));
+        HealthBarWidgetComponent->SetWidgetSpace(EWidgetSpace::Screen); // Always face camera
+    }
     
     // Try to set widget class - this may be overridden by Blueprint
     // Note: The actual widget class should be set in Blueprint defaults
@@ -53,11 +64,43 @@ APracticeDummy::APracticeDummy()
 
 void APracticeDummy::BeginPlay()
 {
+    LLM_SCOPE_BYTAG(Bloodread_Characters);
     Super::BeginPlay();
     
     // Store initial location for reset purposes
     InitialLocation = GetActorLocation();
+    PreviousStepLocation = InitialLocation;
+    if (DummyMesh)
+    {
+        DummyMeshBaseLocation = DummyMesh->GetRelativeLocation();
+    }
+
+    if (UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this))
+    {
+        FixedCombatStepHandle = CombatTick->OnFixedStep.AddWeakLambda(this, [this](float StepSeconds, uint32 /*StepIndex*/)
+        {
+            FixedCombatStep(StepSeconds);
+        });
+    }
+
+    if (UBloodreadSignificanceSubsystem* Significance = UBloodreadSignificanceSubsystem::Get(this))
+    {
+        Significance->RegisterActor(this);
+    }
+
+    if (UMatchRecorderSubsystem* Recorder = UMatchRecorderSubsystem::Get(this))
+    {
+        Recorder->RegisterActor(this);
+    }
     
+    // Dedicated servers have no health bar; drop any widget components Blueprint defaults added
+    if (BloodreadCosmetics::ShouldSkip(this))
+    {
+        BloodreadCosmetics::StripWidgetComponents(this);
+        HealthBarWidgetComponent = nullptr;
+        return;
+    }
+
     // Initialize health bar widget - try multiple approaches
     UWidgetComponent* WorkingWidgetComponent = nullptr;
     
@@ -73,7 +116,7 @@ void APracticeDummy::BeginPlay()
         UE_LOG(LogTemp, Error, TEXT("Practice Dummy C++ HealthBarWidgetComponent is null!"));
         
         // Approach 2: Find any widget component by name (Blueprint components)
-        TArray<UWidgetComponent*> WidgetComponents;
+        TArray<UWidgetComponent*, TInlineAllocator<4>> WidgetComponents;
         GetComponents<UWidgetComponent>(WidgetComponents);
         
         UE_LOG(LogTemp, Warning, TEXT("Found %d widget components total"), WidgetComponents.Num());
@@ -135,11 +178,28 @@ void APracticeDummy::BeginPlay()
            CurrentHealth, MaxHealth, *InitialLocation.ToString());
 }
 
-void APracticeDummy::Tick(float DeltaTime)
+void APracticeDummy::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
-    
+    if (UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this))
+    {
+        CombatTick->OnFixedStep.Remove(FixedCombatStepHandle);
+    }
+    FixedCombatStepHandle.Reset();
+
+    if (UMatchRecorderSubsystem* Recorder = UMatchRecorderSubsystem::Get(this))
+    {
+        Recorder->UnregisterActor(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void APracticeDummy::FixedCombatStep(float StepSeconds)
+{
+    ProcessGameTick();
+
     FVector CurrentLocation = GetActorLocation();
+    PreviousStepLocation = CurrentLocation;
     bool bShouldApplyGravity = false;
     
     // Apply knockback velocity if any
@@ -150,7 +210,7 @@ void APracticeDummy::Tick(float DeltaTime)
         // Apply gravity to Z component if dummy is above ground
         if (CurrentLocation.Z > InitialLocation.Z + 5.0f) // 5 unit tolerance
         {
-            CurrentKnockbackVelocity.Z -= 980.0f * DeltaTime; // Apply gravity (980 cm/s^2)
+            CurrentKnockbackVelocity.Z -= 980.0f * StepSeconds; // Apply gravity (980 cm/s^2)
             bShouldApplyGravity = true;
         }
         else if (CurrentKnockbackVelocity.Z < 0.0f)
@@ -160,7 +220,7 @@ void APracticeDummy::Tick(float DeltaTime)
         }
         
         // Apply movement with collision detection
-        FVector MovementDelta = CurrentKnockbackVelocity * DeltaTime;
+        FVector MovementDelta = CurrentKnockbackVelocity * StepSeconds;
         FVector NewLocation = CurrentLocation + MovementDelta;
         
         // Clamp to ground level
@@ -190,7 +250,7 @@ void APracticeDummy::Tick(float DeltaTime)
         
         // Decay horizontal velocity
         FVector HorizontalVelocity = FVector(CurrentKnockbackVelocity.X, CurrentKnockbackVelocity.Y, 0.0f);
-        HorizontalVelocity = FMath::VInterpTo(HorizontalVelocity, FVector::ZeroVector, DeltaTime, KnockbackDecayRate);
+        HorizontalVelocity = FMath::VInterpTo(HorizontalVelocity, FVector::ZeroVector, StepSeconds, KnockbackDecayRate);
         CurrentKnockbackVelocity.X = HorizontalVelocity.X;
         CurrentKnockbackVelocity.Y = HorizontalVelocity.Y;
         
@@ -207,7 +267,7 @@ void APracticeDummy::Tick(float DeltaTime)
     {
         // Apply settling gravity even when no knockback velocity
         FVector SettleVelocity = FVector(0.0f, 0.0f, -500.0f); // Gentle settling
-        FVector MovementDelta = SettleVelocity * DeltaTime;
+        FVector MovementDelta = SettleVelocity * StepSeconds;
         FVector NewLocation = CurrentLocation + MovementDelta;
         
         if (NewLocation.Z <= InitialLocation.Z)
@@ -220,6 +280,20 @@ void APracticeDummy::Tick(float DeltaTime)
         SetActorLocation(NewLocation, true, &HitResult);
         UE_LOG(LogTemp, VeryVerbose, TEXT("Practice Dummy settling to ground"));
     }
+}
+
+void APracticeDummy::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Draw the mesh between the last two combat steps so knockback stays smooth at any frame rate
+    if (DummyMesh && !DummyMesh->IsSimulatingPhysics() && GetNetMode() != NM_DedicatedServer)
+    {
+        const UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this);
+        const float Alpha = CombatTick ? CombatTick->GetInterpolationAlpha() : 1.0f;
+        const FVector VisualLag = (PreviousStepLocation - GetActorLocation()) * (1.0f - Alpha);
+        DummyMesh->SetRelativeLocation(DummyMeshBaseLocation + GetActorTransform().InverseTransformVectorNoScale(VisualLag));
+    }
     
     // Always ensure dummy stays upright
     FRotator CurrentRotation = GetActorRotation();
@@ -234,6 +308,7 @@ void APracticeDummy::Tick(float DeltaTime)
 
 void APracticeDummy::TakeCustomDamage(int32 Damage, ABloodreadPlayerCharacter* Attacker)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadDamage);
     UE_LOG(LogTemp, Error, TEXT("=== DUMMY DAMAGE CALLED === Damage: %d, Current Health: %d, CanTakeDamage: %s"), 
            Damage, CurrentHealth, bCanTakeDamage ? TEXT("true") : TEXT("false"));
     
@@ -246,12 +321,18 @@ void APracticeDummy::TakeCustomDamage(int32 Damage, ABloodreadPlayerCharacter* A
 
     int32 PreviousHealth = CurrentHealth;
     CurrentHealth = FMath::Max(0, CurrentHealth - Damage);
+    UBloodreadSignificanceSubsystem::NotifyCombat(this);
+    UMatchRecorderSubsystem::RecordDamage(this, Attacker, PreviousHealth - CurrentHealth, CurrentHealth);
+    BloodreadTrace::Damage(this, Attacker, PreviousHealth - CurrentHealth);
+    UMatchTelemetrySubsystem::NoteDamage(this);
     
-    // Set damage immunity following game tick system
+    // Set damage immunity following game tick system (counted down in FixedCombatStep)
     ABloodreadGameMode* GameMode = Cast<ABloodreadGameMode>(UGameplayStatics::GetGameMode(this));
-    if (GameMode)
+    const UCombatTickSubsystem* CombatTick = UCombatTickSubsystem::Get(this);
+    if (GameMode && CombatTick)
     {
-        bCanTakeDamage = false;
+        DamageImmunityTicksRemaining = CombatTick->SecondsToSteps(DamageImmunityDuration);
+        bCanTakeDamage = DamageImmunityTicksRemaining == 0;
     }
     
     // Update health bar display
@@ -277,6 +358,9 @@ void APracticeDummy::TakeCustomDamage(int32 Damage, ABloodreadPlayerCharacter* A
 
 void APracticeDummy::ApplyKnockback(FVector KnockbackDirection, float Force)
 {
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadKnockback);
+    BloodreadTrace::Knockback(this, KnockbackDirection, Force);
+    UMatchTelemetrySubsystem::NoteKnockback(this);
     if (bUseStablePhysics)
     {
         // Apply knockback resistance
@@ -326,6 +410,7 @@ void APracticeDummy::ResetDummy()
     // Reset position and rotation to initial state
     SetActorLocation(InitialLocation);
     SetActorRotation(FRotator::ZeroRotator);
+    PreviousStepLocation = InitialLocation; // Don't interpolate across the reset
     
     // Reset knockback velocity
     CurrentKnockbackVelocity = FVector::ZeroVector;
@@ -367,6 +452,11 @@ float APracticeDummy::GetHealthPercentage() const
 
 void APracticeDummy::SetHealthBarWidget(UUserWidget* Widget)
 {
+    if (BloodreadCosmetics::ShouldSkip(this))
+    {
+        return;
+    }
+
     if (!Widget)
     {
         UE_LOG(LogTemp, Error, TEXT("*** SetHealthBarWidget: Widget parameter is NULL! ***"));
@@ -390,6 +480,12 @@ void APracticeDummy::SetHealthBarWidget(UUserWidget* Widget)
 
 void APracticeDummy::UpdateHealthDisplay()
 {
+    if (BloodreadCosmetics::ShouldSkip(this))
+    {
+        return;
+    }
+
+    BLOODREAD_SCOPE(STAT_BloodreadHUD);
     UE_LOG(LogTemp, Error, TEXT("=== UpdateHealthDisplay CALLED === Health: %d/%d"), CurrentHealth, MaxHealth);
     
     if (CurrentHealthBarWidget)
@@ -563,7 +659,11 @@ void APracticeDummy::UpdateHealthDisplay()
 
 void APracticeDummy::FlashRed()
 {
-    if (bIsFlashingRed) return;
+    if (bIsFlashingRed || BloodreadCosmetics::ShouldSkip(this)) return;
+
+    // Skip the flash for dummies the local player can't meaningfully see
+    const UBloodreadSignificanceSubsystem* Significance = UBloodreadSignificanceSubsystem::Get(this);
+    if (Significance && !Significance->ShouldPlayCosmetic(this, EBloodreadSignificanceTier::Medium)) return;
     
     bIsFlashingRed = true;
     
@@ -642,13 +742,14 @@ void APracticeDummy::DebugUpdateHealthBar()
 
 void APracticeDummy::FixHealthBarWidget()
 {
+    LLM_SCOPE_BYTAG(Bloodread_UI);
     UE_LOG(LogTemp, Error, TEXT("*** MANUAL WIDGET FIX CALLED ***"));
     
     // Reset widget reference
     CurrentHealthBarWidget = nullptr;
     
     // Find all widget components and try to connect
-    TArray<UWidgetComponent*> WidgetComponents;
+    TArray<UWidgetComponent*, TInlineAllocator<4>> WidgetComponents;
     GetComponents<UWidgetComponent>(WidgetComponents);
     
     UE_LOG(LogTemp, Warning, TEXT("Found %d widget components total"), WidgetComponents.Num());
@@ -20,10 +20,14 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     virtual void Tick(float DeltaTime) override;
 
+    // Knockback physics and damage immunity, advanced by UCombatTickSubsystem
+    void FixedCombatStep(float StepSeconds);
+
     // Dummy stats
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dummy Stats")
     int32 MaxHealth = 200;
@@ -110,6 +114,10 @@ public:
 
     UPROPERTY(BlueprintReadOnly, Category="Combat")
     bool bCanTakeDamage = true;
+
+    // Immunity after a hit, in seconds (converted to whole combat steps)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Combat")
+    float DamageImmunityDuration = 0.1f;
     
     // Physics and movement
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Physics")
@@ -123,6 +131,12 @@ public:
     
     UPROPERTY(BlueprintReadOnly, Category="Physics")
     FVector InitialLocation = FVector::ZeroVector;
+
+    // Actor location before the latest combat step; the mesh is drawn between this and the current location
+    FVector PreviousStepLocation = FVector::ZeroVector;
+    FVector DummyMeshBaseLocation = FVector::ZeroVector;
+
+    FDelegateHandle FixedCombatStepHandle;
     
     // Visual effects
     UPROPERTY(BlueprintReadOnly, Category="Visual Effects")
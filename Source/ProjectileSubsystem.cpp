@@ -0,0 +1,241 @@
+#include "ProjectileSubsystem.h"
+#include "BloodreadMemory.h"
+#include "BloodreadBaseCharacter.h"
+#include "PracticeDummy.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "CollisionQueryParams.h"
+
+namespace
+{
+    const TCHAR* ProjectileSection = TEXT("/Script/BloodreadGame.ProjectileSubsystem");
+
+    // Matches the "Projectile" entry in DefaultEngine.ini
+    constexpr ECollisionChannel ProjectileChannel = ECC_GameTraceChannel1;
+
+    // Never fast-forward a late spawn by more than this (seconds)
+    constexpr float MaxCatchUpTime = 0.5f;
+}
+
+void UProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (GConfig)
+    {
+        GConfig->GetFloat(ProjectileSection, TEXT("MaxSubstepTime"), MaxSubstepTime, GGameIni);
+        GConfig->GetInt(ProjectileSection, TEXT("InitialCapacity"), InitialCapacity, GGameIni);
+    }
+    MaxSubstepTime = FMath::Max(MaxSubstepTime, 1.0f / 240.0f);
+
+    Positions.Reserve(InitialCapacity);
+    Velocities.Reserve(InitialCapacity);
+    GravityZ.Reserve(InitialCapacity);
+    Radii.Reserve(InitialCapacity);
+    RemainingLife.Reserve(InitialCapacity);
+    Damages.Reserve(InitialCapacity);
+    KnockbackForces.Reserve(InitialCapacity);
+    Ids.Reserve(InitialCapacity);
+    Instigators.Reserve(InitialCapacity);
+    PendingRemoval.Reserve(InitialCapacity);
+}
+
+bool UProjectileSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    const UWorld* World = Cast<UWorld>(Outer);
+    return Super::ShouldCreateSubsystem(Outer) && World && World->IsGameWorld();
+}
+
+TStatId UProjectileSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSubsystem, STATGROUP_Tickables);
+}
+
+uint32 UProjectileSubsystem::FireProjectile(ABloodreadBaseCharacter* Instigator, const FProjectileSpawnParams& Params)
+{
+    if (!Instigator || !Instigator->HasAuthority())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ProjectileSubsystem: FireProjectile must be called on the server with a valid instigator"));
+        return 0;
+    }
+
+    FProjectileSpawnParams ReplicatedParams = Params;
+    ReplicatedParams.ProjectileId = NextProjectileId++;
+    if (NextProjectileId == 0)
+    {
+        NextProjectileId = 1;
+    }
+
+    const AGameStateBase* GameState = GetWorld()->GetGameState();
+    ReplicatedParams.SpawnServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+
+    AddProjectile(Instigator, ReplicatedParams);
+
+    // Listen server and standalone already simulate locally; only remote clients act on the multicast
+    if (GetWorld()->GetNetMode() != NM_Standalone)
+    {
+        Instigator->Multicast_SpawnProjectile(ReplicatedParams);
+    }
+    return ReplicatedParams.ProjectileId;
+}
+
+void UProjectileSubsystem::AddReplicatedProjectile(ABloodreadBaseCharacter* Instigator, const FProjectileSpawnParams& Params)
+{
+    const int32 Index = AddProjectile(Instigator, Params);
+
+    // Catch up on the time the spawn spent in flight so the client's projectile lines up with the server's
+    const AGameStateBase* GameState = GetWorld()->GetGameState();
+    const float Latency = GameState ? FMath::Clamp(GameState->GetServerWorldTimeSeconds() - Params.SpawnServerTime, 0.0f, MaxCatchUpTime) : 0.0f;
+    if (Latency <= 0.0f)
+    {
+        return;
+    }
+
+    // Same substeps as Tick so the fast-forwarded arc matches the server's. A projectile that would already
+    // have hit something on the server is just dropped - the impact is server driven
+    UWorld* World = GetWorld();
+    const int32 NumSubsteps = FMath::Max(1, FMath::CeilToInt(Latency / MaxSubstepTime));
+    const float SubstepTime = Latency / NumSubsteps;
+    FHitResult Hit;
+    for (int32 Step = 0; Step < NumSubsteps; ++Step)
+    {
+        if (StepProjectile(World, Index, SubstepTime, Hit) != EStepResult::Moved)
+        {
+            RemoveProjectileAt(Index);
+            return;
+        }
+    }
+}
+
+int32 UProjectileSubsystem::AddProjectile(ABloodreadBaseCharacter* Instigator, const FProjectileSpawnParams& Params)
+{
+    LLM_SCOPE_BYTAG(Bloodread_Abilities);
+    const float WorldGravityZ = GetWorld()->GetGravityZ();
+
+    Positions.Add(Params.Origin);
+    Velocities.Add(Params.Velocity);
+    GravityZ.Add(WorldGravityZ * Params.GravityScale);
+    Radii.Add(FMath::Max(Params.Radius, 1.0f));
+    RemainingLife.Add(Params.Lifetime);
+    Damages.Add(Params.Damage);
+    KnockbackForces.Add(Params.KnockbackForce);
+    Ids.Add(Params.ProjectileId);
+    return Instigators.Add(Instigator);
+}
+
+void UProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+    Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    GravityZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    RemainingLife.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Damages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    KnockbackForces.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Ids.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Instigators.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UProjectileSubsystem::RemoveProjectileById(uint32 ProjectileId)
+{
+    const int32 Index = Ids.Find(ProjectileId);
+    if (Index != INDEX_NONE)
+    {
+        RemoveProjectileAt(Index);
+    }
+}
+
+void UProjectileSubsystem::Tick(float DeltaTime)
+{
+    if (Ids.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 NumSubsteps = FMath::Max(1, FMath::CeilToInt(DeltaTime / MaxSubstepTime));
+    const float SubstepTime = DeltaTime / NumSubsteps;
+    for (int32 Step = 0; Step < NumSubsteps && Ids.Num() > 0; ++Step)
+    {
+        Simulate(SubstepTime);
+    }
+}
+
+void UProjectileSubsystem::Simulate(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    const bool bAuthority = World->GetNetMode() != NM_Client;
+
+    PendingRemoval.Reset();
+
+    const int32 Count = Ids.Num();
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        FHitResult Hit;
+        const EStepResult Result = StepProjectile(World, Index, DeltaTime, Hit);
+        if (Result == EStepResult::Hit && bAuthority)
+        {
+            HandleHit(Index, Hit);
+        }
+        if (Result != EStepResult::Moved)
+        {
+            PendingRemoval.Add(Index);
+        }
+    }
+
+    // Remove back to front so swapped-in elements are ones already processed
+    for (int32 RemovalIndex = PendingRemoval.Num() - 1; RemovalIndex >= 0; --RemovalIndex)
+    {
+        RemoveProjectileAt(PendingRemoval[RemovalIndex]);
+    }
+}
+
+UProjectileSubsystem::EStepResult UProjectileSubsystem::StepProjectile(UWorld* World, int32 Index, float DeltaTime, FHitResult& OutHit)
+{
+    RemainingLife[Index] -= DeltaTime;
+    if (RemainingLife[Index] <= 0.0f)
+    {
+        return EStepResult::Expired;
+    }
+
+    // Semi-implicit Euler - identical on server and clients given the same spawn parameters
+    Velocities[Index].Z += GravityZ[Index] * DeltaTime;
+    const FVector Start = Positions[Index];
+    const FVector End = Start + Velocities[Index] * DeltaTime;
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BloodreadProjectile), false);
+    if (ABloodreadBaseCharacter* Instigator = Instigators[Index].Get())
+    {
+        QueryParams.AddIgnoredActor(Instigator);
+    }
+
+    if (World->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity, ProjectileChannel, FCollisionShape::MakeSphere(Radii[Index]), QueryParams))
+    {
+        Positions[Index] = OutHit.Location;
+        return EStepResult::Hit;
+    }
+
+    Positions[Index] = End;
+    return EStepResult::Moved;
+}
+
+void UProjectileSubsystem::HandleHit(int32 Index, const FHitResult& Hit)
+{
+    AActor* HitActor = Hit.GetActor();
+    ABloodreadBaseCharacter* Instigator = Instigators[Index].Get();
+    const FVector KnockbackDirection = Velocities[Index].GetSafeNormal();
+
+    if (ABloodreadBaseCharacter* HitCharacter = Cast<ABloodreadBaseCharacter>(HitActor))
+    {
+        HitCharacter->DealDamageWithKnockback(Damages[Index], KnockbackDirection, KnockbackForces[Index], Instigator);
+    }
+    else if (APracticeDummy* HitDummy = Cast<APracticeDummy>(HitActor))
+    {
+        HitDummy->TakeCustomDamage(Damages[Index], nullptr);
+        HitDummy->ApplyKnockback(KnockbackDirection, KnockbackForces[Index]);
+    }
+
+    if (Instigator && GetWorld()->GetNetMode() != NM_Standalone)
+    {
+        Instigator->Multicast_ProjectileImpact(Ids[Index], FVector_NetQuantize(Hit.Location));
+    }
+}
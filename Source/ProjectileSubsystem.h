@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/NetSerialization.h"
+#include "ProjectileSubsystem.generated.h"
+
+class ABloodreadBaseCharacter;
+
+// Everything a client needs to simulate a projectile identically to the server - replicated once at spawn
+USTRUCT(BlueprintType)
+struct FProjectileSpawnParams
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+    FVector_NetQuantize10 Origin = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+    FVector_NetQuantize10 Velocity = FVector::ZeroVector;
+
+    // Multiplier on world gravity (0 = straight line)
+    UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+    float GravityScale = 0.0f;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+    float Radius = 10.0f;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+    float Lifetime = 3.0f;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+    int32 Damage = 10;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+    float KnockbackForce = 300.0f;
+
+    // Server world time at spawn; clients fast-forward by the difference on arrival
+    UPROPERTY()
+    float SpawnServerTime = 0.0f;
+
+    // Server-assigned, lets clients match server hit notifications
+    UPROPERTY()
+    uint32 ProjectileId = 0;
+};
+
+/**
+ * Pooled, batched projectile simulation.
+ * In-flight projectiles live in parallel arrays (structure of arrays) rather than as actors; one pass per tick
+ * integrates and sweeps every projectile in fixed substeps on the "Projectile" channel (ECC_GameTraceChannel1).
+ * The server is authoritative for hits and damage. Spawns replicate once through the instigating character's
+ * Multicast_SpawnProjectile and clients simulate the same parameters locally for visuals.
+ */
+UCLASS()
+class BLOODREADGAME_API UProjectileSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Server: launch a projectile owned by Instigator and replicate it to clients
+    uint32 FireProjectile(ABloodreadBaseCharacter* Instigator, const FProjectileSpawnParams& Params);
+
+    // Client: add a replicated projectile, fast-forwarding it to the current server time
+    void AddReplicatedProjectile(ABloodreadBaseCharacter* Instigator, const FProjectileSpawnParams& Params);
+
+    // Client: the server reported a hit, stop simulating that projectile
+    void RemoveProjectileById(uint32 ProjectileId);
+
+    int32 GetNumActiveProjectiles() const { return Ids.Num(); }
+
+private:
+    int32 AddProjectile(ABloodreadBaseCharacter* Instigator, const FProjectileSpawnParams& Params);
+    void RemoveProjectileAt(int32 Index);
+    void Simulate(float DeltaTime);
+    void HandleHit(int32 Index, const FHitResult& Hit);
+
+    enum class EStepResult : uint8 { Moved, Expired, Hit };
+
+    // Advance one projectile by a single substep; shared by the simulation and the client catch-up
+    EStepResult StepProjectile(UWorld* World, int32 Index, float DeltaTime, FHitResult& OutHit);
+
+    // Structure of arrays - every array has one element per in-flight projectile, removal swaps with the last
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+    TArray<float> GravityZ;
+    TArray<float> Radii;
+    TArray<float> RemainingLife;
+    TArray<int32> Damages;
+    TArray<float> KnockbackForces;
+    TArray<uint32> Ids;
+    TArray<TWeakObjectPtr<ABloodreadBaseCharacter>> Instigators;
+
+    // Indices hit or expired this pass, removed after the batch so the arrays aren't reshuffled mid-loop
+    TArray<int32> PendingRemoval;
+
+    // Largest simulation step (seconds); longer frames are split into equal substeps
+    float MaxSubstepTime = 1.0f / 60.0f;
+
+    // Pool size reserved up front so steady-state combat never reallocates
+    int32 InitialCapacity = 128;
+
+    uint32 NextProjectileId = 1;
+};
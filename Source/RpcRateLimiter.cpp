@@ -0,0 +1,154 @@
+#include "RpcRateLimiter.h"
+#include "Engine/NetConnection.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+    const TCHAR* RpcRateLimitSection = TEXT("/Script/BloodreadGame.RpcRateLimit");
+
+    const TCHAR* GetRpcName(ECombatRpc Rpc)
+    {
+        switch (Rpc)
+        {
+            case ECombatRpc::UseAbility:  return TEXT("UseAbility");
+            case ECombatRpc::BasicAttack: return TEXT("BasicAttack");
+            case ECombatRpc::TakeDamage:  return TEXT("TakeDamage");
+            case ECombatRpc::Knockback:   return TEXT("Knockback");
+            case ECombatRpc::CombatChecksum: return TEXT("CombatChecksum");
+            default:                      return TEXT("Unknown");
+        }
+    }
+
+    constexpr double PruneInterval = 30.0;
+}
+
+bool FRpcTokenBucket::TryConsume(double Now, float Rate, float Burst)
+{
+    if (Tokens < 0.0f)
+    {
+        Tokens = Burst;
+    }
+    else
+    {
+        Tokens = FMath::Min(Burst, Tokens + static_cast<float>((Now - LastRefillTime) * Rate));
+    }
+    LastRefillTime = Now;
+
+    if (Tokens < 1.0f)
+    {
+        return false;
+    }
+    Tokens -= 1.0f;
+    return true;
+}
+
+void URpcRateLimitSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Limits[static_cast<int32>(ECombatRpc::UseAbility)] = { 4.0f, 4.0f };
+    Limits[static_cast<int32>(ECombatRpc::BasicAttack)] = { 6.0f, 6.0f };
+    Limits[static_cast<int32>(ECombatRpc::TakeDamage)] = { 10.0f, 10.0f };
+    Limits[static_cast<int32>(ECombatRpc::Knockback)] = { 10.0f, 10.0f };
+    Limits[static_cast<int32>(ECombatRpc::CombatChecksum)] = { 12.0f, 12.0f };
+
+    if (GConfig)
+    {
+        for (int32 RpcIndex = 0; RpcIndex < static_cast<int32>(ECombatRpc::Count); ++RpcIndex)
+        {
+            const FString Name = GetRpcName(static_cast<ECombatRpc>(RpcIndex));
+            GConfig->GetFloat(RpcRateLimitSection, *(Name + TEXT("Rate")), Limits[RpcIndex].Rate, GGameIni);
+            GConfig->GetFloat(RpcRateLimitSection, *(Name + TEXT("Burst")), Limits[RpcIndex].Burst, GGameIni);
+            Limits[RpcIndex].Burst = FMath::Max(1.0f, Limits[RpcIndex].Burst);
+        }
+        GConfig->GetFloat(RpcRateLimitSection, TEXT("MaxKnockbackForce"), MaxKnockbackForce, GGameIni);
+        GConfig->GetFloat(RpcRateLimitSection, TEXT("MaxReportedDamage"), MaxReportedDamage, GGameIni);
+        GConfig->GetFloat(RpcRateLimitSection, TEXT("MaxKnockbackTargetRange"), MaxKnockbackTargetRange, GGameIni);
+    }
+}
+
+bool URpcRateLimitSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Only servers receive client RPCs
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && (World->GetNetMode() == NM_DedicatedServer || World->GetNetMode() == NM_ListenServer);
+}
+
+bool URpcRateLimitSubsystem::Allow(const AActor* Caller, ECombatRpc Rpc)
+{
+    UNetConnection* Connection = Caller ? Caller->GetNetConnection() : nullptr;
+    const UWorld* World = Caller ? Caller->GetWorld() : nullptr;
+    URpcRateLimitSubsystem* Limiter = World ? World->GetSubsystem<URpcRateLimitSubsystem>() : nullptr;
+    if (!Connection || !Limiter)
+    {
+        return true;
+    }
+    return Limiter->AllowInternal(Connection, Rpc);
+}
+
+bool URpcRateLimitSubsystem::AllowInternal(UNetConnection* Connection, ECombatRpc Rpc)
+{
+    const double Now = GetWorld()->GetRealTimeSeconds();
+    if (Now - LastPruneTime > PruneInterval)
+    {
+        PruneClosedConnections();
+        LastPruneTime = Now;
+    }
+
+    const FRpcRateLimit& Limit = Limits[static_cast<int32>(Rpc)];
+    FConnectionBuckets& Buckets = ConnectionBuckets.FindOrAdd(Connection);
+    if (Buckets.Buckets[static_cast<int32>(Rpc)].TryConsume(Now, Limit.Rate, Limit.Burst))
+    {
+        return true;
+    }
+
+    // Summarise drops once a second rather than logging every rejected call
+    ++Buckets.DroppedSinceLog;
+    if (Now - Buckets.LastDropLogTime >= 1.0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RpcRateLimit: Dropped %d calls from %s (last: %s)"),
+               Buckets.DroppedSinceLog, *Connection->LowLevelGetRemoteAddress(true), GetRpcName(Rpc));
+        Buckets.DroppedSinceLog = 0;
+        Buckets.LastDropLogTime = Now;
+    }
+    return false;
+}
+
+void URpcRateLimitSubsystem::PruneClosedConnections()
+{
+    for (auto It = ConnectionBuckets.CreateIterator(); It; ++It)
+    {
+        const UNetConnection* Connection = It.Key().ResolveObjectPtr();
+        if (!Connection || Connection->GetConnectionState() == USOCK_Closed)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+float URpcRateLimitSubsystem::GetMaxKnockbackForce(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const URpcRateLimitSubsystem* Limiter = World ? World->GetSubsystem<URpcRateLimitSubsystem>() : nullptr;
+    return Limiter ? Limiter->MaxKnockbackForce : 5000.0f;
+}
+
+float URpcRateLimitSubsystem::GetMaxReportedDamage(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const URpcRateLimitSubsystem* Limiter = World ? World->GetSubsystem<URpcRateLimitSubsystem>() : nullptr;
+    return Limiter ? Limiter->MaxReportedDamage : 500.0f;
+}
+
+float URpcRateLimitSubsystem::GetMaxKnockbackTargetRange(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const URpcRateLimitSubsystem* Limiter = World ? World->GetSubsystem<URpcRateLimitSubsystem>() : nullptr;
+    return Limiter ? Limiter->MaxKnockbackTargetRange : 1000.0f;
+}
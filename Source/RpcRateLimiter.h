@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "RpcRateLimiter.generated.h"
+
+class UNetConnection;
+
+// Client-to-server combat RPC families that share a rate limit
+enum class ECombatRpc : uint8
+{
+    UseAbility,
+    BasicAttack,
+    TakeDamage,
+    Knockback,
+    CombatChecksum,
+    Count
+};
+
+// Classic token bucket: refills at Rate tokens/s up to Burst, one token per call
+struct FRpcTokenBucket
+{
+    float Tokens = -1.0f; // Negative until first use, then starts full
+    double LastRefillTime = 0.0;
+
+    bool TryConsume(double Now, float Rate, float Burst);
+};
+
+// Rate and burst for one RPC family
+struct FRpcRateLimit
+{
+    float Rate = 5.0f;
+    float Burst = 5.0f;
+};
+
+/**
+ * Server-side flood protection for combat RPCs.
+ * Each client connection gets a token bucket per ECombatRpc family; calls beyond the configured rate are
+ * dropped at the top of the RPC implementation before any gameplay code runs. The _Validate functions handle
+ * malformed input (out of range, non-finite, absurd values) and disconnect; this only sheds volume.
+ * Calls with no remote connection (listen server host, standalone) are never limited.
+ * Limits and sanity bounds come from [/Script/BloodreadGame.RpcRateLimit] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API URpcRateLimitSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // True if Caller's owning connection may make another call of this family right now
+    static bool Allow(const AActor* Caller, ECombatRpc Rpc);
+
+    // Sanity bounds shared by the _Validate functions (defaults when the subsystem isn't running)
+    static float GetMaxKnockbackForce(const UObject* WorldContextObject);
+    static float GetMaxReportedDamage(const UObject* WorldContextObject);
+    static float GetMaxKnockbackTargetRange(const UObject* WorldContextObject);
+
+private:
+    struct FConnectionBuckets
+    {
+        FRpcTokenBucket Buckets[static_cast<int32>(ECombatRpc::Count)];
+        int32 DroppedSinceLog = 0;
+        double LastDropLogTime = 0.0;
+    };
+
+    bool AllowInternal(UNetConnection* Connection, ECombatRpc Rpc);
+    void PruneClosedConnections();
+
+    FRpcRateLimit Limits[static_cast<int32>(ECombatRpc::Count)];
+
+    // Largest knockback force a client may request
+    float MaxKnockbackForce = 5000.0f;
+
+    // Largest single damage amount a client may report against itself
+    float MaxReportedDamage = 500.0f;
+
+    // How far away a client may knock another character back from
+    float MaxKnockbackTargetRange = 1000.0f;
+
+    TMap<TObjectKey<UNetConnection>, FConnectionBuckets> ConnectionBuckets;
+    double LastPruneTime = 0.0;
+};
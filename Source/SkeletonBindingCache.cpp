@@ -0,0 +1,95 @@
+#include "SkeletonBindingCache.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+
+namespace
+{
+    // Candidate names per point, tried in order (sockets first, then bones)
+    const TArray<FName>& GetCandidateNames(EBloodreadSkeletonPoint Point)
+    {
+        static const TArray<FName> Head = { TEXT("head"), TEXT("Head"), TEXT("HEAD"), TEXT("head_01"), TEXT("Head_01"),
+                                            TEXT("b_head"), TEXT("B_Head"), TEXT("Bip01_Head"), TEXT("spine_03"), TEXT("Spine_03") };
+        static const TArray<FName> RightHand = { TEXT("hand_r"), TEXT("Hand_R"), TEXT("RightHand"), TEXT("b_RightHand"), TEXT("Bip01_R_Hand") };
+        static const TArray<FName> LeftHand = { TEXT("hand_l"), TEXT("Hand_L"), TEXT("LeftHand"), TEXT("b_LeftHand"), TEXT("Bip01_L_Hand") };
+        static const TArray<FName> Weapon = { TEXT("weapon_r"), TEXT("WeaponSocket"), TEXT("Weapon"), TEXT("weapon"), TEXT("weapon_l"), TEXT("hand_r") };
+        static const TArray<FName> HitCenter = { TEXT("spine_02"), TEXT("Spine_02"), TEXT("spine_01"), TEXT("Spine_01"), TEXT("pelvis"), TEXT("Pelvis") };
+        static const TArray<FName> None;
+
+        switch (Point)
+        {
+            case EBloodreadSkeletonPoint::Head:      return Head;
+            case EBloodreadSkeletonPoint::RightHand: return RightHand;
+            case EBloodreadSkeletonPoint::LeftHand:  return LeftHand;
+            case EBloodreadSkeletonPoint::Weapon:    return Weapon;
+            case EBloodreadSkeletonPoint::HitCenter: return HitCenter;
+            default:                                 return None;
+        }
+    }
+}
+
+FSkeletonBindingCache& FSkeletonBindingCache::Get()
+{
+    static FSkeletonBindingCache Cache;
+    return Cache;
+}
+
+const FBloodreadSkeletonBindings& FSkeletonBindingCache::Resolve(const USkeletalMesh* Mesh)
+{
+    if (!Mesh)
+    {
+        return EmptyBindings;
+    }
+
+    const TObjectKey<USkeletalMesh> Key(Mesh);
+    if (const FBloodreadSkeletonBindings* Cached = Bindings.Find(Key))
+    {
+        return *Cached;
+    }
+
+    return Bindings.Add(Key, Build(Mesh));
+}
+
+FBloodreadSkeletonBindings FSkeletonBindingCache::Build(const USkeletalMesh* Mesh) const
+{
+    FBloodreadSkeletonBindings Result;
+    const FReferenceSkeleton& RefSkeleton = Mesh->GetRefSkeleton();
+
+    for (int32 PointIndex = 0; PointIndex < static_cast<int32>(EBloodreadSkeletonPoint::Count); ++PointIndex)
+    {
+        for (const FName& Candidate : GetCandidateNames(static_cast<EBloodreadSkeletonPoint>(PointIndex)))
+        {
+            // FindSocket covers the mesh's own sockets and the ones it inherits from its skeleton
+            if (Mesh->FindSocket(Candidate) || RefSkeleton.FindBoneIndex(Candidate) != INDEX_NONE)
+            {
+                Result.PointNames[PointIndex] = Candidate;
+                break;
+            }
+        }
+    }
+
+    // Last resort for the head: any bone with "head" or "skull" in the name
+    const int32 HeadIndex = static_cast<int32>(EBloodreadSkeletonPoint::Head);
+    if (Result.PointNames[HeadIndex] == NAME_None)
+    {
+        for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+        {
+            const FString BoneName = RefSkeleton.GetBoneName(BoneIndex).ToString();
+            if (BoneName.Contains(TEXT("head"), ESearchCase::IgnoreCase) ||
+                BoneName.Contains(TEXT("skull"), ESearchCase::IgnoreCase))
+            {
+                Result.PointNames[HeadIndex] = RefSkeleton.GetBoneName(BoneIndex);
+                break;
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SkeletonBindingCache: Resolved %s - Head=%s RightHand=%s LeftHand=%s Weapon=%s HitCenter=%s"),
+           *Mesh->GetName(),
+           *Result.GetName(EBloodreadSkeletonPoint::Head).ToString(),
+           *Result.GetName(EBloodreadSkeletonPoint::RightHand).ToString(),
+           *Result.GetName(EBloodreadSkeletonPoint::LeftHand).ToString(),
+           *Result.GetName(EBloodreadSkeletonPoint::Weapon).ToString(),
+           *Result.GetName(EBloodreadSkeletonPoint::HitCenter).ToString());
+
+    return Result;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "SkeletonBindingCache.generated.h"
+
+class USkeletalMesh;
+
+// Gameplay attachment points shared by camera attachment, hit effects and hitboxes
+UENUM(BlueprintType)
+enum class EBloodreadSkeletonPoint : uint8
+{
+    Head        UMETA(DisplayName = "Head"),
+    RightHand   UMETA(DisplayName = "Right Hand"),
+    LeftHand    UMETA(DisplayName = "Left Hand"),
+    Weapon      UMETA(DisplayName = "Weapon"),
+    HitCenter   UMETA(DisplayName = "Hit Center"),
+    Count       UMETA(Hidden)
+};
+
+// Resolved bone/socket names for one mesh (NAME_None when a point has no match)
+struct BLOODREADGAME_API FBloodreadSkeletonBindings
+{
+    FName PointNames[static_cast<int32>(EBloodreadSkeletonPoint::Count)];
+
+    FBloodreadSkeletonBindings()
+    {
+        for (int32 Index = 0; Index < static_cast<int32>(EBloodreadSkeletonPoint::Count); ++Index)
+        {
+            PointNames[Index] = NAME_None;
+        }
+    }
+
+    FName GetName(EBloodreadSkeletonPoint Point) const { return PointNames[static_cast<int32>(Point)]; }
+    bool Has(EBloodreadSkeletonPoint Point) const { return GetName(Point) != NAME_None; }
+};
+
+/**
+ * Process-wide cache of bone and socket lookups keyed by skeletal mesh.
+ * Meshes sharing a skeleton can still add their own sockets and differ in bone set, so each mesh gets its own entry.
+ * Name matching (including the slow case-insensitive bone scan) runs once per mesh, the first time it is assigned;
+ * every later possession or respawn is a map lookup.
+ */
+class BLOODREADGAME_API FSkeletonBindingCache
+{
+public:
+    static FSkeletonBindingCache& Get();
+
+    // Returns cached bindings for the mesh, resolving them on first use (don't hold the reference across calls)
+    const FBloodreadSkeletonBindings& Resolve(const USkeletalMesh* Mesh);
+
+    void Reset() { Bindings.Reset(); }
+
+private:
+    FBloodreadSkeletonBindings Build(const USkeletalMesh* Mesh) const;
+
+    TMap<TObjectKey<USkeletalMesh>, FBloodreadSkeletonBindings> Bindings;
+    FBloodreadSkeletonBindings EmptyBindings;
+};
@@ -0,0 +1,190 @@
+#include "TeamSubsystem.h"
+#include "BloodreadStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/PlayerState.h"
+
+namespace
+{
+    const TCHAR* TeamsSection = TEXT("/Script/BloodreadGame.Teams");
+
+    // Humans and backfill bots (anything with a PlayerState)
+    int32 CountPlayerSlots(const TArray<ABloodreadBaseCharacter*>& TeamMembers)
+    {
+        int32 Count = 0;
+        for (const ABloodreadBaseCharacter* Member : TeamMembers)
+        {
+            Count += Member->GetPlayerState() ? 1 : 0;
+        }
+        return Count;
+    }
+}
+
+void UBloodreadTeamSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    FString ModeName;
+    if (GConfig && GConfig->GetString(TeamsSection, TEXT("AssignmentMode"), ModeName, GGameIni))
+    {
+        const int64 Value = StaticEnum<ETeamAssignmentMode>()->GetValueByNameString(ModeName);
+        if (Value != INDEX_NONE)
+        {
+            AssignmentMode = static_cast<ETeamAssignmentMode>(Value);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Teams: Unknown AssignmentMode '%s', using Coop"), *ModeName);
+        }
+    }
+}
+
+void UBloodreadTeamSubsystem::Deinitialize()
+{
+    for (TArray<ABloodreadBaseCharacter*>& TeamMembers : Members)
+    {
+        TeamMembers.Reset();
+    }
+    Slots.Reset();
+    Super::Deinitialize();
+}
+
+bool UBloodreadTeamSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Clients answer ally queries too (Regeneration, Bond targeting), from the replicated teams
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld();
+}
+
+UBloodreadTeamSubsystem* UBloodreadTeamSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UBloodreadTeamSubsystem>() : nullptr;
+}
+
+ETeam UBloodreadTeamSubsystem::ChooseTeam(const ABloodreadBaseCharacter* Character) const
+{
+    const AController* Controller = Character ? Character->GetController() : nullptr;
+    if (!Controller || AssignmentMode == ETeamAssignmentMode::FreeForAll)
+    {
+        return ETeam::None;
+    }
+
+    if (AssignmentMode == ETeamAssignmentMode::Versus && Controller->PlayerState)
+    {
+        // Fill the smaller side; ties go to Player. Bots take a slot like a human, so backfill evens teams out
+        const int32 PlayerSide = CountPlayerSlots(GetMembers(ETeam::Player));
+        const int32 EnemySide = CountPlayerSlots(GetMembers(ETeam::Enemy));
+        return EnemySide < PlayerSide ? ETeam::Enemy : ETeam::Player;
+    }
+
+    return Controller->IsPlayerController() ? ETeam::Player : ETeam::Enemy;
+}
+
+void UBloodreadTeamSubsystem::AddMember(ABloodreadBaseCharacter* Character, ETeam Team)
+{
+    TArray<ABloodreadBaseCharacter*>& TeamMembers = Members[static_cast<int32>(Team)];
+    FTeamSlot& Slot = Slots.Add(Character);
+    Slot.Team = Team;
+    Slot.Index = TeamMembers.Add(Character);
+}
+
+void UBloodreadTeamSubsystem::RemoveMember(const ABloodreadBaseCharacter* Character)
+{
+    FTeamSlot Slot;
+    if (!Slots.RemoveAndCopyValue(Character, Slot))
+    {
+        return;
+    }
+
+    // Swap-remove and repoint the member that moved into the hole
+    TArray<ABloodreadBaseCharacter*>& TeamMembers = Members[static_cast<int32>(Slot.Team)];
+    TeamMembers.RemoveAtSwap(Slot.Index, 1, EAllowShrinking::No);
+    if (TeamMembers.IsValidIndex(Slot.Index))
+    {
+        Slots.FindChecked(TeamMembers[Slot.Index]).Index = Slot.Index;
+    }
+}
+
+void UBloodreadTeamSubsystem::UpdateMembership(ABloodreadBaseCharacter* Character)
+{
+    if (!Character)
+    {
+        return;
+    }
+
+    const bool bShouldBeMember = Character->GetIsAlive() && !Character->IsActorBeingDestroyed();
+    const FTeamSlot* Slot = Slots.Find(Character);
+
+    if (Slot && (!bShouldBeMember || Slot->Team != Character->GetTeam()))
+    {
+        RemoveMember(Character);
+        Slot = nullptr;
+    }
+    if (!Slot && bShouldBeMember)
+    {
+        AddMember(Character, Character->GetTeam());
+    }
+}
+
+void UBloodreadTeamSubsystem::GetAllies(const ABloodreadBaseCharacter* Character, TArray<ABloodreadBaseCharacter*>& Out) const
+{
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadTargeting);
+    if (!Character || Character->GetTeam() == ETeam::None)
+    {
+        return;
+    }
+
+    for (ABloodreadBaseCharacter* Member : GetMembers(Character->GetTeam()))
+    {
+        if (Member != Character)
+        {
+            Out.Add(Member);
+        }
+    }
+}
+
+void UBloodreadTeamSubsystem::AppendInRadius(ETeam Team, const ABloodreadBaseCharacter* Character, float RadiusSquared, TArray<ABloodreadBaseCharacter*>& Out) const
+{
+    const FVector Origin = Character->GetActorLocation();
+    for (ABloodreadBaseCharacter* Member : GetMembers(Team))
+    {
+        if (Member != Character && FVector::DistSquared(Origin, Member->GetActorLocation()) <= RadiusSquared)
+        {
+            Out.Add(Member);
+        }
+    }
+}
+
+void UBloodreadTeamSubsystem::GetAlliesInRadius(const ABloodreadBaseCharacter* Character, float Radius, TArray<ABloodreadBaseCharacter*>& Out) const
+{
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadTargeting);
+    if (Character && Character->GetTeam() != ETeam::None)
+    {
+        AppendInRadius(Character->GetTeam(), Character, FMath::Square(Radius), Out);
+    }
+}
+
+void UBloodreadTeamSubsystem::GetEnemiesInRadius(const ABloodreadBaseCharacter* Character, float Radius, TArray<ABloodreadBaseCharacter*>& Out) const
+{
+    BLOODREAD_COMBAT_SCOPE(STAT_BloodreadTargeting);
+    if (!Character)
+    {
+        return;
+    }
+
+    const ETeam OwnTeam = Character->GetTeam();
+    for (int32 TeamIndex = 0; TeamIndex < NumTeams; ++TeamIndex)
+    {
+        const ETeam Team = static_cast<ETeam>(TeamIndex);
+        if (AreEnemies(OwnTeam, Team))
+        {
+            AppendInRadius(Team, Character, FMath::Square(Radius), Out);
+        }
+    }
+}
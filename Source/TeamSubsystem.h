@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BloodreadBaseCharacter.h"
+#include "TeamSubsystem.generated.h"
+
+// How the server picks a team for a newly possessed character
+UENUM(BlueprintType)
+enum class ETeamAssignmentMode : uint8
+{
+    Coop        UMETA(DisplayName = "Co-op"),          // Players on Player, AI on Enemy
+    Versus      UMETA(DisplayName = "Versus"),         // Players split between Player and Enemy, AI on Enemy
+    FreeForAll  UMETA(DisplayName = "Free For All")    // Nobody gets a team; everyone is everyone's enemy
+};
+
+/**
+ * Team membership for every living character in the world.
+ * Each team keeps a dense member array (swap-removed on death, team change or EndPlay) and each character its
+ * slot in it, so joining, leaving and ally/enemy queries never scan the world. Characters keep their own entry
+ * current through UpdateMembership whenever their team or alive state changes; the replicated Team property
+ * keeps client registries in step with the server.
+ *   Allies  - same team, except None (no team) which has no allies
+ *   Enemies - any other team except Neutral; None is hostile to everyone including other None characters
+ * The assignment mode comes from [/Script/BloodreadGame.Teams] in DefaultGame.ini.
+ */
+UCLASS()
+class BLOODREADGAME_API UBloodreadTeamSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static constexpr int32 NumTeams = static_cast<int32>(ETeam::Neutral) + 1;
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    static UBloodreadTeamSubsystem* Get(const UObject* WorldContextObject);
+
+    static bool AreAllies(ETeam A, ETeam B) { return A == B && A != ETeam::None; }
+    static bool AreEnemies(ETeam A, ETeam B) { return !AreAllies(A, B) && A != ETeam::Neutral && B != ETeam::Neutral; }
+
+    // Server: pick a team for a character that doesn't have one yet, from its controller and the assignment mode
+    ETeam ChooseTeam(const ABloodreadBaseCharacter* Character) const;
+
+    // Add, move or remove the character's entry to match its current team and alive state
+    void UpdateMembership(ABloodreadBaseCharacter* Character);
+
+    // Drop the character's entry (EndPlay)
+    void RemoveMember(const ABloodreadBaseCharacter* Character);
+
+    // Living members of a team
+    const TArray<ABloodreadBaseCharacter*>& GetMembers(ETeam Team) const { return Members[static_cast<int32>(Team)]; }
+
+    // Queries append to Out and never include Character itself
+    void GetAllies(const ABloodreadBaseCharacter* Character, TArray<ABloodreadBaseCharacter*>& Out) const;
+    void GetAlliesInRadius(const ABloodreadBaseCharacter* Character, float Radius, TArray<ABloodreadBaseCharacter*>& Out) const;
+    void GetEnemiesInRadius(const ABloodreadBaseCharacter* Character, float Radius, TArray<ABloodreadBaseCharacter*>& Out) const;
+
+private:
+    struct FTeamSlot
+    {
+        ETeam Team = ETeam::None;
+        int32 Index = INDEX_NONE;
+    };
+
+    void AddMember(ABloodreadBaseCharacter* Character, ETeam Team);
+    void AppendInRadius(ETeam Team, const ABloodreadBaseCharacter* Character, float RadiusSquared, TArray<ABloodreadBaseCharacter*>& Out) const;
+
+    ETeamAssignmentMode AssignmentMode = ETeamAssignmentMode::Coop;
+
+    // Raw pointers are safe: characters remove themselves in EndPlay before they can be destroyed
+    TArray<ABloodreadBaseCharacter*> Members[NumTeams];
+    TMap<const ABloodreadBaseCharacter*, FTeamSlot> Slots;
+};
@@ -1,4 +1,5 @@
 #include "UniversalHealthBarWidget.h"
+#include "BloodreadStats.h"
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
 #include "BloodreadBaseCharacter.h"
@@ -47,6 +48,7 @@ void UUniversalHealthBarWidget::InitializeWithDummy(APracticeDummy* Dummy)
 
 void UUniversalHealthBarWidget::UpdateHealthDisplay()
 {
+    BLOODREAD_SCOPE(STAT_BloodreadHUD);
     // Refresh health data from owner
     RefreshHealthData();
 
@@ -126,6 +128,7 @@ bool UUniversalHealthBarWidget::IsOwnerAlive() const
 
 void UUniversalHealthBarWidget::RefreshHealthData()
 {
+    BLOODREAD_SCOPE(STAT_BloodreadHUD);
     if (OwnerCharacter)
     {
         // Get health data from BloodreadBaseCharacter